@@ -0,0 +1,98 @@
+/* AFL++ driver: runs the harness in persistent mode, reading testcases
+ * from AFL++'s shared memory buffer. Build with afl-clang-fast++; see the
+ * cryptofuzz-afl target in the Makefile.
+ *
+ * Given file arguments, each file is run once instead, for reproducing
+ * crashes.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+extern "C" int LLVMFuzzerInitialize(int *argc, char ***argv);
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+/* Without afl-clang-fast, run stdin, read to EOF, as a single testcase */
+#ifndef __AFL_FUZZ_TESTCASE_LEN
+static const std::vector<unsigned char>& fuzz_stdin(void) {
+    static std::vector<unsigned char> data;
+    static bool haveRead = false;
+
+    if ( haveRead == false ) {
+        unsigned char chunk[65536];
+        ssize_t n;
+        while ( (n = read(0, chunk, sizeof(chunk))) > 0 ) {
+            data.insert(data.end(), chunk, chunk + n);
+        }
+        haveRead = true;
+    }
+
+    return data;
+}
+static bool fuzz_ran = false;
+#define __AFL_FUZZ_TESTCASE_LEN fuzz_stdin().size()
+#define __AFL_FUZZ_TESTCASE_BUF fuzz_stdin().data()
+#define __AFL_FUZZ_INIT() static_assert(true, "")
+#define __AFL_LOOP(x) (fuzz_ran == false ? (fuzz_ran = true) : false)
+#define __AFL_INIT() do { } while (0)
+#endif
+
+__AFL_FUZZ_INIT();
+
+/* Restart the process after this many inputs, to bound the effect of leaks */
+static constexpr unsigned int PersistentIterations = 100000;
+
+int main(int argc, char** argv) {
+    /* Hosts for out-of-process modules would be started by the fork
+     * server, and shared by all of its children, each with a stale copy
+     * of the state of the channels to them
+     */
+    for (int i = 1; i < argc; i++) {
+        if ( std::string(argv[i]).rfind("--remote-modules", 0) == 0 ) {
+            printf("--remote-modules is not supported by the AFL++ driver\n");
+            return 1;
+        }
+    }
+
+    /* Modules are initialized once, before the fork server starts */
+    LLVMFuzzerInitialize(&argc, &argv);
+
+    {
+        bool ranFiles = false;
+
+        for (int i = 1; i < argc; i++) {
+            if ( argv[i][0] == '-' ) {
+                continue;
+            }
+
+            std::ifstream file(argv[i], std::ios::binary);
+            const std::vector<uint8_t> data(
+                    (std::istreambuf_iterator<char>(file)),
+                    std::istreambuf_iterator<char>());
+
+            LLVMFuzzerTestOneInput(data.data(), data.size());
+            ranFiles = true;
+        }
+
+        if ( ranFiles == true ) {
+            return 0;
+        }
+    }
+
+    __AFL_INIT();
+
+    /* Must be read after __AFL_INIT() */
+    const unsigned char* buf = __AFL_FUZZ_TESTCASE_BUF;
+
+    while ( __AFL_LOOP(PersistentIterations) ) {
+        LLVMFuzzerTestOneInput(buf, __AFL_FUZZ_TESTCASE_LEN);
+    }
+
+    return 0;
+}
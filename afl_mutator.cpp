@@ -0,0 +1,137 @@
+/* AFL++ custom mutator (AFL_CUSTOM_MUTATOR_LIBRARY) which exposes
+ * LLVMFuzzerCustomMutator. It runs inside afl-fuzz, so options are taken
+ * from the CRYPTOFUZZ_MUTATOR_OPTIONS environment variable, e.g.
+ * "--operations=Digest --digests=SHA256", in addition to extra_options.h.
+ *
+ * The mutator pools are filled by the executors, which do not run in
+ * this process, so the mutator only draws from its built-in values unless
+ * both are given the same --mutator-pool.
+ */
+
+#include <cryptofuzz/options.h>
+#include <boost/algorithm/string.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t maxSize, unsigned int seed);
+
+const cryptofuzz::Options* cryptofuzz_options = nullptr;
+
+namespace {
+
+struct State {
+    std::vector<uint8_t> buf;
+    unsigned int seed;
+    /* xorshift64 state for the fallback byte mutator */
+    uint64_t prng;
+};
+
+State* state = nullptr;
+
+uint64_t next(void) {
+    state->prng ^= state->prng << 13;
+    state->prng ^= state->prng >> 7;
+    state->prng ^= state->prng << 17;
+    return state->prng;
+}
+
+} /* namespace */
+
+/* The custom mutator falls back to libFuzzer's mutator, which is not
+ * available here; substitute a basic byte-level mutator
+ */
+extern "C" size_t LLVMFuzzerMutate(uint8_t* data, size_t size, size_t maxSize) {
+    switch ( next() % 4 ) {
+        case    0:
+            /* Flip a bit */
+            if ( size > 0 ) {
+                data[next() % size] ^= 1 << (next() % 8);
+            }
+            break;
+        case    1:
+            /* Replace a byte */
+            if ( size > 0 ) {
+                data[next() % size] = next();
+            }
+            break;
+        case    2:
+            /* Insert a byte */
+            if ( size < maxSize ) {
+                const size_t pos = next() % (size + 1);
+                memmove(data + pos + 1, data + pos, size - pos);
+                data[pos] = next();
+                size++;
+            }
+            break;
+        case    3:
+            /* Erase a byte */
+            if ( size > 0 ) {
+                const size_t pos = next() % size;
+                memmove(data + pos, data + pos + 1, size - pos - 1);
+                size--;
+            }
+            break;
+    }
+
+    return size;
+}
+
+extern "C" void* afl_custom_init(void* afl, unsigned int seed) {
+    (void)afl;
+
+    std::vector<std::string> extraArguments;
+
+    {
+        std::string cmdline(
+#include "extra_options.h"
+        );
+
+        const char* env = getenv("CRYPTOFUZZ_MUTATOR_OPTIONS");
+        if ( env != nullptr ) {
+            cmdline += std::string(" ") + env;
+        }
+
+        boost::split(extraArguments, cmdline, boost::is_any_of(" "));
+    }
+
+    char arg0[] = "cryptofuzz-afl-mutator";
+    char* argv[] = {arg0, nullptr};
+
+    cryptofuzz_options = new cryptofuzz::Options(1, argv, extraArguments);
+
+    state = new State{{}, seed, 0x9E3779B97F4A7C15ULL ^ seed};
+
+    return state;
+}
+
+extern "C" size_t afl_custom_fuzz(
+        void* data,
+        uint8_t* buf,
+        size_t buf_size,
+        uint8_t** out_buf,
+        uint8_t* add_buf,
+        size_t add_buf_size,
+        size_t max_size) {
+    (void)add_buf;
+    (void)add_buf_size;
+
+    auto& s = *static_cast<State*>(data);
+
+    const size_t size = buf_size < max_size ? buf_size : max_size;
+
+    s.buf.resize(max_size);
+    memcpy(s.buf.data(), buf, size);
+
+    *out_buf = s.buf.data();
+
+    return LLVMFuzzerCustomMutator(s.buf.data(), size, max_size, s.seed++);
+}
+
+extern "C" void afl_custom_deinit(void* data) {
+    delete static_cast<State*>(data);
+    state = nullptr;
+}
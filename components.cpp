@@ -147,15 +147,73 @@ std::string Bignum::ToString(void) const {
     return std::string(data.GetPtr(), data.GetPtr() + data.GetSize());
 }
 
-std::string Bignum::ToTrimmedString(void) const {
-    auto s = ToString();
-    trim_left_if(s, boost::is_any_of("0"));
+bool Bignum::IsNegative(void) const {
+    return ToTrimmedString()[0] == '-';
+}
 
-    if ( s == "" ) {
-        return "0";
-    } else {
-        return s;
+const std::string& Bignum::ToTrimmedString(void) const {
+    if ( trimmed == std::nullopt ) {
+        auto s = ToString();
+        const bool negative = !s.empty() && s[0] == '-';
+
+        if ( negative ) {
+            s.erase(0, 1);
+        }
+
+        trim_left_if(s, boost::is_any_of("0"));
+
+        if ( s == "" ) {
+            trimmed = "0";
+        } else {
+            trimmed = negative ? ("-" + s) : s;
+        }
+    }
+
+    return *trimmed;
+}
+
+/* Bignums built from JSON or by modules may contain anything */
+bool Bignum::isDecimal(void) const {
+    const auto& s = ToTrimmedString();
+
+    return s.find_first_not_of("0123456789", IsNegative() ? 1 : 0) == std::string::npos;
+}
+
+std::optional<std::string> Bignum::ToHexString(void) const {
+    if ( hex == std::nullopt ) {
+        if ( isDecimal() == false ) {
+            return std::nullopt;
+        }
+
+        if ( IsNegative() ) {
+            hex = "-" + util::DecToHex(ToTrimmedString().substr(1));
+        } else {
+            hex = util::DecToHex(ToTrimmedString());
+        }
     }
+
+    return *hex;
+}
+
+std::optional<std::vector<uint8_t>> Bignum::ToBin(void) const {
+    if ( bin == std::nullopt ) {
+        if ( isDecimal() == false ) {
+            return std::nullopt;
+        }
+
+        auto v = *util::DecToBin(IsNegative() ? ToTrimmedString().substr(1) : ToTrimmedString());
+
+        /* Strip leading zero bytes */
+        size_t numZeroes = 0;
+        while ( numZeroes < v.size() && v[numZeroes] == 0 ) {
+            numZeroes++;
+        }
+        v.erase(v.begin(), v.begin() + numZeroes);
+
+        bin = std::move(v);
+    }
+
+    return *bin;
 }
 
 /* Prefix the string with a pseudo-random amount of zeroes */
@@ -361,6 +419,114 @@ void MACType::Serialize(Datasource& ds) const {
     type.Serialize(ds);
 }
 
+/* VirtualCleartext */
+
+VirtualCleartext::VirtualCleartext(Datasource& ds) :
+    seed(ds.Get<uint64_t>()),
+    size(ds.Get<uint64_t>() % (MaxSize + 1))
+{ }
+
+VirtualCleartext::VirtualCleartext(nlohmann::json json) :
+    seed(json["seed"].get<uint64_t>()),
+    size(json["size"].get<uint64_t>() % (MaxSize + 1))
+{ }
+
+uint64_t VirtualCleartext::GetSeed(void) const {
+    return seed;
+}
+
+uint64_t VirtualCleartext::GetSize(void) const {
+    return size;
+}
+
+/* SplitMix64 output function. Applying it to seed + (word index * gamma)
+ * makes every 8-byte word of the keystream computable independently. */
+static inline uint64_t virtualCleartextWord(const uint64_t seed, const uint64_t index) {
+    uint64_t x = seed + (index + 1) * 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+void VirtualCleartext::Generate(const uint64_t offset, uint8_t* out, const size_t outSize) const {
+    uint64_t index = offset / 8;
+    size_t shift = offset % 8;
+    size_t i = 0;
+
+    while ( i < outSize ) {
+        const uint64_t word = virtualCleartextWord(seed, index);
+
+        for (; shift < 8 && i < outSize; shift++, i++) {
+            out[i] = static_cast<uint8_t>(word >> (shift * 8));
+        }
+
+        shift = 0;
+        index++;
+    }
+}
+
+bool VirtualCleartext::operator==(const VirtualCleartext& rhs) const {
+    return
+        (seed == rhs.seed) &&
+        (size == rhs.size);
+}
+
+void VirtualCleartext::Serialize(Datasource& ds) const {
+    ds.Put<>(seed);
+    ds.Put<>(size);
+}
+
+nlohmann::json VirtualCleartext::ToJSON(void) const {
+    nlohmann::json j;
+    j["seed"] = seed;
+    j["size"] = size;
+    return j;
+}
+
+/* BignumInstruction */
+BignumInstruction::BignumInstruction(Datasource& ds) :
+    calcOp(ds),
+    dst(ds.Get<uint8_t>() % NumRegisters),
+    src{
+        static_cast<uint8_t>(ds.Get<uint8_t>() % NumRegisters),
+        static_cast<uint8_t>(ds.Get<uint8_t>() % NumRegisters),
+        static_cast<uint8_t>(ds.Get<uint8_t>() % NumRegisters),
+        static_cast<uint8_t>(ds.Get<uint8_t>() % NumRegisters)}
+{ }
+
+BignumInstruction::BignumInstruction(nlohmann::json json) :
+    calcOp(json["calcOp"]),
+    dst(json["dst"].get<uint8_t>() % NumRegisters),
+    src{
+        static_cast<uint8_t>(json["src"][0].get<uint8_t>() % NumRegisters),
+        static_cast<uint8_t>(json["src"][1].get<uint8_t>() % NumRegisters),
+        static_cast<uint8_t>(json["src"][2].get<uint8_t>() % NumRegisters),
+        static_cast<uint8_t>(json["src"][3].get<uint8_t>() % NumRegisters)}
+{ }
+
+bool BignumInstruction::operator==(const BignumInstruction& rhs) const {
+    return
+        (calcOp == rhs.calcOp) &&
+        (dst == rhs.dst) &&
+        (src == rhs.src);
+}
+
+void BignumInstruction::Serialize(Datasource& ds) const {
+    calcOp.Serialize(ds);
+    ds.Put<>(dst);
+    for (const auto s : src) {
+        ds.Put<>(s);
+    }
+}
+
+nlohmann::json BignumInstruction::ToJSON(void) const {
+    nlohmann::json j;
+    j["calcOp"] = calcOp.ToJSON();
+    j["dst"] = dst;
+    j["src"] = src;
+    return j;
+}
+
 } /* namespace component */
 
 } /* namespace cryptofuzz */
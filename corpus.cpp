@@ -0,0 +1,289 @@
+#include <cryptofuzz/corpus.h>
+#include <cryptofuzz/crypto.h>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cryptofuzz {
+
+namespace {
+
+const uint8_t magic[8] = {'C', 'F', 'C', 'O', 'R', 'P', 'S', '1'};
+const uint8_t trailerMagic[8] = {'C', 'F', 'C', 'I', 'D', 'X', '0', '1'};
+
+struct __attribute__((packed)) RecordHeader {
+    uint32_t size;
+    uint8_t hash[16];
+};
+
+struct Trailer {
+    uint64_t tableOffset;
+    uint64_t count;
+    uint8_t magic[8];
+};
+
+/* Reads the offset table referenced by the trailer. Returns false if
+ * the file has no (valid) trailer.
+ */
+bool readTable(const uint8_t* map, const size_t size, std::vector<uint64_t>& offsets) {
+    Trailer trailer;
+
+    if ( size < sizeof(magic) + sizeof(trailer) ) {
+        return false;
+    }
+
+    memcpy(&trailer, map + size - sizeof(trailer), sizeof(trailer));
+
+    if ( memcmp(trailer.magic, trailerMagic, sizeof(trailerMagic)) != 0 ) {
+        return false;
+    }
+    if ( trailer.tableOffset < sizeof(magic) || trailer.tableOffset > size ) {
+        return false;
+    }
+    if ( trailer.count != (size - sizeof(trailer) - trailer.tableOffset) / sizeof(uint64_t) ) {
+        return false;
+    }
+    if ( trailer.tableOffset + trailer.count * sizeof(uint64_t) + sizeof(trailer) != size ) {
+        return false;
+    }
+
+    offsets.resize(trailer.count);
+    memcpy(offsets.data(), map + trailer.tableOffset, trailer.count * sizeof(uint64_t));
+
+    for (const auto& offset : offsets) {
+        RecordHeader header;
+
+        if ( offset < sizeof(magic) || offset + sizeof(header) > trailer.tableOffset ) {
+            return false;
+        }
+        memcpy(&header, map + offset, sizeof(header));
+        if ( offset + sizeof(header) + header.size > trailer.tableOffset ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Recovers the records of a file that was not closed properly. Stops at
+ * the first record that is truncated or does not match its hash.
+ */
+void scan(const uint8_t* map, const size_t size, std::vector<uint64_t>& offsets) {
+    uint64_t pos = sizeof(magic);
+
+    offsets.clear();
+
+    while ( pos + sizeof(RecordHeader) <= size ) {
+        RecordHeader header;
+        memcpy(&header, map + pos, sizeof(header));
+
+        if ( pos + sizeof(header) + header.size > size ) {
+            break;
+        }
+
+        const auto hash = PackedCorpus::HashOf(map + pos + sizeof(header), header.size);
+        if ( memcmp(hash.data(), header.hash, hash.size()) != 0 ) {
+            break;
+        }
+
+        offsets.push_back(pos);
+        pos += sizeof(header) + header.size;
+    }
+}
+
+} /* namespace */
+
+bool PackedCorpus::Is(const std::string& path) {
+    bool ret = false;
+    uint8_t buf[sizeof(magic)];
+
+    FILE* fp = fopen(path.c_str(), "rb");
+    if ( fp == nullptr ) {
+        return false;
+    }
+
+    if ( fread(buf, sizeof(buf), 1, fp) == 1 ) {
+        ret = memcmp(buf, magic, sizeof(magic)) == 0;
+    }
+
+    fclose(fp);
+
+    return ret;
+}
+
+PackedCorpus::Hash PackedCorpus::HashOf(const uint8_t* data, const size_t size) {
+    Hash ret;
+
+    const auto sha1 = crypto::sha1(data, size);
+    memcpy(ret.data(), sha1.data(), ret.size());
+
+    return ret;
+}
+
+PackedCorpus::~PackedCorpus() {
+    if ( map != nullptr ) {
+        munmap(map, mapSize);
+    }
+}
+
+PackedCorpus* PackedCorpus::Open(const std::string& path) {
+    PackedCorpus* ret = nullptr;
+    int fd = -1;
+    struct stat st;
+    void* map = MAP_FAILED;
+
+    fd = open(path.c_str(), O_RDONLY);
+    if ( fd == -1 ) {
+        goto end;
+    }
+
+    if ( fstat(fd, &st) != 0 ) {
+        goto end;
+    }
+
+    if ( static_cast<size_t>(st.st_size) < sizeof(magic) ) {
+        goto end;
+    }
+
+    map = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if ( map == MAP_FAILED ) {
+        goto end;
+    }
+
+    if ( memcmp(map, magic, sizeof(magic)) != 0 ) {
+        munmap(map, st.st_size);
+        goto end;
+    }
+
+    ret = new PackedCorpus();
+    ret->map = map;
+    ret->mapSize = st.st_size;
+
+    if ( readTable(static_cast<const uint8_t*>(map), st.st_size, ret->offsets) == false ) {
+        scan(static_cast<const uint8_t*>(map), st.st_size, ret->offsets);
+    }
+
+end:
+    if ( fd != -1 ) {
+        close(fd);
+    }
+
+    return ret;
+}
+
+size_t PackedCorpus::Size(void) const {
+    return offsets.size();
+}
+
+std::pair<const uint8_t*, size_t> PackedCorpus::Get(const size_t i) const {
+    const uint8_t* record = static_cast<const uint8_t*>(map) + offsets.at(i);
+
+    RecordHeader header;
+    memcpy(&header, record, sizeof(header));
+
+    return {record + sizeof(header), static_cast<size_t>(header.size)};
+}
+
+PackedCorpusWriter::~PackedCorpusWriter() {
+    Trailer trailer;
+
+    trailer.tableOffset = end;
+    trailer.count = offsets.size();
+    memcpy(trailer.magic, trailerMagic, sizeof(trailerMagic));
+
+    fwrite(offsets.data(), sizeof(uint64_t), offsets.size(), fp);
+    fwrite(&trailer, sizeof(trailer), 1, fp);
+
+    fclose(fp);
+}
+
+PackedCorpusWriter* PackedCorpusWriter::Open(const std::string& path) {
+    PackedCorpusWriter* ret = nullptr;
+    FILE* fp = fopen(path.c_str(), "r+b");
+
+    if ( fp == nullptr ) {
+        fp = fopen(path.c_str(), "w+b");
+        if ( fp == nullptr ) {
+            goto end;
+        }
+
+        if ( fwrite(magic, sizeof(magic), 1, fp) != 1 ) {
+            fclose(fp);
+            goto end;
+        }
+
+        ret = new PackedCorpusWriter();
+        ret->fp = fp;
+        ret->end = sizeof(magic);
+    } else {
+        std::unique_ptr<PackedCorpus> existing(PackedCorpus::Open(path));
+        if ( existing == nullptr ) {
+            /* Not a packed corpus; do not overwrite it */
+            fclose(fp);
+            goto end;
+        }
+
+        uint64_t recordsEnd = sizeof(magic);
+        std::set<PackedCorpus::Hash> hashes;
+
+        for (const auto& offset : existing->offsets) {
+            RecordHeader header;
+            memcpy(&header, static_cast<const uint8_t*>(existing->map) + offset, sizeof(header));
+
+            PackedCorpus::Hash hash;
+            memcpy(hash.data(), header.hash, hash.size());
+            hashes.insert(hash);
+
+            recordsEnd = offset + sizeof(header) + header.size;
+        }
+
+        /* Drop the old offset table and anything after the last valid record */
+        if ( ftruncate(fileno(fp), recordsEnd) != 0 || fseek(fp, recordsEnd, SEEK_SET) != 0 ) {
+            fclose(fp);
+            goto end;
+        }
+
+        ret = new PackedCorpusWriter();
+        ret->fp = fp;
+        ret->end = recordsEnd;
+        ret->offsets = existing->offsets;
+        ret->hashes = std::move(hashes);
+    }
+
+end:
+    return ret;
+}
+
+bool PackedCorpusWriter::Add(const uint8_t* data, const size_t size) {
+    RecordHeader header;
+
+    const auto hash = PackedCorpus::HashOf(data, size);
+    if ( hashes.count(hash) != 0 ) {
+        return false;
+    }
+
+    header.size = size;
+    memcpy(header.hash, hash.data(), hash.size());
+
+    if ( fwrite(&header, sizeof(header), 1, fp) != 1 ||
+            (size != 0 && fwrite(data, size, 1, fp) != 1) ) {
+        /* Overwrite the partial record with the next one */
+        fseek(fp, end, SEEK_SET);
+        return false;
+    }
+
+    hashes.insert(hash);
+    offsets.push_back(end);
+    end += sizeof(header) + size;
+
+    return true;
+}
+
+size_t PackedCorpusWriter::Size(void) const {
+    return offsets.size();
+}
+
+} /* namespace cryptofuzz */
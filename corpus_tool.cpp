@@ -0,0 +1,115 @@
+/* Converts between libFuzzer corpus directories and packed corpora:
+ *
+ *   cryptofuzz-corpus pack <file.pack> <path>...
+ *   cryptofuzz-corpus unpack <file.pack> <directory>
+ *
+ * pack appends all files in the given files and directories (searched
+ * recursively) to the packed corpus, which is created if it does not
+ * exist. unpack writes each input to a file named after its SHA1 hash, as
+ * libFuzzer does.
+ */
+
+#include <cryptofuzz/corpus.h>
+#include <cryptofuzz/crypto.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace cryptofuzz;
+
+static std::vector<uint8_t> readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static int pack(const std::string& packPath, const std::vector<std::string>& paths) {
+    std::unique_ptr<PackedCorpusWriter> writer(PackedCorpusWriter::Open(packPath));
+    if ( writer == nullptr ) {
+        printf("Cannot open %s as a packed corpus\n", packPath.c_str());
+        return 1;
+    }
+
+    size_t added = 0, duplicates = 0;
+
+    const auto add = [&](const std::string& path) {
+        const auto data = readFile(path);
+        if ( writer->Add(data.data(), data.size()) ) {
+            added++;
+        } else {
+            duplicates++;
+        }
+    };
+
+    for (const auto& path : paths) {
+        if ( std::filesystem::is_directory(path) ) {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(path)) {
+                if ( entry.is_regular_file() ) {
+                    add(entry.path().string());
+                }
+            }
+        } else if ( std::filesystem::is_regular_file(path) ) {
+            add(path);
+        } else {
+            printf("Cannot open %s\n", path.c_str());
+            return 1;
+        }
+    }
+
+    printf("Added %zu inputs (%zu duplicates skipped), %zu inputs in %s\n",
+            added, duplicates, writer->Size(), packPath.c_str());
+
+    return 0;
+}
+
+static int unpack(const std::string& packPath, const std::string& directory) {
+    std::unique_ptr<PackedCorpus> corpus(PackedCorpus::Open(packPath));
+    if ( corpus == nullptr ) {
+        printf("Cannot open %s as a packed corpus\n", packPath.c_str());
+        return 1;
+    }
+
+    std::filesystem::create_directories(directory);
+
+    for (size_t i = 0; i < corpus->Size(); i++) {
+        const auto input = corpus->Get(i);
+
+        std::string name;
+        for (const auto& c : crypto::sha1(input.first, input.second)) {
+            char hex[3];
+            snprintf(hex, sizeof(hex), "%02x", c);
+            name += hex;
+        }
+
+        const std::string filename = directory + "/" + name;
+        FILE* fp = fopen(filename.c_str(), "wb");
+        if ( fp == nullptr ) {
+            printf("Cannot write %s\n", filename.c_str());
+            return 1;
+        }
+        fwrite(input.first, input.second, 1, fp);
+        fclose(fp);
+    }
+
+    printf("Wrote %zu inputs to %s\n", corpus->Size(), directory.c_str());
+
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const std::string command = argc > 1 ? argv[1] : "";
+
+    if ( command == "pack" && argc >= 4 ) {
+        return pack(argv[2], std::vector<std::string>(argv + 3, argv + argc));
+    } else if ( command == "unpack" && argc == 4 ) {
+        return unpack(argv[2], argv[3]);
+    }
+
+    printf("Usage: %s pack <file.pack> <path>...\n", argv[0]);
+    printf("       %s unpack <file.pack> <directory>\n", argv[0]);
+
+    return 1;
+}
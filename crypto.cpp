@@ -629,6 +629,32 @@ std::vector<uint8_t> sha256(const std::vector<uint8_t> data) {
     return sha256(data.data(), data.size());
 }
 
+sha256_stream::sha256_stream(void) :
+    md(new impl::hash_state)
+{
+    impl::sha256_init(static_cast<impl::hash_state*>(md));
+}
+
+sha256_stream::~sha256_stream() {
+    delete static_cast<impl::hash_state*>(md);
+}
+
+void sha256_stream::update(const uint8_t* data, const size_t size) {
+    if ( size == 0 ) {
+        return;
+    }
+
+    impl::sha256_process(static_cast<impl::hash_state*>(md), data, size);
+}
+
+std::vector<uint8_t> sha256_stream::finalize(void) {
+    uint8_t out[32];
+
+    impl::sha256_done(static_cast<impl::hash_state*>(md), out);
+
+    return std::vector<uint8_t>(out, out + sizeof(out));
+}
+
 std::vector<uint8_t> hmac_sha256(const uint8_t* data, const size_t size, const uint8_t* key, const size_t key_size) {
     uint8_t _key[64];
     uint8_t out[32];
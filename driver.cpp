@@ -2,6 +2,8 @@
 #include <fuzzing/datasource/id.hpp>
 #include "tests.h"
 #include "executor.h"
+#include <cryptofuzz/plugin.h>
+#include <cryptofuzz/remote.h>
 #include <cryptofuzz/util.h>
 #include <set>
 #include <algorithm>
@@ -13,6 +15,27 @@ void Driver::LoadModule(std::shared_ptr<Module> module) {
     modules[module->ID] = module;
 }
 
+void Driver::LoadPlugin(const std::string& path) {
+    for (const auto& module : plugin::Load(path, modules)) {
+        LoadModule(module);
+    }
+}
+
+void Driver::LoadRemoteModules(const std::string& path) {
+    for (const auto& module : remote::Spawn(path)) {
+        /* Prefer the in-process instance of a module */
+        if ( modules.find(module->ID) != modules.end() ) {
+            continue;
+        }
+
+        LoadModule(module);
+    }
+}
+
+void Driver::RunHost(const int fd) const {
+    remote::Serve(fd, modules);
+}
+
 void Driver::Run(const uint8_t* data, const size_t size) const {
     using fuzzing::datasource::ID;
 
@@ -39,9 +62,18 @@ void Driver::Run(const uint8_t* data, const size_t size) const {
     static ExecutorECDSA_Verify executorECDSA_Verify(CF_OPERATION("ECDSA_Verify"), modules, options);
     static ExecutorECDH_Derive executorECDH_Derive(CF_OPERATION("ECDH_Derive"), modules, options);
     static ExecutorECIES_Encrypt executorECIES_Encrypt(CF_OPERATION("ECIES_Encrypt"), modules, options);
+    static ExecutorECC_Point_Add executorECC_Point_Add(CF_OPERATION("ECC_Point_Add"), modules, options);
+    static ExecutorECC_Point_Mul executorECC_Point_Mul(CF_OPERATION("ECC_Point_Mul"), modules, options);
+    static ExecutorECC_Point_Dbl executorECC_Point_Dbl(CF_OPERATION("ECC_Point_Dbl"), modules, options);
+    static ExecutorECC_MultiScalarMul executorECC_MultiScalarMul(CF_OPERATION("ECC_MultiScalarMul"), modules, options);
     static ExecutorDH_GenerateKeyPair executorDH_GenerateKeyPair(CF_OPERATION("DH_GenerateKeyPair"), modules, options);
     static ExecutorDH_Derive executorDH_Derive(CF_OPERATION("DH_Derive"), modules, options);
     static ExecutorBignumCalc executorBignumCalc(CF_OPERATION("BignumCalc"), modules, options);
+    static ExecutorBignumCalcLarge executorBignumCalcLarge(CF_OPERATION("BignumCalcLarge"), modules, options);
+    static ExecutorBignumCalcSequence executorBignumCalcSequence(CF_OPERATION("BignumCalcSequence"), modules, options);
+    static ExecutorDigestStream executorDigestStream(CF_OPERATION("DigestStream"), modules, options);
+    static ExecutorHMACStream executorHMACStream(CF_OPERATION("HMACStream"), modules, options);
+    static ExecutorSymmetricEncryptStream executorSymmetricEncryptStream(CF_OPERATION("SymmetricEncryptStream"), modules, options);
 
     try {
 
@@ -138,6 +170,18 @@ void Driver::Run(const uint8_t* data, const size_t size) const {
             case CF_OPERATION("ECIES_Encrypt"):
                 executorECIES_Encrypt.Run(ds, payload.data(), payload.size());
                 break;
+            case CF_OPERATION("ECC_Point_Add"):
+                executorECC_Point_Add.Run(ds, payload.data(), payload.size());
+                break;
+            case CF_OPERATION("ECC_Point_Mul"):
+                executorECC_Point_Mul.Run(ds, payload.data(), payload.size());
+                break;
+            case CF_OPERATION("ECC_Point_Dbl"):
+                executorECC_Point_Dbl.Run(ds, payload.data(), payload.size());
+                break;
+            case CF_OPERATION("ECC_MultiScalarMul"):
+                executorECC_MultiScalarMul.Run(ds, payload.data(), payload.size());
+                break;
             case CF_OPERATION("DH_GenerateKeyPair"):
                 executorDH_GenerateKeyPair.Run(ds, payload.data(), payload.size());
                 break;
@@ -147,6 +191,21 @@ void Driver::Run(const uint8_t* data, const size_t size) const {
             case CF_OPERATION("BignumCalc"):
                 executorBignumCalc.Run(ds, payload.data(), payload.size());
                 break;
+            case CF_OPERATION("BignumCalcLarge"):
+                executorBignumCalcLarge.Run(ds, payload.data(), payload.size());
+                break;
+            case CF_OPERATION("BignumCalcSequence"):
+                executorBignumCalcSequence.Run(ds, payload.data(), payload.size());
+                break;
+            case CF_OPERATION("DigestStream"):
+                executorDigestStream.Run(ds, payload.data(), payload.size());
+                break;
+            case CF_OPERATION("HMACStream"):
+                executorHMACStream.Run(ds, payload.data(), payload.size());
+                break;
+            case CF_OPERATION("SymmetricEncryptStream"):
+                executorSymmetricEncryptStream.Run(ds, payload.data(), payload.size());
+                break;
         }
     } catch ( Datasource::OutOfData ) {
     }
@@ -7,6 +7,7 @@
 #include <cryptofuzz/options.h>
 #include <memory>
 #include <map>
+#include <string>
 #include <vector>
 #include <utility>
 
@@ -18,6 +19,12 @@ class Driver {
         Options options;
     public:
         void LoadModule(std::shared_ptr<Module> module);
+        /* Loads the modules exported by a shared object */
+        void LoadPlugin(const std::string& path);
+        /* Loads the modules of another cryptofuzz binary, running in a child process */
+        void LoadRemoteModules(const std::string& path);
+        /* Serves the loaded modules to a parent process; does not return */
+        [[noreturn]] void RunHost(const int fd) const;
         void Run(const uint8_t* data, const size_t size) const;
         Driver(const Options options);
         const Options* GetOptionsPtr(void) const;
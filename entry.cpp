@@ -313,6 +313,22 @@ extern "C" int LLVMFuzzerInitialize(int *argc, char ***argv) {
     driver->LoadModule( std::make_shared<cryptofuzz::module::micro_ecc>() );
 #endif
 
+    if ( options.loadModules != std::nullopt ) {
+        for (const auto& path : *options.loadModules) {
+            driver->LoadPlugin(path);
+        }
+    }
+
+    if ( options.hostFD != std::nullopt ) {
+        driver->RunHost(*options.hostFD);
+    }
+
+    if ( options.remoteModules != std::nullopt ) {
+        for (const auto& path : *options.remoteModules) {
+            driver->LoadRemoteModules(path);
+        }
+    }
+
     /* TODO check if options.forceModule (if set) refers to a module that is
      * actually loaded, warn otherwise.
      */
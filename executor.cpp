@@ -1,6 +1,10 @@
 #include "executor.h"
 #include "tests.h"
 #include "mutatorpool.h"
+#include <cryptofuzz/crypto.h>
+#include <cryptofuzz/remote.h>
+#include <cryptofuzz/resultdb.h>
+#include <cryptofuzz/rng.h>
 #include <cryptofuzz/util.h>
 #include <fuzzing/memory.hpp>
 #include <algorithm>
@@ -220,6 +224,108 @@ template<> std::optional<component::Ciphertext> ExecutorBase<component::Cipherte
     return module->OpSymmetricEncrypt(op);
 }
 
+/* Specialization for operation::DigestStream */
+template<> void ExecutorBase<component::Digest, operation::DigestStream>::updateExtraCounters(const uint64_t moduleID, operation::DigestStream& op) const {
+    using fuzzing::datasource::ID;
+    updateExtraCounters(moduleID, operationID, op.cleartext.GetSize(), op.digestType.Get());
+}
+
+template<> void ExecutorBase<component::Digest, operation::DigestStream>::postprocess(std::shared_ptr<Module> module, operation::DigestStream& op, const ExecutorBase<component::Digest, operation::DigestStream>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt ) {
+        fuzzing::memory::memory_test_msan(result.second->GetPtr(), result.second->GetSize());
+    }
+}
+
+template<> std::optional<component::Digest> ExecutorBase<component::Digest, operation::DigestStream>::callModule(std::shared_ptr<Module> module, operation::DigestStream& op) const {
+    /* Only run whitelisted digests, if specified */
+    if ( options.digests != std::nullopt ) {
+        if ( std::find(
+                    options.digests->begin(),
+                    options.digests->end(),
+                    op.digestType.Get()) == options.digests->end() ) {
+            return std::nullopt;
+        }
+    }
+
+    if ( op.cleartext.GetSize() > options.maxStreamSize ) {
+        return std::nullopt;
+    }
+
+    return module->OpDigestStream(op);
+}
+
+/* Specialization for operation::HMACStream */
+template<> void ExecutorBase<component::MAC, operation::HMACStream>::updateExtraCounters(const uint64_t moduleID, operation::HMACStream& op) const {
+    using fuzzing::datasource::ID;
+    updateExtraCounters(moduleID, operationID, op.cleartext.GetSize(), op.digestType.Get(), op.cipher.cipherType.Get());
+}
+
+template<> void ExecutorBase<component::MAC, operation::HMACStream>::postprocess(std::shared_ptr<Module> module, operation::HMACStream& op, const ExecutorBase<component::MAC, operation::HMACStream>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt ) {
+        fuzzing::memory::memory_test_msan(result.second->GetPtr(), result.second->GetSize());
+    }
+}
+
+template<> std::optional<component::MAC> ExecutorBase<component::MAC, operation::HMACStream>::callModule(std::shared_ptr<Module> module, operation::HMACStream& op) const {
+    /* Only run whitelisted digests, if specified */
+    if ( options.digests != std::nullopt ) {
+        if ( std::find(
+                    options.digests->begin(),
+                    options.digests->end(),
+                    op.digestType.Get()) == options.digests->end() ) {
+            return std::nullopt;
+        }
+    }
+
+    if ( op.cleartext.GetSize() > options.maxStreamSize ) {
+        return std::nullopt;
+    }
+
+    return module->OpHMACStream(op);
+}
+
+/* Specialization for operation::SymmetricEncryptStream */
+template<> void ExecutorBase<component::Ciphertext, operation::SymmetricEncryptStream>::updateExtraCounters(const uint64_t moduleID, operation::SymmetricEncryptStream& op) const {
+    using fuzzing::datasource::ID;
+    updateExtraCounters(moduleID, operationID, op.cleartext.GetSize(), op.cipher.cipherType.Get(), op.cipher.iv.Get().size());
+}
+
+template<> void ExecutorBase<component::Ciphertext, operation::SymmetricEncryptStream>::postprocess(std::shared_ptr<Module> module, operation::SymmetricEncryptStream& op, const ExecutorBase<component::Ciphertext, operation::SymmetricEncryptStream>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt ) {
+        fuzzing::memory::memory_test_msan(result.second->ciphertext.GetPtr(), result.second->ciphertext.GetSize());
+        if ( result.second->tag != std::nullopt ) {
+            fuzzing::memory::memory_test_msan(result.second->tag->GetPtr(), result.second->tag->GetSize());
+        }
+    }
+}
+
+template<> std::optional<component::Ciphertext> ExecutorBase<component::Ciphertext, operation::SymmetricEncryptStream>::callModule(std::shared_ptr<Module> module, operation::SymmetricEncryptStream& op) const {
+    /* Only run whitelisted ciphers, if specified */
+    if ( options.ciphers != std::nullopt ) {
+        if ( std::find(
+                    options.ciphers->begin(),
+                    options.ciphers->end(),
+                    op.cipher.cipherType.Get()) == options.ciphers->end() ) {
+            return std::nullopt;
+        }
+    }
+
+    if ( op.cleartext.GetSize() > options.maxStreamSize ) {
+        return std::nullopt;
+    }
+
+    return module->OpSymmetricEncryptStream(op);
+}
+
 /* Specialization for operation::SymmetricDecrypt */
 template<> void ExecutorBase<component::MAC, operation::SymmetricDecrypt>::updateExtraCounters(const uint64_t moduleID, operation::SymmetricDecrypt& op) const {
     using fuzzing::datasource::ID;
@@ -695,17 +801,150 @@ template<> std::optional<bool> ExecutorBase<bool, operation::ECC_ValidatePubkey>
     return module->OpECC_ValidatePubkey(op);
 }
 
-/* Specialization for operation::ECC_GenerateKeyPair */
+/* Specialization for operation::ECC_Point_Add */
+template<> void ExecutorBase<component::ECC_Point, operation::ECC_Point_Add>::updateExtraCounters(const uint64_t moduleID, operation::ECC_Point_Add& op) const {
+    using fuzzing::datasource::ID;
+    updateExtraCounters(moduleID, operationID, op.curveType.Get());
+}
 
-/* Do not compare DH_GenerateKeyPair results, because the result can be produced indeterministically */
-template <>
-void ExecutorBase<component::DH_KeyPair, operation::DH_GenerateKeyPair>::compare(const std::vector< std::pair<std::shared_ptr<Module>, operation::DH_GenerateKeyPair> >& operations, const ResultSet& results, const uint8_t* data, const size_t size) const {
-    (void)operations;
-    (void)results;
-    (void)data;
-    (void)size;
+template<> void ExecutorBase<component::ECC_Point, operation::ECC_Point_Add>::postprocess(std::shared_ptr<Module> module, operation::ECC_Point_Add& op, const ExecutorBase<component::ECC_Point, operation::ECC_Point_Add>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt  ) {
+        const auto x = result.second->first.ToTrimmedString();
+        const auto y = result.second->second.ToTrimmedString();
+
+        if ( x.size() <= 1000 ) { Pool_Bignum.Set(x); }
+        if ( y.size() <= 1000 ) { Pool_Bignum.Set(y); }
+    }
+}
+
+template<> std::optional<component::ECC_Point> ExecutorBase<component::ECC_Point, operation::ECC_Point_Add>::callModule(std::shared_ptr<Module> module, operation::ECC_Point_Add& op) const {
+    /* Only run whitelisted curves, if specified */
+    if ( options.curves != std::nullopt ) {
+        if ( std::find(
+                    options.curves->begin(),
+                    options.curves->end(),
+                    op.curveType.Get()) == options.curves->end() ) {
+            return std::nullopt;
+        }
+    }
+
+    return module->OpECC_Point_Add(op);
+}
+
+/* Specialization for operation::ECC_Point_Mul */
+template<> void ExecutorBase<component::ECC_Point, operation::ECC_Point_Mul>::updateExtraCounters(const uint64_t moduleID, operation::ECC_Point_Mul& op) const {
+    using fuzzing::datasource::ID;
+    updateExtraCounters(moduleID, operationID, op.curveType.Get(), op.b.GetSize());
+}
+
+template<> void ExecutorBase<component::ECC_Point, operation::ECC_Point_Mul>::postprocess(std::shared_ptr<Module> module, operation::ECC_Point_Mul& op, const ExecutorBase<component::ECC_Point, operation::ECC_Point_Mul>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt  ) {
+        const auto x = result.second->first.ToTrimmedString();
+        const auto y = result.second->second.ToTrimmedString();
+
+        if ( x.size() <= 1000 ) { Pool_Bignum.Set(x); }
+        if ( y.size() <= 1000 ) { Pool_Bignum.Set(y); }
+    }
 }
 
+template<> std::optional<component::ECC_Point> ExecutorBase<component::ECC_Point, operation::ECC_Point_Mul>::callModule(std::shared_ptr<Module> module, operation::ECC_Point_Mul& op) const {
+    /* Only run whitelisted curves, if specified */
+    if ( options.curves != std::nullopt ) {
+        if ( std::find(
+                    options.curves->begin(),
+                    options.curves->end(),
+                    op.curveType.Get()) == options.curves->end() ) {
+            return std::nullopt;
+        }
+    }
+
+    if ( op.b.ToTrimmedString().size() > 4096 ) {
+        return std::nullopt;
+    }
+
+    return module->OpECC_Point_Mul(op);
+}
+
+/* Specialization for operation::ECC_Point_Dbl */
+template<> void ExecutorBase<component::ECC_Point, operation::ECC_Point_Dbl>::updateExtraCounters(const uint64_t moduleID, operation::ECC_Point_Dbl& op) const {
+    using fuzzing::datasource::ID;
+    updateExtraCounters(moduleID, operationID, op.curveType.Get());
+}
+
+template<> void ExecutorBase<component::ECC_Point, operation::ECC_Point_Dbl>::postprocess(std::shared_ptr<Module> module, operation::ECC_Point_Dbl& op, const ExecutorBase<component::ECC_Point, operation::ECC_Point_Dbl>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt  ) {
+        const auto x = result.second->first.ToTrimmedString();
+        const auto y = result.second->second.ToTrimmedString();
+
+        if ( x.size() <= 1000 ) { Pool_Bignum.Set(x); }
+        if ( y.size() <= 1000 ) { Pool_Bignum.Set(y); }
+    }
+}
+
+template<> std::optional<component::ECC_Point> ExecutorBase<component::ECC_Point, operation::ECC_Point_Dbl>::callModule(std::shared_ptr<Module> module, operation::ECC_Point_Dbl& op) const {
+    /* Only run whitelisted curves, if specified */
+    if ( options.curves != std::nullopt ) {
+        if ( std::find(
+                    options.curves->begin(),
+                    options.curves->end(),
+                    op.curveType.Get()) == options.curves->end() ) {
+            return std::nullopt;
+        }
+    }
+
+    return module->OpECC_Point_Dbl(op);
+}
+
+/* Specialization for operation::ECC_MultiScalarMul */
+template<> void ExecutorBase<component::ECC_Point, operation::ECC_MultiScalarMul>::updateExtraCounters(const uint64_t moduleID, operation::ECC_MultiScalarMul& op) const {
+    using fuzzing::datasource::ID;
+    updateExtraCounters(moduleID, operationID, op.curveType.Get(), op.points.size());
+}
+
+template<> void ExecutorBase<component::ECC_Point, operation::ECC_MultiScalarMul>::postprocess(std::shared_ptr<Module> module, operation::ECC_MultiScalarMul& op, const ExecutorBase<component::ECC_Point, operation::ECC_MultiScalarMul>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt  ) {
+        const auto x = result.second->first.ToTrimmedString();
+        const auto y = result.second->second.ToTrimmedString();
+
+        if ( x.size() <= 1000 ) { Pool_Bignum.Set(x); }
+        if ( y.size() <= 1000 ) { Pool_Bignum.Set(y); }
+    }
+}
+
+template<> std::optional<component::ECC_Point> ExecutorBase<component::ECC_Point, operation::ECC_MultiScalarMul>::callModule(std::shared_ptr<Module> module, operation::ECC_MultiScalarMul& op) const {
+    /* Only run whitelisted curves, if specified */
+    if ( options.curves != std::nullopt ) {
+        if ( std::find(
+                    options.curves->begin(),
+                    options.curves->end(),
+                    op.curveType.Get()) == options.curves->end() ) {
+            return std::nullopt;
+        }
+    }
+
+    for (const auto& scalar : op.scalars) {
+        if ( scalar.ToTrimmedString().size() > 4096 ) {
+            return std::nullopt;
+        }
+    }
+
+    return module->OpECC_MultiScalarMul(op);
+}
+
+/* Specialization for operation::ECC_GenerateKeyPair */
+
 template<> void ExecutorBase<component::ECC_KeyPair, operation::ECC_GenerateKeyPair>::updateExtraCounters(const uint64_t moduleID, operation::ECC_GenerateKeyPair& op) const {
     (void)moduleID;
     (void)op;
@@ -811,7 +1050,8 @@ template<> void ExecutorBase<bool, operation::ECDSA_Verify>::postprocess(std::sh
     (void)result;
 }
 
-template<> std::optional<bool> ExecutorBase<bool, operation::ECDSA_Verify>::callModule(std::shared_ptr<Module> module, operation::ECDSA_Verify& op) const {
+/* Also used to verify randomized ECDSA_Sign results */
+static std::optional<bool> callECDSA_Verify(const Options& options, std::shared_ptr<Module> module, operation::ECDSA_Verify& op) {
     /* Only run whitelisted curves, if specified */
     if ( options.curves != std::nullopt ) {
         if ( std::find(
@@ -845,6 +1085,10 @@ template<> std::optional<bool> ExecutorBase<bool, operation::ECDSA_Verify>::call
     return module->OpECDSA_Verify(op);
 }
 
+template<> std::optional<bool> ExecutorBase<bool, operation::ECDSA_Verify>::callModule(std::shared_ptr<Module> module, operation::ECDSA_Verify& op) const {
+    return callECDSA_Verify(options, module, op);
+}
+
 /* Specialization for operation::ECDH_Derive */
 template<> void ExecutorBase<component::Secret, operation::ECDH_Derive>::updateExtraCounters(const uint64_t moduleID, operation::ECDH_Derive& op) const {
     (void)moduleID;
@@ -1016,6 +1260,137 @@ template<> std::optional<component::Bignum> ExecutorBase<component::Bignum, oper
     return module->OpBignumCalc(op);
 }
 
+/* Specialization for operation::BignumCalcLarge */
+template<> void ExecutorBase<component::LargeBignum, operation::BignumCalcLarge>::updateExtraCounters(const uint64_t moduleID, operation::BignumCalcLarge& op) const {
+    using fuzzing::datasource::ID;
+    updateExtraCounters(moduleID, operationID, op.calcOp.Get(), op.bn0.GetSize() / 512, op.bn1.GetSize() / 512);
+}
+
+template<> void ExecutorBase<component::LargeBignum, operation::BignumCalcLarge>::postprocess(std::shared_ptr<Module> module, operation::BignumCalcLarge& op, const ExecutorBase<component::LargeBignum, operation::BignumCalcLarge>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt ) {
+        fuzzing::memory::memory_test_msan(result.second->GetPtr(), result.second->GetSize());
+    }
+}
+
+/* An upper bound of the work done by a schoolbook implementation, in
+ * products of 64 bit limbs. It depends only on the operands, so that whether
+ * an input is run does not depend on the inputs run before it.
+ */
+static uint64_t largeBignumCost(const operation::BignumCalcLarge& op) {
+    const uint64_t A = (op.bn0.GetSize() + 7) / 8;
+    const uint64_t B = (op.bn1.GetSize() + 7) / 8;
+    const uint64_t C = (op.bn2.GetSize() + 7) / 8;
+
+    switch ( op.calcOp.Get() ) {
+        case    CF_CALCOP("Mul(A,B)"):
+        case    CF_CALCOP("Div(A,B)"):
+        case    CF_CALCOP("Mod(A,B)"):
+            return A * B;
+        case    CF_CALCOP("Sqr(A)"):
+            return A * A;
+        case    CF_CALCOP("GCD(A,B)"):
+            /* One subtraction or division step per bit */
+            return std::max(A, B) * std::max(A, B) * 64;
+        case    CF_CALCOP("MulMod(A,B,C)"):
+            return A * B + (A + B) * C;
+        default:
+            return 0;
+    }
+}
+
+template<> std::optional<component::LargeBignum> ExecutorBase<component::LargeBignum, operation::BignumCalcLarge>::callModule(std::shared_ptr<Module> module, operation::BignumCalcLarge& op) const {
+    /* Only run whitelisted calcops, if specified */
+    if ( options.calcOps != std::nullopt ) {
+        if ( std::find(
+                    options.calcOps->begin(),
+                    options.calcOps->end(),
+                    op.calcOp.Get()) == options.calcOps->end() ) {
+            return std::nullopt;
+        }
+    }
+
+    switch ( op.calcOp.Get() ) {
+        case    CF_CALCOP("Mul(A,B)"):
+        case    CF_CALCOP("Sqr(A)"):
+        case    CF_CALCOP("Div(A,B)"):
+        case    CF_CALCOP("Mod(A,B)"):
+        case    CF_CALCOP("GCD(A,B)"):
+        case    CF_CALCOP("MulMod(A,B,C)"):
+            break;
+        default:
+            return std::nullopt;
+    }
+
+    const size_t maxSize = options.maxLargeBignumBits / 8;
+    if ( op.bn0.GetSize() > maxSize ) return std::nullopt;
+    if ( op.bn1.GetSize() > maxSize ) return std::nullopt;
+    if ( op.bn2.GetSize() > maxSize ) return std::nullopt;
+
+    if ( largeBignumCost(op) > options.maxLargeBignumCost ) {
+        return std::nullopt;
+    }
+
+    return module->OpBignumCalcLarge(op);
+}
+
+/* Specialization for operation::BignumCalcSequence */
+template<> void ExecutorBase<component::BignumTrace, operation::BignumCalcSequence>::updateExtraCounters(const uint64_t moduleID, operation::BignumCalcSequence& op) const {
+    using fuzzing::datasource::ID;
+    updateExtraCounters(moduleID, operationID, op.program.size());
+}
+
+template<> void ExecutorBase<component::BignumTrace, operation::BignumCalcSequence>::postprocess(std::shared_ptr<Module> module, operation::BignumCalcSequence& op, const ExecutorBase<component::BignumTrace, operation::BignumCalcSequence>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt  ) {
+        for (const auto& v : *result.second) {
+            const auto bignum = v.ToTrimmedString();
+
+            if ( bignum.size() <= 1000 ) {
+                Pool_Bignum.Set(bignum);
+            }
+        }
+    }
+}
+
+template<> std::optional<component::BignumTrace> ExecutorBase<component::BignumTrace, operation::BignumCalcSequence>::callModule(std::shared_ptr<Module> module, operation::BignumCalcSequence& op) const {
+    for (const auto& instr : op.program) {
+        /* Only run whitelisted calcops, if specified */
+        if ( options.calcOps != std::nullopt ) {
+            if ( std::find(
+                        options.calcOps->begin(),
+                        options.calcOps->end(),
+                        instr.calcOp.Get()) == options.calcOps->end() ) {
+                return std::nullopt;
+            }
+        }
+
+        /* Registers are fed back into later instructions, so operations
+         * whose cost or result size depends on the operand value could
+         * grow without bound over the course of a program.
+         */
+        switch ( instr.calcOp.Get() ) {
+            case    CF_CALCOP("Rand()"):
+            case    CF_CALCOP("SetBit(A,B)"):
+            case    CF_CALCOP("Exp(A,B)"):
+            case    CF_CALCOP("ModLShift(A,B,C)"):
+            case    CF_CALCOP("Exp2(A)"):
+                return std::nullopt;
+        }
+    }
+
+    /* Prevent timeouts */
+    for (const auto& r : op.registers) {
+        if ( r.GetSize() > 1000 ) return std::nullopt;
+    }
+
+    return module->OpBignumCalcSequence(op);
+}
+
 template <class ResultType, class OperationType>
 ExecutorBase<ResultType, OperationType>::ExecutorBase(const uint64_t operationID, const std::map<uint64_t, std::shared_ptr<Module> >& modules, const Options& options) :
     operationID(operationID),
@@ -1044,36 +1419,35 @@ typename ExecutorBase<ResultType, OperationType>::ResultSet ExecutorBase<ResultT
     return ret;
 }
 
-/* Do not compare ECC_GenerateKeyPair results, because the result can be produced indeterministically */
-template <>
-void ExecutorBase<component::ECC_KeyPair, operation::ECC_GenerateKeyPair>::compare(const std::vector< std::pair<std::shared_ptr<Module>, operation::ECC_GenerateKeyPair> >& operations, const ResultSet& results, const uint8_t* data, const size_t size) const {
-    (void)operations;
-    (void)results;
-    (void)data;
-    (void)size;
-}
-
 template <class ResultType, class OperationType>
-bool ExecutorBase<ResultType, OperationType>::dontCompare(const OperationType& operation) const {
+bool ExecutorBase<ResultType, OperationType>::isRandomized(const OperationType& operation) const {
     (void)operation;
 
     return false;
 }
 
+/* Key generation consumes randomness */
 template <>
-bool ExecutorBase<component::Bignum, operation::BignumCalc>::dontCompare(const operation::BignumCalc& operation) const {
-    if ( operation.calcOp.Get() == CF_CALCOP("Rand()") ) { return true; }
+bool ExecutorBase<component::ECC_KeyPair, operation::ECC_GenerateKeyPair>::isRandomized(const operation::ECC_GenerateKeyPair& operation) const {
+    (void)operation;
 
-    return false;
+    return true;
+}
+
+template <>
+bool ExecutorBase<component::DH_KeyPair, operation::DH_GenerateKeyPair>::isRandomized(const operation::DH_GenerateKeyPair& operation) const {
+    (void)operation;
+
+    return true;
 }
 
 template <>
-bool ExecutorBase<component::ECDSA_Signature, operation::ECDSA_Sign>::dontCompare(const operation::ECDSA_Sign& operation) const {
+bool ExecutorBase<component::ECDSA_Signature, operation::ECDSA_Sign>::isRandomized(const operation::ECDSA_Sign& operation) const {
+    /* EdDSA signatures are deterministic */
     if (
             operation.curveType.Get() != CF_ECC_CURVE("ed25519") &&
             operation.curveType.Get() != CF_ECC_CURVE("ed448") ) {
         if ( operation.UseRandomNonce() ) {
-            /* Don't compare ECDSA signatures comptued from a randomly generated nonce */
             return true;
         }
     }
@@ -1081,6 +1455,20 @@ bool ExecutorBase<component::ECDSA_Signature, operation::ECDSA_Sign>::dontCompar
     return false;
 }
 
+template <class ResultType, class OperationType>
+bool ExecutorBase<ResultType, OperationType>::dontCompare(const OperationType& operation) const {
+    (void)operation;
+
+    return false;
+}
+
+template <>
+bool ExecutorBase<component::Bignum, operation::BignumCalc>::dontCompare(const operation::BignumCalc& operation) const {
+    if ( operation.calcOp.Get() == CF_CALCOP("Rand()") ) { return true; }
+
+    return false;
+}
+
 /* OpenSSL DES_EDE3_WRAP randomizes the IV, result is different each time */
 template <>
 bool ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>::dontCompare(const operation::SymmetricEncrypt& operation) const {
@@ -1089,6 +1477,13 @@ bool ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>::dontCompa
     return false;
 }
 
+template <>
+bool ExecutorBase<component::Ciphertext, operation::SymmetricEncryptStream>::dontCompare(const operation::SymmetricEncryptStream& operation) const {
+    if ( operation.cipher.cipherType.Get() == CF_CIPHER("DES_EDE3_WRAP") ) { return true; }
+
+    return false;
+}
+
 template <>
 bool ExecutorBase<component::Cleartext, operation::SymmetricDecrypt>::dontCompare(const operation::SymmetricDecrypt& operation) const {
     if ( operation.cipher.cipherType.Get() == CF_CIPHER("DES_EDE3_WRAP") ) return true;
@@ -1110,6 +1505,287 @@ bool ExecutorBase<component::MAC, operation::HMAC>::dontCompare(const operation:
     return false;
 }
 
+/* SHA-256 of the module ID and the operation, including the modifier */
+template <class ResultType, class OperationType>
+std::vector<uint8_t> ExecutorBase<ResultType, OperationType>::getOperationHash(std::shared_ptr<Module> module, const OperationType& op) const {
+    const auto serialized = op.ToJSON().dump();
+    std::vector<uint8_t> input(serialized.begin(), serialized.end());
+
+    for (size_t i = 0; i < 8; i++) {
+        input.push_back(static_cast<uint8_t>(module->ID >> (i * 8)));
+    }
+
+    return crypto::sha256(input);
+}
+
+template <class ResultType, class OperationType>
+void ExecutorBase<ResultType, OperationType>::checkResultDB(std::shared_ptr<Module> module, const OperationType& op, const std::optional<ResultType>& result) const {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    if ( options.recordResults == std::nullopt && options.replayResults == std::nullopt ) {
+        return;
+    }
+
+    /* Only results which are compared across modules are reproducible */
+    if ( dontCompare(op) == true ) {
+        return;
+    }
+    if ( isRandomized(op) == true && options.deterministicRNG == false ) {
+        return;
+    }
+
+    ResultDB::Key key;
+    ResultDB::Fingerprint fingerprint;
+    {
+        const auto hash = getOperationHash(module, op);
+        memcpy(key.data(), hash.data(), key.size());
+
+        const auto serialized = util::ToJSON(*result).dump();
+        const auto resultHash = crypto::sha256(reinterpret_cast<const uint8_t*>(serialized.data()), serialized.size());
+        memcpy(fingerprint.data(), resultHash.data(), fingerprint.size());
+    }
+
+    if ( options.recordResults != std::nullopt ) {
+        if ( (*options.recordResults)->Put(key, fingerprint) == false ) {
+            static bool warned = false;
+            if ( warned == false ) {
+                printf("Result database is full\n");
+                warned = true;
+            }
+        }
+    }
+
+    if ( options.replayResults != std::nullopt ) {
+        const auto expected = (*options.replayResults)->Get(key);
+
+        if ( expected != std::nullopt && *expected != fingerprint ) {
+            printf("Result differs from the recorded result\n\n");
+            printf("Operation:\n%s\n", op.ToString().c_str());
+            printf("Module %s result:\n\n%s\n\n", module->name.c_str(), util::ToString(*result).c_str());
+
+            abort({module->name}, op.Name(), op.GetAlgorithmString(), "regression");
+        }
+    }
+}
+
+template <class ResultType, class OperationType>
+bool ExecutorBase<ResultType, OperationType>::isCacheable(const OperationType& operation) const {
+    (void)operation;
+
+    return false;
+}
+
+/* Expensive operations whose results only depend on the input */
+template <>
+bool ExecutorBase<component::Key, operation::KDF_SCRYPT>::isCacheable(const operation::KDF_SCRYPT& operation) const {
+    (void)operation;
+
+    return true;
+}
+
+template <>
+bool ExecutorBase<component::Key, operation::KDF_PBKDF>::isCacheable(const operation::KDF_PBKDF& operation) const {
+    (void)operation;
+
+    return true;
+}
+
+template <>
+bool ExecutorBase<component::Key, operation::KDF_PBKDF1>::isCacheable(const operation::KDF_PBKDF1& operation) const {
+    (void)operation;
+
+    return true;
+}
+
+template <>
+bool ExecutorBase<component::Key, operation::KDF_PBKDF2>::isCacheable(const operation::KDF_PBKDF2& operation) const {
+    (void)operation;
+
+    return true;
+}
+
+template <>
+bool ExecutorBase<component::Key, operation::KDF_ARGON2>::isCacheable(const operation::KDF_ARGON2& operation) const {
+    (void)operation;
+
+    return true;
+}
+
+template <>
+bool ExecutorBase<component::Key, operation::KDF_BCRYPT>::isCacheable(const operation::KDF_BCRYPT& operation) const {
+    (void)operation;
+
+    return true;
+}
+
+template <>
+bool ExecutorBase<component::Bignum, operation::BignumCalc>::isCacheable(const operation::BignumCalc& operation) const {
+    return operation.calcOp.Get() != CF_CALCOP("Rand()");
+}
+
+template <>
+bool ExecutorBase<component::LargeBignum, operation::BignumCalcLarge>::isCacheable(const operation::BignumCalcLarge& operation) const {
+    (void)operation;
+
+    return true;
+}
+
+template <>
+bool ExecutorBase<component::Digest, operation::DigestStream>::isCacheable(const operation::DigestStream& operation) const {
+    (void)operation;
+
+    return true;
+}
+
+template <>
+bool ExecutorBase<component::MAC, operation::HMACStream>::isCacheable(const operation::HMACStream& operation) const {
+    (void)operation;
+
+    return true;
+}
+
+/* Stands in for a module to find out whether callModule() passes an
+ * operation on to it. It has the name, and thereby the ID, of the module
+ * it stands in for, since callModule() may depend on either.
+ */
+class ProbeModule : public Module {
+    public:
+        bool reached = false;
+
+        ProbeModule(const std::string name) :
+            Module(name) { }
+
+#define CF_PROBE_DEFINE(ResultType, Name) \
+        std::optional<ResultType> Op##Name(operation::Name& op) override { \
+            (void)op; \
+            reached = true; \
+            return std::nullopt; \
+        }
+        CF_REMOTE_OPERATIONS(CF_PROBE_DEFINE)
+#undef CF_PROBE_DEFINE
+};
+
+template <class ResultType, class OperationType>
+bool ExecutorBase<ResultType, OperationType>::reachesModule(std::shared_ptr<Module> module, const OperationType& op) const {
+    if ( options.resultCache == true && isCacheable(op) == true && module->IsDeterministic() == true ) {
+        if ( resultCache.Get(getOperationHash(module, op)) != nullptr ) {
+            return false;
+        }
+    }
+
+    /* callModule() may modify the operation */
+    OperationType opCopy = op;
+    const auto probe = std::make_shared<ProbeModule>(module->name);
+
+    callModule(probe, opCopy);
+
+    return probe->reached;
+}
+
+template <class ResultType, class OperationType>
+std::optional<ResultType> ExecutorBase<ResultType, OperationType>::callModuleCached(std::shared_ptr<Module> module, OperationType& op) const {
+    if ( options.resultCache == false || isCacheable(op) == false || module->IsDeterministic() == false ) {
+        return callModule(module, op);
+    }
+
+    const auto key = getOperationHash(module, op);
+
+    const auto cached = resultCache.Get(key);
+    if ( cached == nullptr ) {
+        return resultCache.Put(key, callModule(module, op));
+    }
+
+    /* Re-execute a fraction of the hits to detect nondeterminism */
+    resultCacheHits++;
+    if ( resultCacheHits % options.resultCacheCheck == 0 ) {
+        const auto result = callModule(module, op);
+
+        if ( !(result == *cached) ) {
+            printf("Module %s is not deterministic\n\n", module->name.c_str());
+            printf("Operation:\n%s\n", op.ToString().c_str());
+            printf("Cached result:\n\n%s\n\n", *cached == std::nullopt ? "(empty)" : util::ToString(**cached).c_str());
+            printf("Result:\n\n%s\n\n", result == std::nullopt ? "(empty)" : util::ToString(*result).c_str());
+
+            abort({module->name}, op.Name(), op.GetAlgorithmString(), "nondeterminism");
+        }
+    }
+
+    return *cached;
+}
+
+template <class ResultType, class OperationType>
+void ExecutorBase<ResultType, OperationType>::crossVerify(const std::vector< std::pair<std::shared_ptr<Module>, OperationType> >& operations, const ResultSet& results) const {
+    (void)operations;
+    (void)results;
+}
+
+/* Randomized signatures cannot be compared, so verify each of them with
+ * every other module instead. Every module verifies all signatures in
+ * one go.
+ */
+template <>
+void ExecutorBase<component::ECDSA_Signature, operation::ECDSA_Sign>::crossVerify(const std::vector< std::pair<std::shared_ptr<Module>, operation::ECDSA_Sign> >& operations, const ResultSet& results) const {
+    std::vector< std::pair<std::shared_ptr<Module>, operation::ECDSA_Verify> > verifyOps;
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& op = operations[i].second;
+
+        if ( results[i].second == std::nullopt ) {
+            continue;
+        }
+
+        if ( isRandomized(op) == false ) {
+            continue;
+        }
+
+        verifyOps.push_back({ results[i].first, operation::ECDSA_Verify(op, *results[i].second, op.modifier) });
+    }
+
+    if ( verifyOps.empty() ) {
+        return;
+    }
+
+    for (const auto& m : modules) {
+        const auto& module = m.second;
+
+        /* Skip if this is a disabled module */
+        if ( options.disableModules != std::nullopt ) {
+            if ( std::find(
+                        options.disableModules->begin(),
+                        options.disableModules->end(),
+                        m.first) != options.disableModules->end() ) {
+                continue;
+            }
+        }
+
+        for (auto& verifyOp : verifyOps) {
+            if ( verifyOp.first == module ) {
+                continue;
+            }
+
+            const auto verified = callECDSA_Verify(options, module, verifyOp.second);
+
+            if ( verified == std::nullopt || *verified == true ) {
+                continue;
+            }
+
+            printf("Signature produced by module %s is rejected by module %s\n\n",
+                    verifyOp.first->name.c_str(),
+                    module->name.c_str());
+            printf("Operation:\n%s\n", verifyOp.second.ToString().c_str());
+
+            abort(
+                    {verifyOp.first->name.c_str(), module->name.c_str()},
+                    verifyOp.second.Name(),
+                    verifyOp.second.GetAlgorithmString(),
+                    "verification failure"
+            );
+        }
+    }
+}
+
 template <class ResultType, class OperationType>
 void ExecutorBase<ResultType, OperationType>::compare(const std::vector< std::pair<std::shared_ptr<Module>, OperationType> >& operations, const ResultSet& results, const uint8_t* data, const size_t size) const {
     if ( results.size() < 2 ) {
@@ -1128,6 +1804,13 @@ void ExecutorBase<ResultType, OperationType>::compare(const std::vector< std::pa
         return;
     }
 
+    /* Results computed from random data are only comparable if all
+     * modules drew it from the same deterministic stream
+     */
+    if ( isRandomized(operations[0].second) == true && options.deterministicRNG == false ) {
+        return;
+    }
+
     for (size_t i = 1; i < filtered.size(); i++) {
         const std::optional<ResultType>& prev = filtered[i-1].second;
         const std::optional<ResultType>& cur = filtered[i].second;
@@ -1324,34 +2007,86 @@ void ExecutorBase<ResultType, OperationType>::Run(Datasource& parentDs, const ui
     if ( options.debug == true && !operations.empty() ) {
         printf("Running:\n%s\n", operations[0].second.ToString().c_str());
     }
+
+    std::optional<std::vector<uint8_t>> rngSeed = std::nullopt;
+    std::optional<std::string> rngScheme = std::nullopt;
+    std::vector<size_t> uncomparable;
+
+    if ( options.deterministicRNG == true ) {
+        rngSeed = crypto::sha256(operations[0].second.modifier.Get());
+    }
+
+    for (size_t i = 1; i < operations.size(); i++) {
+        auto& module = operations[i].first;
+        auto& op = operations[i].second;
+
+        auto& prevModule = operations[i-1].first;
+        auto& prevOp = operations[i].second;
+
+        if ( prevModule == module && prevOp.modifier == op.modifier ) {
+            auto& curModifier = op.modifier.GetVectorPtr();
+            if ( curModifier.size() == 0 ) {
+                for (size_t j = 0; j < 512; j++) {
+                    curModifier.push_back(1);
+                }
+            } else {
+                for (auto& c : curModifier) {
+                    c++;
+                }
+            }
+        }
+    }
+
+    /* Start the out-of-process modules first, so that they run
+     * concurrently with the in-process modules. Operations which the
+     * module will not be called with, because they fail the checks in
+     * callModule() or have a cached result, are not dispatched.
+     */
+    for (const auto& operation : operations) {
+        const auto remoteModule = std::dynamic_pointer_cast<remote::RemoteModule>(operation.first);
+        if ( remoteModule != nullptr && reachesModule(operation.first, operation.second) == true ) {
+            remoteModule->Submit(operationID, operation.second);
+        }
+    }
+
     for (size_t i = 0; i < operations.size(); i++) {
         auto& operation = operations[i];
 
         auto& module = operation.first;
         auto& op = operation.second;
 
-        if ( i > 0 ) {
-            auto& prevModule = operations[i-1].first;
-            auto& prevOp = operations[i].second;
+        {
+            /* Every module starts at the beginning of the same stream */
+            std::unique_ptr<rng::Scope> rngScope = nullptr;
+            if ( rngSeed != std::nullopt ) {
+                rngScope = std::make_unique<rng::Scope>(*rngSeed);
+            }
 
-            if ( prevModule == module && prevOp.modifier == op.modifier ) {
-                auto& curModifier = op.modifier.GetVectorPtr();
-                if ( curModifier.size() == 0 ) {
-                    for (size_t j = 0; j < 512; j++) {
-                        curModifier.push_back(1);
-                    }
-                } else {
-                    for (auto& c : curModifier) {
-                        c++;
+            results.push_back( {module, std::move(callModuleCached(module, op))} );
+
+            /* A randomized result can only be compared if the module drew from
+             * the stream, and only to the results of modules which declare the
+             * same scheme as the first such module
+             */
+            if ( rngScope != nullptr && isRandomized(op) == true ) {
+                const auto scheme = module->DeterministicRNGScheme();
+
+                if ( rngScope->Consumed() == 0 || scheme == std::nullopt ) {
+                    uncomparable.push_back(results.size() - 1);
+                } else if ( rngScheme == std::nullopt ) {
+                    if ( results.back().second != std::nullopt ) {
+                        rngScheme = scheme;
                     }
+                } else if ( *scheme != *rngScheme ) {
+                    uncomparable.push_back(results.size() - 1);
                 }
             }
         }
 
-        results.push_back( {module, std::move(callModule(module, op))} );
-
         const auto& result = results.back();
 
+        checkResultDB(module, op, result.second);
+
         if ( result.second != std::nullopt ) {
             updateExtraCounters(module->ID, op);
 
@@ -1378,7 +2113,18 @@ void ExecutorBase<ResultType, OperationType>::Run(Datasource& parentDs, const ui
         postprocess(module, op, result);
     }
 
+    /* Discard the results of submitted operations that were not used,
+     * for example because the result was cached
+     */
+    remote::Flush();
+
     if ( options.noCompare == false ) {
+        crossVerify(operations, results);
+
+        for (const auto& i : uncomparable) {
+            results[i].second = std::nullopt;
+        }
+
         compare(operations, results, data, size);
     }
 }
@@ -1409,8 +2155,17 @@ template class ExecutorBase<component::ECDSA_Signature, operation::ECDSA_Sign>;
 template class ExecutorBase<bool, operation::ECDSA_Verify>;
 template class ExecutorBase<component::Secret, operation::ECDH_Derive>;
 template class ExecutorBase<component::Ciphertext, operation::ECIES_Encrypt>;
+template class ExecutorBase<component::ECC_Point, operation::ECC_Point_Add>;
+template class ExecutorBase<component::ECC_Point, operation::ECC_Point_Mul>;
+template class ExecutorBase<component::ECC_Point, operation::ECC_Point_Dbl>;
+template class ExecutorBase<component::ECC_Point, operation::ECC_MultiScalarMul>;
 template class ExecutorBase<component::DH_KeyPair, operation::DH_GenerateKeyPair>;
 template class ExecutorBase<component::Bignum, operation::DH_Derive>;
 template class ExecutorBase<component::Bignum, operation::BignumCalc>;
+template class ExecutorBase<component::LargeBignum, operation::BignumCalcLarge>;
+template class ExecutorBase<component::BignumTrace, operation::BignumCalcSequence>;
+template class ExecutorBase<component::Digest, operation::DigestStream>;
+template class ExecutorBase<component::MAC, operation::HMACStream>;
+template class ExecutorBase<component::Ciphertext, operation::SymmetricEncryptStream>;
 
 } /* namespace cryptofuzz */
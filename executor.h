@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cryptofuzz/lru.h>
 #include <cryptofuzz/module.h>
 #include <cryptofuzz/options.h>
 #include <cstddef>
@@ -22,9 +23,17 @@ class ExecutorBase {
         using ResultPair = std::pair< std::shared_ptr<Module>, std::optional<ResultType> >;
         using ResultSet = std::vector<ResultPair>;
 
+        /* Results of deterministic module calls, keyed by a hash of the
+         * module ID and the operation (including the modifier)
+         */
+        mutable LRUCache<std::vector<uint8_t>, std::optional<ResultType>, 1024> resultCache;
+        mutable uint64_t resultCacheHits = 0;
+
         ResultSet filter(const ResultSet& results) const;
         bool dontCompare(const OperationType& operation) const;
+        bool isRandomized(const OperationType& operation) const;
         void compare(const std::vector< std::pair<std::shared_ptr<Module>, OperationType> >& operations, const ResultSet& results, const uint8_t* data, const size_t size) const;
+        void crossVerify(const std::vector< std::pair<std::shared_ptr<Module>, OperationType> >& operations, const ResultSet& results) const;
         OperationType getOp(Datasource* parentDs, const uint8_t* data, const size_t size) const;
         OperationType getOpPostprocess(Datasource* parentDs, OperationType op) const;
         std::shared_ptr<Module> getModule(Datasource& ds) const;
@@ -40,6 +49,13 @@ class ExecutorBase {
         void postprocess(std::shared_ptr<Module> module, OperationType& op, const ResultPair& result) const;
         std::optional<ResultType> callModule(std::shared_ptr<Module> module, OperationType& op) const;
 
+        std::vector<uint8_t> getOperationHash(std::shared_ptr<Module> module, const OperationType& op) const;
+        bool isCacheable(const OperationType& operation) const;
+        void checkResultDB(std::shared_ptr<Module> module, const OperationType& op, const std::optional<ResultType>& result) const;
+        std::optional<ResultType> callModuleCached(std::shared_ptr<Module> module, OperationType& op) const;
+        /* Whether callModuleCached() would call the module with the operation */
+        bool reachesModule(std::shared_ptr<Module> module, const OperationType& op) const;
+
         void abort(std::vector<std::string> moduleNames, const std::string operation, const std::string algorithm, const std::string reason) const;
     public:
         void Run(Datasource& parentDs, const uint8_t* data, const size_t size) const;
@@ -73,8 +89,17 @@ using ExecutorECDSA_Sign = ExecutorBase<component::ECDSA_Signature, operation::E
 using ExecutorECDSA_Verify = ExecutorBase<bool, operation::ECDSA_Verify>;
 using ExecutorECDH_Derive = ExecutorBase<component::Secret, operation::ECDH_Derive>;
 using ExecutorECIES_Encrypt = ExecutorBase<component::Ciphertext, operation::ECIES_Encrypt>;
+using ExecutorECC_Point_Add = ExecutorBase<component::ECC_Point, operation::ECC_Point_Add>;
+using ExecutorECC_Point_Mul = ExecutorBase<component::ECC_Point, operation::ECC_Point_Mul>;
+using ExecutorECC_Point_Dbl = ExecutorBase<component::ECC_Point, operation::ECC_Point_Dbl>;
+using ExecutorECC_MultiScalarMul = ExecutorBase<component::ECC_Point, operation::ECC_MultiScalarMul>;
 using ExecutorDH_GenerateKeyPair = ExecutorBase<component::DH_KeyPair, operation::DH_GenerateKeyPair>;
 using ExecutorDH_Derive = ExecutorBase<component::Bignum, operation::DH_Derive>;
 using ExecutorBignumCalc = ExecutorBase<component::Bignum, operation::BignumCalc>;
+using ExecutorBignumCalcLarge = ExecutorBase<component::LargeBignum, operation::BignumCalcLarge>;
+using ExecutorBignumCalcSequence = ExecutorBase<component::BignumTrace, operation::BignumCalcSequence>;
+using ExecutorDigestStream = ExecutorBase<component::Digest, operation::DigestStream>;
+using ExecutorHMACStream = ExecutorBase<component::MAC, operation::HMACStream>;
+using ExecutorSymmetricEncryptStream = ExecutorBase<component::Ciphertext, operation::SymmetricEncryptStream>;
 
 } /* namespace cryptofuzz */
@@ -13,6 +13,56 @@ except NameError:
 def ToCryptofuzzID(prefix, item):
     return 'fuzzing::datasource::ID("Cryptofuzz/{}/{}")'.format(prefix, item)
 
+MASK64 = 0xFFFFFFFFFFFFFFFF
+
+# Same as fuzzing::datasource::ID()
+def CryptofuzzID(prefix, item):
+    ret = 0xcbf29ce484222325
+    for c in bytearray('Cryptofuzz/{}/{}'.format(prefix, item).encode('ascii')):
+        ret = ((ret ^ c) * 0x100000001b3) & MASK64
+    return ret
+
+# Same as LUTReduce() and LUTIndex() in repository.h
+def LUTReduce(x, n):
+    return ((x & 0xFFFFFFFF) * n) >> 32
+
+def LUTSlot(id, seed, n):
+    return LUTReduce((((id ^ seed) * 0x9E3779B97F4A7C15) & MASK64) >> 32, n)
+
+# Minimal perfect hash (hash and displace): the IDs are distributed over
+# buckets, and for each bucket, largest first, a seed is searched which maps
+# all of its IDs to free slots.
+def PerfectHash(ids):
+    numSlots = len(ids)
+    numBuckets = (numSlots + 1) // 2
+
+    buckets = [[] for i in range(numBuckets)]
+    for index in range(numSlots):
+        buckets[LUTReduce(ids[index], numBuckets)] += [ index ]
+
+    seeds = [0] * numBuckets
+    slots = [None] * numSlots
+
+    for bucket in sorted(range(numBuckets), key=lambda b: -len(buckets[b])):
+        if len(buckets[bucket]) == 0:
+            break
+
+        seed = 0
+        while True:
+            candidate = [LUTSlot(ids[index], seed, numSlots) for index in buckets[bucket]]
+            if len(set(candidate)) == len(candidate) and all(slots[slot] == None for slot in candidate):
+                break
+            seed += 1
+            if seed > 0xFFFFFFFF:
+                print("Cannot construct perfect hash, exiting")
+                exit(1)
+
+        seeds[bucket] = seed
+        for slot, index in zip(candidate, buckets[bucket]):
+            slots[slot] = index
+
+    return seeds, slots
+
 class ModeOfOperation(object):
     def __init__(self, cipher):
         self.modeDict = {}
@@ -68,13 +118,21 @@ class Digest(Component):
             self.size = str(size)
 
 class ECC_Curve(Component):
-    def __init__(self, operation, order = None):
+    def __init__(self, operation, order = None, prime = None, a = None, b = None, x = None, y = None):
         super(ECC_Curve, self).__init__(operation)
 
-        if order == None:
-            self.order = "std::nullopt"
+        # Short Weierstrass parameters (y^2 = x^3 + ax + b mod prime) and generator (x, y)
+        self.order = self.toOptional(order)
+        self.prime = self.toOptional(prime)
+        self.a = self.toOptional(a)
+        self.b = self.toOptional(b)
+        self.x = self.toOptional(x)
+        self.y = self.toOptional(y)
+    def toOptional(self, s):
+        if s == None:
+            return "std::nullopt"
         else:
-            self.order = '"' + order + '"'
+            return '"' + s + '"'
 
 class CalcOp(Component):
     def __init__(self, operation):
@@ -122,6 +180,33 @@ class Table(object):
 
         outStr += '};\n\n'
 
+        return outStr
+    def ToCPPPerfectHash(self):
+        ids = [CryptofuzzID(self.prefix, obj.name) for obj in self.table]
+        if len(set(ids)) != len(ids):
+            print("Duplicate ID in {} table, exiting".format(self.prefix))
+            exit(1)
+        if len(ids) > 0xFFFF:
+            print("Too many entries in {} table, exiting".format(self.prefix))
+            exit(1)
+
+        seeds, slots = PerfectHash(ids)
+        name = self.getStructName(False)
+
+        outStr = ""
+        outStr += "constexpr uint32_t " + name + "Seeds[] = {\n"
+        for i in range(0, len(seeds), 8):
+            outStr += '    ' + ", ".join( str(seed) for seed in seeds[i:i+8] ) + ',\n'
+        outStr += '};\n\n'
+        outStr += "constexpr uint16_t " + name + "Slots[] = {\n"
+        for i in range(0, len(slots), 16):
+            outStr += '    ' + ", ".join( str(slot) for slot in slots[i:i+16] ) + ',\n'
+        outStr += '};\n\n'
+        outStr += "/* Index of id in " + name + ", or -1 */\n"
+        outStr += "constexpr long " + name + "Index(const uint64_t id) noexcept {\n"
+        outStr += "    return LUTIndex(id, " + name + ", " + name + "Seeds, " + name + "Slots);\n"
+        outStr += "}\n\n"
+
         return outStr
     def ToCPPMap(self):
         outStr = ""
@@ -141,40 +226,37 @@ class Table(object):
         return outStr
 
 class CipherTable(Table):
+    # Properties of a cipher, packed into CipherLUT_t::flags
+    flags = [ 'CBC', 'CCM', 'CFB', 'CTR', 'ECB', 'GCM', 'OCB', 'OFB', 'XTS', 'AEAD', 'WRAP', 'AES' ]
+
     def __init__(self):
         tableDecl = [
-                "bool CBC",
-                "bool CCM",
-                "bool CFB",
-                "bool CTR",
-                "bool ECB",
-                "bool GCM",
-                "bool OCB",
-                "bool OFB",
-                "bool XTS",
-                "bool AEAD",
-                "bool WRAP",
-                "bool AES",
+                "uint16_t flags",
         ]
 
         super(CipherTable, self).__init__('Cipher', tableDecl)
+    def GetTableDecl(self):
+        outStr = ""
+        outStr += "enum CipherFlag : uint16_t {\n"
+        for bit in range(len(self.flags)):
+            outStr += "    CipherFlag{} = 1 << {},\n".format(self.flags[bit], bit)
+        outStr += "};\n"
+        outStr += super(CipherTable, self).GetTableDecl()
+        return outStr
     def getTableEntryList(self, index):
-        tableEntry = []
+        cipher = self.table[index]
 
-        tableEntry += [ 'true' if 'CBC' in self.table[index].operation.modeDict else 'false' ]
-        tableEntry += [ 'true' if 'CCM' in self.table[index].operation.modeDict else 'false' ]
-        tableEntry += [ 'true' if 'CFB' in self.table[index].operation.modeDict else 'false' ]
-        tableEntry += [ 'true' if 'CTR' in self.table[index].operation.modeDict else 'false' ]
-        tableEntry += [ 'true' if 'ECB' in self.table[index].operation.modeDict else 'false' ]
-        tableEntry += [ 'true' if 'GCM' in self.table[index].operation.modeDict else 'false' ]
-        tableEntry += [ 'true' if 'OCB' in self.table[index].operation.modeDict else 'false' ]
-        tableEntry += [ 'true' if 'OFB' in self.table[index].operation.modeDict else 'false' ]
-        tableEntry += [ 'true' if 'XTS' in self.table[index].operation.modeDict else 'false' ]
-        tableEntry += [ 'true' if self.table[index].isAEAD else 'false' ]
-        tableEntry += [ 'true' if self.table[index].isWRAP else 'false' ]
-        tableEntry += [ 'true' if self.table[index].isAES else 'false' ]
+        flags = [ flag for flag in cipher.operation.modeDict ]
+        if cipher.isAEAD:
+            flags += [ 'AEAD' ]
+        if cipher.isWRAP:
+            flags += [ 'WRAP' ]
+        if cipher.isAES:
+            flags += [ 'AES' ]
 
-        return tableEntry
+        flags = [ 'CipherFlag' + flag for flag in self.flags if flag in flags ]
+
+        return [ ' | '.join(flags) if len(flags) else '0' ]
 
 class DigestTable(Table):
     def __init__(self):
@@ -216,6 +298,11 @@ class ECC_CurveTable(Table):
     def __init__(self):
         tableDecl = [
                 "std::optional<const char*> order",
+                "std::optional<const char*> prime",
+                "std::optional<const char*> a",
+                "std::optional<const char*> b",
+                "std::optional<const char*> x",
+                "std::optional<const char*> y",
         ]
 
         super(ECC_CurveTable, self).__init__('ECC_Curve', tableDecl)
@@ -223,6 +310,11 @@ class ECC_CurveTable(Table):
         tableEntry = []
 
         tableEntry += [ self.table[index].order ]
+        tableEntry += [ self.table[index].prime ]
+        tableEntry += [ self.table[index].a ]
+        tableEntry += [ self.table[index].b ]
+        tableEntry += [ self.table[index].x ]
+        tableEntry += [ self.table[index].y ]
 
         return tableEntry
 
@@ -277,11 +369,18 @@ modules.Add( Module("wolfCrypt-OpenSSL") )
 
 operations = OperationTable()
 operations.Add( Operation("BignumCalc") )
+operations.Add( Operation("BignumCalcLarge") )
+operations.Add( Operation("BignumCalcSequence") )
 operations.Add( Operation("CMAC") )
 operations.Add( Operation("DH_Derive") )
 operations.Add( Operation("DH_GenerateKeyPair") )
 operations.Add( Operation("Digest") )
+operations.Add( Operation("DigestStream") )
 operations.Add( Operation("ECC_GenerateKeyPair") )
+operations.Add( Operation("ECC_MultiScalarMul") )
+operations.Add( Operation("ECC_Point_Add") )
+operations.Add( Operation("ECC_Point_Dbl") )
+operations.Add( Operation("ECC_Point_Mul") )
 operations.Add( Operation("ECC_PrivateToPublic") )
 operations.Add( Operation("ECC_ValidatePubkey") )
 operations.Add( Operation("ECDH_Derive") )
@@ -289,6 +388,7 @@ operations.Add( Operation("ECDSA_Sign") )
 operations.Add( Operation("ECDSA_Verify") )
 operations.Add( Operation("ECIES_Encrypt") )
 operations.Add( Operation("HMAC") )
+operations.Add( Operation("HMACStream") )
 operations.Add( Operation("KDF_ARGON2") )
 operations.Add( Operation("KDF_BCRYPT") )
 operations.Add( Operation("KDF_HKDF") )
@@ -302,6 +402,7 @@ operations.Add( Operation("KDF_TLS1_PRF") )
 operations.Add( Operation("KDF_X963") )
 operations.Add( Operation("SymmetricDecrypt") )
 operations.Add( Operation("SymmetricEncrypt") )
+operations.Add( Operation("SymmetricEncryptStream") )
 
 ciphers = CipherTable()
 
@@ -771,20 +872,20 @@ digests.Add( Digest("XXHASH32") )
 digests.Add( Digest("XXHASH64") )
 
 ecc_curves = ECC_CurveTable()
-ecc_curves.Add( ECC_Curve("brainpool160r1", "1332297598440044874827085038830181364212942568457") )
-ecc_curves.Add( ECC_Curve("brainpool160t1", "1332297598440044874827085038830181364212942568457") )
-ecc_curves.Add( ECC_Curve("brainpool192r1", "4781668983906166242955001894269038308119863659119834868929") )
-ecc_curves.Add( ECC_Curve("brainpool192t1", "4781668983906166242955001894269038308119863659119834868929") )
-ecc_curves.Add( ECC_Curve("brainpool224r1", "22721622932454352787552537995910923612567546342330757191396560966559") )
-ecc_curves.Add( ECC_Curve("brainpool224t1", "22721622932454352787552537995910923612567546342330757191396560966559") )
-ecc_curves.Add( ECC_Curve("brainpool256r1", "76884956397045344220809746629001649092737531784414529538755519063063536359079") )
-ecc_curves.Add( ECC_Curve("brainpool256t1", "76884956397045344220809746629001649092737531784414529538755519063063536359079") )
-ecc_curves.Add( ECC_Curve("brainpool320r1", "1763593322239166354161909842446019520889512772717686063760686124016784784845843468355685258203921") )
-ecc_curves.Add( ECC_Curve("brainpool320t1", "1763593322239166354161909842446019520889512772717686063760686124016784784845843468355685258203921") )
-ecc_curves.Add( ECC_Curve("brainpool384r1", "21659270770119316173069236842332604979796116387017648600075645274821611501358515537962695117368903252229601718723941") )
-ecc_curves.Add( ECC_Curve("brainpool384t1", "21659270770119316173069236842332604979796116387017648600075645274821611501358515537962695117368903252229601718723941") )
-ecc_curves.Add( ECC_Curve("brainpool512r1", "8948962207650232551656602815159153422162609644098354511344597187200057010413418528378981730643524959857451398370029280583094215613882043973354392115544169") )
-ecc_curves.Add( ECC_Curve("brainpool512t1", "8948962207650232551656602815159153422162609644098354511344597187200057010413418528378981730643524959857451398370029280583094215613882043973354392115544169") )
+ecc_curves.Add( ECC_Curve("brainpool160r1", "1332297598440044874827085038830181364212942568457", "1332297598440044874827085558802491743757193798159", "297190522446607939568481567949428902921613329152", "173245649450172891208247283053495198538671808088", "1089473557631435284577962539738532515920566082499", "127912481829969033206777085249718746721365418785") )
+ecc_curves.Add( ECC_Curve("brainpool160t1", "1332297598440044874827085038830181364212942568457", "1332297598440044874827085558802491743757193798159", "1332297598440044874827085558802491743757193798156", "698401795719474705027684479972917623041381757824", "1013918819608769552616977083272059630517089149816", "992437653978037713070561264469524978381944905901") )
+ecc_curves.Add( ECC_Curve("brainpool192r1", "4781668983906166242955001894269038308119863659119834868929", "4781668983906166242955001894344923773259119655253013193367", "2613009377683017747869391908421543348309181741502784219375", "1731160591135112004210203499537764623771657619977468323273", "4723188856514392935399337699153522173525168621081341681622", "507884783101387741749746950209061101579755255809652136847") )
+ecc_curves.Add( ECC_Curve("brainpool192t1", "4781668983906166242955001894269038308119863659119834868929", "4781668983906166242955001894344923773259119655253013193367", "4781668983906166242955001894344923773259119655253013193364", "486321888066950067394881041525590797530120076120499518329", "1444558712667280506885530592978306040338136913835324440873", "232764348904945951820395534722141373682806994795615748553") )
+ecc_curves.Add( ECC_Curve("brainpool224r1", "22721622932454352787552537995910923612567546342330757191396560966559", "22721622932454352787552537995910928073340732145944992304435472941311", "11020725272625742361946480833014344015343456918668456061589001510723", "3949606626053374030787926457695139766118442946052311411513528958987", "1428364927244201726431498207475486496993067267318520844137448783997", "9337555360448823227812410753177468631215558779020518084752618816205") )
+ecc_curves.Add( ECC_Curve("brainpool224t1", "22721622932454352787552537995910923612567546342330757191396560966559", "22721622932454352787552537995910928073340732145944992304435472941311", "22721622932454352787552537995910928073340732145944992304435472941308", "7919603849831377222129533323916957959225380016698795812027476510861", "11236281700362234642592534287151572422539408672654616227474732012928", "364032462118593425315751587028126980694396626774408344039871404876") )
+ecc_curves.Add( ECC_Curve("brainpool256r1", "76884956397045344220809746629001649092737531784414529538755519063063536359079", "76884956397045344220809746629001649093037950200943055203735601445031516197751", "56698187605326110043627228396178346077120614539475214109386828188763884139993", "17577232497321838841075697789794520262950426058923084567046852300633325438902", "63243729749562333355292243550312970334778175571054726587095381623627144114786", "38218615093753523893122277964030810387585405539772602581557831887485717997975") )
+ecc_curves.Add( ECC_Curve("brainpool256t1", "76884956397045344220809746629001649092737531784414529538755519063063536359079", "76884956397045344220809746629001649093037950200943055203735601445031516197751", "76884956397045344220809746629001649093037950200943055203735601445031516197748", "46214326585032579593829631435610129746736367449296220983687490401182983727876", "74138526386500101787937404544159543470173440588427591213843535686338908194292", "20625154686056605250529482107801269759951443923312408063441227608803066104254") )
+ecc_curves.Add( ECC_Curve("brainpool320r1", "1763593322239166354161909842446019520889512772717686063760686124016784784845843468355685258203921", "1763593322239166354161909842446019520889512772719515192772960415288640868802149818095501499903527", "524709318439392693105919717518043758943240164412117372990311331314771510648804065756354311491252", "684460840191207052139729091116995410883497412720006364295713596062999867796741135919289734394278", "565203972584199378547773331021708157952136817703497461781479793049434111597020229546183313458705", "175146432689526447697480803229621572834859050903464782210773312572877763380340633688906597830369") )
+ecc_curves.Add( ECC_Curve("brainpool320t1", "1763593322239166354161909842446019520889512772717686063760686124016784784845843468355685258203921", "1763593322239166354161909842446019520889512772719515192772960415288640868802149818095501499903527", "1763593322239166354161909842446019520889512772719515192772960415288640868802149818095501499903524", "1401395435032847536924656852322353441447762422733674743806973258207878888547540276867732868432723", "1221175819973001316491038958226563119032598033059331804921649457916311604176688737745420093746514", "832095900618272253462376182163435186143818309959785348829039065198217071225345202726924484399811") )
+ecc_curves.Add( ECC_Curve("brainpool384r1", "21659270770119316173069236842332604979796116387017648600075645274821611501358515537962695117368903252229601718723941", "21659270770119316173069236842332604979796116387017648600081618503821089934025961822236561982844534088440708417973331", "19048979039598244295279281525021548448223459855185222892089532512446337024935426033638342846977861914875721218402342", "717131854892629093329172042053689661426642816397448020844407951239049616491589607702456460799758882466071646850065", "4480579927441533893329522230328287337018133311029754539518372936441756157459087304048546502931308754738349656551198", "21354446258743982691371413536748675410974765754620216137225614281636810686961198361153695003859088327367976229294869") )
+ecc_curves.Add( ECC_Curve("brainpool384t1", "21659270770119316173069236842332604979796116387017648600075645274821611501358515537962695117368903252229601718723941", "21659270770119316173069236842332604979796116387017648600081618503821089934025961822236561982844534088440708417973331", "21659270770119316173069236842332604979796116387017648600081618503821089934025961822236561982844534088440708417973328", "19596161053329239268181228455226581162286252326261019516900162717091837027531392576647644262320816848087868142547438", "3827769047710394604076870463731979903132904572714069494181204655675960538951736634566672590576020545838501853661388", "5797643717699939326787282953388004860198302425468870641753455602553471777319089854136002629714659021021358409132328") )
+ecc_curves.Add( ECC_Curve("brainpool512r1", "8948962207650232551656602815159153422162609644098354511344597187200057010413418528378981730643524959857451398370029280583094215613882043973354392115544169", "8948962207650232551656602815159153422162609644098354511344597187200057010413552439917934304191956942765446530386427345937963894309923928536070534607816947", "6294860557973063227666421306476379324074715770622746227136910445450301914281276098027990968407983962691151853678563877834221834027439718238065725844264138", "3245789008328967059274849584342077916531909009637501918328323668736179176583263496463525128488282611559800773506973771797764811498834995234341530862286627", "6792059140424575174435640431269195087843153390102521881468023012732047482579853077545647446272866794936371522410774532686582484617946013928874296844351522", "6592244555240112873324748381429610341312712940326266331327445066687010545415256461097707483288650216992613090185042957716318301180159234788504307628509330") )
+ecc_curves.Add( ECC_Curve("brainpool512t1", "8948962207650232551656602815159153422162609644098354511344597187200057010413418528378981730643524959857451398370029280583094215613882043973354392115544169", "8948962207650232551656602815159153422162609644098354511344597187200057010413552439917934304191956942765446530386427345937963894309923928536070534607816947", "8948962207650232551656602815159153422162609644098354511344597187200057010413552439917934304191956942765446530386427345937963894309923928536070534607816944", "6532815740455945129522030162820444801309011444717674409730083343052139800841847092116476221316466234404847931899409316558007222582458822004777353814164030", "5240454105373391383446315535930423532243726242869439206480578543706358506399554673205583372921814351137736817888782671966171301927338369930113338349467098", "4783098043208509222858478731459039446855297686825168822962919559100076900387655035060042118755576220187973470126780576052258118403094460341772613532037938") )
 ecc_curves.Add( ECC_Curve("ed25519") )
 ecc_curves.Add( ECC_Curve("ed448") )
 ecc_curves.Add( ECC_Curve("frp256v1") )
@@ -801,21 +902,21 @@ ecc_curves.Add( ECC_Curve("ipsec4") )
 ecc_curves.Add( ECC_Curve("numsp256t1", "28948022309329048855892746252171976963230320855948034936185801359597441823917") )
 ecc_curves.Add( ECC_Curve("numsp384t1", "9850501549098619803069760025035903451269934817616361666986603623638432032256865558780541454083219163250604218936869") )
 ecc_curves.Add( ECC_Curve("numsp512t1", "3351951982485649274893506249551461531869841455148098344430890360930441007518346893020404367996870882777121262593078152830179243535023501253454245088133513") )
-ecc_curves.Add( ECC_Curve("secp112r1", "4451685225093714776491891542548933") )
-ecc_curves.Add( ECC_Curve("secp112r2", "1112921306273428674967732714786891") )
-ecc_curves.Add( ECC_Curve("secp128r1", "340282366762482138443322565580356624661") )
-ecc_curves.Add( ECC_Curve("secp128r2", "85070591690620534603955721926813660579") )
-ecc_curves.Add( ECC_Curve("secp160k1", "1461501637330902918203686915170869725397159163571") )
-ecc_curves.Add( ECC_Curve("secp160r1", "1461501637330902918203687197606826779884643492439") )
-ecc_curves.Add( ECC_Curve("secp160r2", "1461501637330902918203685083571792140653176136043") )
-ecc_curves.Add( ECC_Curve("secp192k1", "6277101735386680763835789423061264271957123915200845512077") )
-ecc_curves.Add( ECC_Curve("secp192r1") )
-ecc_curves.Add( ECC_Curve("secp224k1", "26959946667150639794667015087019640346510327083120074548994958668279") )
-ecc_curves.Add( ECC_Curve("secp224r1", "26959946667150639794667015087019625940457807714424391721682722368061") )
-ecc_curves.Add( ECC_Curve("secp256k1", "115792089237316195423570985008687907852837564279074904382605163141518161494337") )
-ecc_curves.Add( ECC_Curve("secp256r1", "115792089210356248762697446949407573529996955224135760342422259061068512044369") )
-ecc_curves.Add( ECC_Curve("secp384r1", "39402006196394479212279040100143613805079739270465446667946905279627659399113263569398956308152294913554433653942643") )
-ecc_curves.Add( ECC_Curve("secp521r1", "6864797660130609714981900799081393217269435300143305409394463459185543183397655394245057746333217197532963996371363321113864768612440380340372808892707005449") )
+ecc_curves.Add( ECC_Curve("secp112r1", "4451685225093714776491891542548933", "4451685225093714772084598273548427", "4451685225093714772084598273548424", "2061118396808653202902996166388514", "188281465057972534892223778713752", "3419875491033170827167861896082688") )
+ecc_curves.Add( ECC_Curve("secp112r2", "1112921306273428674967732714786891", "4451685225093714772084598273548427", "1970543761890640310119143205433388", "1660538572255285715897238774208265", "1534098225527667214992304222930499", "3525120595527770847583704454622871") )
+ecc_curves.Add( ECC_Curve("secp128r1", "340282366762482138443322565580356624661", "340282366762482138434845932244680310783", "340282366762482138434845932244680310780", "308990863222245658030922601041482374867", "29408993404948928992877151431649155974", "275621562871047521857442314737465260675") )
+ecc_curves.Add( ECC_Curve("secp128r2", "85070591690620534603955721926813660579", "340282366762482138434845932244680310783", "284470887156368047300405921324061011681", "126188322377389722996253562430093625949", "164048790688614013222215505581242564928", "52787839253935625605232456597451787076") )
+ecc_curves.Add( ECC_Curve("secp160k1", "1461501637330902918203686915170869725397159163571", "1461501637330902918203684832716283019651637554291", "0", "7", "338530205676502674729549372677647997389429898939", "842365456698940303598009444920994870805149798382") )
+ecc_curves.Add( ECC_Curve("secp160r1", "1461501637330902918203687197606826779884643492439", "1461501637330902918203684832716283019653785059327", "1461501637330902918203684832716283019653785059324", "163235791306168110546604919403271579530548345413", "425826231723888350446541592701409065913635568770", "203520114162904107873991457957346892027982641970") )
+ecc_curves.Add( ECC_Curve("secp160r2", "1461501637330902918203685083571792140653176136043", "1461501637330902918203684832716283019651637554291", "1461501637330902918203684832716283019651637554288", "1032640608390511495214075079957864673410201913530", "473058756663038503608844550604547710019657059949", "1454008495369951658060798698479395908327453245230") )
+ecc_curves.Add( ECC_Curve("secp192k1", "6277101735386680763835789423061264271957123915200845512077", "6277101735386680763835789423207666416102355444459739541047", "0", "3", "5377521262291226325198505011805525673063229037935769709693", "3805108391982600717572440947423858335415441070543209377693") )
+ecc_curves.Add( ECC_Curve("secp192r1", "6277101735386680763835789423176059013767194773182842284081", "6277101735386680763835789423207666416083908700390324961279", "6277101735386680763835789423207666416083908700390324961276", "2455155546008943817740293915197451784769108058161191238065", "602046282375688656758213480587526111916698976636884684818", "174050332293622031404857552280219410364023488927386650641") )
+ecc_curves.Add( ECC_Curve("secp224k1", "26959946667150639794667015087019640346510327083120074548994958668279", "26959946667150639794667015087019630673637144422540572481099315275117", "0", "5", "16983810465656793445178183341822322175883642221536626637512293983324", "13272896753306862154536785447615077600479862871316829862783613755813") )
+ecc_curves.Add( ECC_Curve("secp224r1", "26959946667150639794667015087019625940457807714424391721682722368061", "26959946667150639794667015087019630673557916260026308143510066298881", "26959946667150639794667015087019630673557916260026308143510066298878", "18958286285566608000408668544493926415504680968679321075787234672564", "19277929113566293071110308034699488026831934219452440156649784352033", "19926808758034470970197974370888749184205991990603949537637343198772") )
+ecc_curves.Add( ECC_Curve("secp256k1", "115792089237316195423570985008687907852837564279074904382605163141518161494337", "115792089237316195423570985008687907853269984665640564039457584007908834671663", "0", "7", "55066263022277343669578718895168534326250603453777594175500187360389116729240", "32670510020758816978083085130507043184471273380659243275938904335757337482424") )
+ecc_curves.Add( ECC_Curve("secp256r1", "115792089210356248762697446949407573529996955224135760342422259061068512044369", "115792089210356248762697446949407573530086143415290314195533631308867097853951", "115792089210356248762697446949407573530086143415290314195533631308867097853948", "41058363725152142129326129780047268409114441015993725554835256314039467401291", "48439561293906451759052585252797914202762949526041747995844080717082404635286", "36134250956749795798585127919587881956611106672985015071877198253568414405109") )
+ecc_curves.Add( ECC_Curve("secp384r1", "39402006196394479212279040100143613805079739270465446667946905279627659399113263569398956308152294913554433653942643", "39402006196394479212279040100143613805079739270465446667948293404245721771496870329047266088258938001861606973112319", "39402006196394479212279040100143613805079739270465446667948293404245721771496870329047266088258938001861606973112316", "27580193559959705877849011840389048093056905856361568521428707301988689241309860865136260764883745107765439761230575", "26247035095799689268623156744566981891852923491109213387815615900925518854738050089022388053975719786650872476732087", "8325710961489029985546751289520108179287853048861315594709205902480503199884419224438643760392947333078086511627871") )
+ecc_curves.Add( ECC_Curve("secp521r1", "6864797660130609714981900799081393217269435300143305409394463459185543183397655394245057746333217197532963996371363321113864768612440380340372808892707005449", "6864797660130609714981900799081393217269435300143305409394463459185543183397656052122559640661454554977296311391480858037121987999716643812574028291115057151", "6864797660130609714981900799081393217269435300143305409394463459185543183397656052122559640661454554977296311391480858037121987999716643812574028291115057148", "1093849038073734274511112390766805569936207598951683748994586394495953116150735016013708737573759623248592132296706313309438452531591012912142327488478985984", "2661740802050217063228768716723360960729859168756973147706671368418802944996427808491545080627771902352094241225065558662157113545570916814161637315895999846", "3757180025770020463545507224491183603594455134769762486694567779615544477440556316691234405012945539562144444537289428522585666729196580810124344277578376784") )
 ecc_curves.Add( ECC_Curve("sect113r1", "5192296858534827689835882578830703") )
 ecc_curves.Add( ECC_Curve("sect113r2", "5192296858534827702972497909952403") )
 ecc_curves.Add( ECC_Curve("sect131r1", "1361129467683753853893932755685365560653") )
@@ -834,7 +935,7 @@ ecc_curves.Add( ECC_Curve("sect409k1", "3305279843951242994759576540163855199142
 ecc_curves.Add( ECC_Curve("sect409r1", "661055968790248598951915308032771039828404682964281219284648798304157774827374805208143723762179110965979867288366567526771") )
 ecc_curves.Add( ECC_Curve("sect571k1", "1932268761508629172347675945465993672149463664853217499328617625725759571144780212268133978522706711834706712800825351461273674974066617311929682421617092503555733685276673") )
 ecc_curves.Add( ECC_Curve("sect571r1", "3864537523017258344695351890931987344298927329706434998657235251451519142289560424536143999389415773083133881121926944486246872462816813070234528288303332411393191105285703") )
-ecc_curves.Add( ECC_Curve("sm2p256v1", "115792089210356248756420345214020892766061623724957744567843809356293439045923") )
+ecc_curves.Add( ECC_Curve("sm2p256v1", "115792089210356248756420345214020892766061623724957744567843809356293439045923", "115792089210356248756420345214020892766250353991924191454421193933289684991999", "115792089210356248756420345214020892766250353991924191454421193933289684991996", "18505919022281880113072981827955639221458448578012075254857346196103069175443", "22963146547237050559479531362550074578802567295341616970375194840604139615431", "85132369209828568825618990617112496413088388631904505083283536607588877201568") )
 ecc_curves.Add( ECC_Curve("tc26_gost_3410_12_256_a") )
 ecc_curves.Add( ECC_Curve("tc26_gost_3410_12_256_b") )
 ecc_curves.Add( ECC_Curve("tc26_gost_3410_12_256_c") )
@@ -846,14 +947,14 @@ ecc_curves.Add( ECC_Curve("tc26_gost_3410_12_512_test") )
 ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls1", "5192296858534827627896703833467507") )
 ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls10", "3450873173395281893717377931138512760570940988862252126328087024741343") )
 ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls11", "6901746346790563787434755862277025555839812737345013555379383634485463") )
-ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls12", "26959946667150639794667015087019625940457807714424391721682722368061") )
+ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls12", "26959946667150639794667015087019625940457807714424391721682722368061", "26959946667150639794667015087019630673557916260026308143510066298881", "26959946667150639794667015087019630673557916260026308143510066298878", "18958286285566608000408668544493926415504680968679321075787234672564", "19277929113566293071110308034699488026831934219452440156649784352033", "19926808758034470970197974370888749184205991990603949537637343198772") )
 ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls3", "5846006549323611672814741753598448348329118574063") )
 ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls4", "5192296858534827689835882578830703") )
 ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls5", "5846006549323611672814741626226392056573832638401") )
-ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls6", "4451685225093714776491891542548933") )
-ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls7", "1461501637330902918203685083571792140653176136043") )
-ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls8", "5192296858534827767273836114360297") )
-ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls9", "1461501637330902918203687013445034429194588307251") )
+ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls6", "4451685225093714776491891542548933", "4451685225093714772084598273548427", "4451685225093714772084598273548424", "2061118396808653202902996166388514", "188281465057972534892223778713752", "3419875491033170827167861896082688") )
+ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls7", "1461501637330902918203685083571792140653176136043", "1461501637330902918203684832716283019651637554291", "1461501637330902918203684832716283019651637554288", "1032640608390511495214075079957864673410201913530", "473058756663038503608844550604547710019657059949", "1454008495369951658060798698479395908327453245230") )
+ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls8", "5192296858534827767273836114360297", "5192296858534827628530496329219559", "0", "3", "1", "2") )
+ecc_curves.Add( ECC_Curve("wap_wsg_idm_ecid_wtls9", "1461501637330902918203687013445034429194588307251", "1461501637330902918203684832716283019655932313743", "0", "3", "1", "2") )
 ecc_curves.Add( ECC_Curve("x25519") )
 ecc_curves.Add( ECC_Curve("x448") )
 ecc_curves.Add( ECC_Curve("x962_c2pnb163v1", "5846006549323611672814741626226392056573832638401") )
@@ -872,13 +973,13 @@ ecc_curves.Add( ECC_Curve("x962_c2tnb239v2", "1472372553981986941319414583952432
 ecc_curves.Add( ECC_Curve("x962_c2tnb239v3", "88342353238919216479164875037145925622548965147075144322778604225055999") )
 ecc_curves.Add( ECC_Curve("x962_c2tnb359v1", "15450938044564692288746582873614059390629490453344209663962540632677447295745316740045672843724365195742523") )
 ecc_curves.Add( ECC_Curve("x962_c2tnb431r1", "550132875817621995948098052409342004650086721304725510946523726312246334661592590780763978563125341997711919748453208343530129") )
-ecc_curves.Add( ECC_Curve("x962_p192v1", "6277101735386680763835789423176059013767194773182842284081") )
-ecc_curves.Add( ECC_Curve("x962_p192v2", "6277101735386680763835789423078825936192100537584385056049") )
-ecc_curves.Add( ECC_Curve("x962_p192v3", "6277101735386680763835789423166314882687165660350679936019") )
-ecc_curves.Add( ECC_Curve("x962_p239v1", "883423532389192164791648750360308884807550341691627752275345424702807307") )
-ecc_curves.Add( ECC_Curve("x962_p239v2", "883423532389192164791648750360308886392687657546993855147765732451295331") )
-ecc_curves.Add( ECC_Curve("x962_p239v3", "883423532389192164791648750360308884771190369765922550517967171058034001") )
-ecc_curves.Add( ECC_Curve("x962_p256v1", "115792089210356248762697446949407573529996955224135760342422259061068512044369") )
+ecc_curves.Add( ECC_Curve("x962_p192v1", "6277101735386680763835789423176059013767194773182842284081", "6277101735386680763835789423207666416083908700390324961279", "6277101735386680763835789423207666416083908700390324961276", "2455155546008943817740293915197451784769108058161191238065", "602046282375688656758213480587526111916698976636884684818", "174050332293622031404857552280219410364023488927386650641") )
+ecc_curves.Add( ECC_Curve("x962_p192v2", "6277101735386680763835789423078825936192100537584385056049", "6277101735386680763835789423207666416083908700390324961279", "6277101735386680763835789423207666416083908700390324961276", "5005402392289390203552069470771117084861899307801456990547", "5851329466723574623122023978072381191095567081251774399306", "2487701625881228691269808880535093938601070911264778280469") )
+ecc_curves.Add( ECC_Curve("x962_p192v3", "6277101735386680763835789423166314882687165660350679936019", "6277101735386680763835789423207666416083908700390324961279", "6277101735386680763835789423207666416083908700390324961276", "835424738382823911013350127192156429351504823785813797142", "3068962813279260818967075386646565556597936748864191010966", "1389308651191334868712987806154897411485840735611413676976") )
+ecc_curves.Add( ECC_Curve("x962_p239v1", "883423532389192164791648750360308884807550341691627752275345424702807307", "883423532389192164791648750360308885314476597252960362792450860609699839", "883423532389192164791648750360308885314476597252960362792450860609699836", "738525217406992417348596088038781724164860971797098971891240423363193866", "110282003749548856476348533541186204577905061504881242240149511594420911", "869078407435509378747351873793058868500210384946040694651368759217025454") )
+ecc_curves.Add( ECC_Curve("x962_p239v2", "883423532389192164791648750360308886392687657546993855147765732451295331", "883423532389192164791648750360308885314476597252960362792450860609699839", "883423532389192164791648750360308885314476597252960362792450860609699836", "672911360131302308487984934662800265942370984454769524007721579835502380", "391216823383454382695699374968715597047546990656793544472819218431619303", "628089868206548595071356317553544393570683199925782012253471378783331514") )
+ecc_curves.Add( ECC_Curve("x962_p239v3", "883423532389192164791648750360308884771190369765922550517967171058034001", "883423532389192164791648750360308885314476597252960362792450860609699839", "883423532389192164791648750360308885314476597252960362792450860609699836", "257710759664581349045614884019467140476383834471573891251575555059576126", "713702090966717781398151179513032310291275673609168278295934709018913114", "152051417671827544218539107898347788360948341292488391005135896880966899") )
+ecc_curves.Add( ECC_Curve("x962_p256v1", "115792089210356248762697446949407573529996955224135760342422259061068512044369", "115792089210356248762697446949407573530086143415290314195533631308867097853951", "115792089210356248762697446949407573530086143415290314195533631308867097853948", "41058363725152142129326129780047268409114441015993725554835256314039467401291", "48439561293906451759052585252797914202762949526041747995844080717082404635286", "36134250956749795798585127919587881956611106672985015071877198253568414405109") )
 
 
 calcops = CalcOpTable()
@@ -948,6 +1049,7 @@ with open('repository_tbl.h', 'w') as fp:
     for table in tables:
         fp.write(table.GetTableDecl())
         fp.write(table.ToCPPTable())
+        fp.write(table.ToCPPPerfectHash())
 with open('repository_map.h', 'w') as fp:
     for table in tables:
         fp.write(table.GetTableDecl())
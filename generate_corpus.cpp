@@ -4,11 +4,15 @@
 #include <string>
 #include <cstring>
 #include <fuzzing/datasource/id.hpp>
+#include <cryptofuzz/corpus.h>
 
 using fuzzing::datasource::ID;
 
 size_t counter = 0;
 
+/* Set if the corpus is written to a packed corpus instead of a directory */
+static cryptofuzz::PackedCorpusWriter* packedCorpus = nullptr;
+
 static const std::vector<size_t> sizes = {
     //0, 1, 2, 4, 8, 16, 32, 64, 128, 256, 512,
     0, 1, 2, 4, 8, 16, 32
@@ -186,6 +190,11 @@ static const std::vector<uint64_t> cipherTypes = {
     ID("Cryptofuzz/Cipher/SM4_OFB"),
 };
 static void write(const std::string corpusDirectory, const std::vector<uint8_t>& data) {
+    if ( packedCorpus != nullptr ) {
+        packedCorpus->Add(data.data(), data.size());
+        return;
+    }
+
     counter++;
     const std::string filename = corpusDirectory + "/" + std::to_string(counter);
 
@@ -431,12 +440,20 @@ static void generate_SymmetricEncrypt(const std::string corpusDirectory, const u
 int main(int argc, char** argv)
 {
     if ( argc != 2 ) {
-        printf("Usage: %s <corpus directory>\n", argv[0]);
+        printf("Usage: %s <corpus directory|file.pack>\n", argv[0]);
         return 1;
     }
 
     std::string corpusDirectory = argv[1];
 
+    if ( corpusDirectory.size() > 5 && corpusDirectory.compare(corpusDirectory.size() - 5, 5, ".pack") == 0 ) {
+        packedCorpus = cryptofuzz::PackedCorpusWriter::Open(corpusDirectory);
+        if ( packedCorpus == nullptr ) {
+            printf("Cannot open %s as a packed corpus\n", corpusDirectory.c_str());
+            return 1;
+        }
+    }
+
     static const std::vector<uint64_t> moduleIDs = {
         ID("Cryptofuzz/Module/OpenSSL"),
     };
@@ -450,5 +467,8 @@ int main(int argc, char** argv)
         generate_SymmetricEncrypt(corpusDirectory, moduleID);
     }
 
+    /* Writes the offset table */
+    delete packedCorpus;
+
     return 0;
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cryptofuzz/generic.h>
+#include <array>
 #include <cryptofuzz/util_hexdump.h>
 #include <fuzzing/datasource/datasource.hpp>
 #include "../../third_party/json/json.hpp"
@@ -29,6 +30,8 @@ using PrivateKeyPEM = Buffer;
 using Tag = Buffer;
 using AAD = Buffer;
 using Secret = Buffer;
+/* Unsigned big-endian integer without leading zero bytes; 0 is the empty buffer */
+using LargeBignum = Buffer;
 
 using ECC_PrivateKey = Bignum;
 using Bignum = ::cryptofuzz::Bignum;
@@ -72,6 +75,8 @@ class BignumPair {
 };
 
 using ECC_PublicKey = BignumPair;
+/* Affine coordinates */
+using ECC_Point = BignumPair;
 
 class ECC_KeyPair {
     public:
@@ -113,6 +118,51 @@ class MACType {
         void Serialize(Datasource& ds) const;
 };
 
+/* A cleartext which is never materialized as a whole.
+ * Its contents are a deterministic keystream derived from the seed,
+ * and can be generated at any offset.
+ */
+class VirtualCleartext {
+    private:
+        uint64_t seed;
+        uint64_t size;
+    public:
+        static constexpr uint64_t MaxSize = 64ULL * 1024 * 1024 * 1024;
+
+        VirtualCleartext(Datasource& ds);
+        VirtualCleartext(nlohmann::json json);
+
+        uint64_t GetSeed(void) const;
+        uint64_t GetSize(void) const;
+        void Generate(const uint64_t offset, uint8_t* out, const size_t outSize) const;
+
+        bool operator==(const VirtualCleartext& rhs) const;
+        void Serialize(Datasource& ds) const;
+        nlohmann::json ToJSON(void) const;
+};
+
+/* One step of a BignumCalcSequence program:
+ * register[dst] = calcOp(register[src[0]], ..., register[src[3]])
+ */
+class BignumInstruction {
+    public:
+        static constexpr size_t NumRegisters = 8;
+
+        const CalcOp calcOp;
+        const uint8_t dst;
+        const std::array<uint8_t, 4> src;
+
+        BignumInstruction(Datasource& ds);
+        BignumInstruction(nlohmann::json json);
+
+        bool operator==(const BignumInstruction& rhs) const;
+        void Serialize(Datasource& ds) const;
+        nlohmann::json ToJSON(void) const;
+};
+
+/* The value written by each instruction of a BignumCalcSequence */
+using BignumTrace = std::vector<Bignum>;
+
 using DH_Key = BignumPair;
 using DH_KeyPair = BignumPair;
 
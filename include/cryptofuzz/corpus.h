@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cryptofuzz {
+
+/* A corpus packed into a single file.
+ *
+ * The file is a header followed by the records, each a 32-bit size, a
+ * hash of the input and the input itself. Records are only ever
+ * appended; the offset table of all records is written after them when a
+ * writer is closed, followed by a trailer which points to the table. A
+ * file without a valid trailer (e.g. after a crash) is recovered by
+ * scanning the records.
+ */
+class PackedCorpus {
+    public:
+        using Hash = std::array<uint8_t, 16>;
+
+        /* Whether the file starts with the magic of a packed corpus */
+        static bool Is(const std::string& path);
+        static Hash HashOf(const uint8_t* data, const size_t size);
+    private:
+        friend class PackedCorpusWriter;
+
+        void* map = nullptr;
+        size_t mapSize = 0;
+        std::vector<uint64_t> offsets;
+
+        PackedCorpus(void) = default;
+    public:
+        ~PackedCorpus();
+        PackedCorpus(const PackedCorpus&) = delete;
+        PackedCorpus& operator=(const PackedCorpus&) = delete;
+
+        /* Maps the file read-only. Returns nullptr on failure. */
+        static PackedCorpus* Open(const std::string& path);
+
+        size_t Size(void) const;
+        /* Pointer into the mapping, and size, of input i */
+        std::pair<const uint8_t*, size_t> Get(const size_t i) const;
+};
+
+/* Appends inputs to a packed corpus, skipping inputs it already contains */
+class PackedCorpusWriter {
+    private:
+        FILE* fp = nullptr;
+        /* Where the next record is written */
+        uint64_t end = 0;
+        std::vector<uint64_t> offsets;
+        std::set<PackedCorpus::Hash> hashes;
+
+        PackedCorpusWriter(void) = default;
+    public:
+        /* Writes the offset table */
+        ~PackedCorpusWriter();
+        PackedCorpusWriter(const PackedCorpusWriter&) = delete;
+        PackedCorpusWriter& operator=(const PackedCorpusWriter&) = delete;
+
+        /* Creates the file, or opens it for appending. Returns nullptr on failure. */
+        static PackedCorpusWriter* Open(const std::string& path);
+
+        /* Returns false if the input is already present or cannot be written */
+        bool Add(const uint8_t* data, const size_t size);
+        size_t Size(void) const;
+};
+
+} /* namespace cryptofuzz */
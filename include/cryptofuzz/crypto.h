@@ -12,6 +12,20 @@ std::vector<uint8_t> sha1(const std::vector<uint8_t> data);
 std::vector<uint8_t> sha256(const uint8_t* data, const size_t size);
 std::vector<uint8_t> sha256(const std::vector<uint8_t> data);
 
+/* Incremental SHA-256, for hashing data which is produced in parts */
+class sha256_stream {
+    private:
+        void* md;
+    public:
+        sha256_stream(void);
+        ~sha256_stream();
+        sha256_stream(const sha256_stream&) = delete;
+        sha256_stream& operator=(const sha256_stream&) = delete;
+
+        void update(const uint8_t* data, const size_t size);
+        std::vector<uint8_t> finalize(void);
+};
+
 std::vector<uint8_t> hmac_sha256(const uint8_t* data, const size_t size, const uint8_t* key, const size_t key_size);
 std::vector<uint8_t> hmac_sha256(const std::vector<uint8_t> data, const std::vector<uint8_t> key);
 
@@ -2,6 +2,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
 #include <fuzzing/datasource/datasource.hpp>
 #include <boost/algorithm/hex.hpp>
 #include <boost/algorithm/string.hpp>
@@ -51,7 +54,14 @@ class Buffer {
 class Bignum {
     private:
         Buffer data;
+
+        /* Lazily computed alternative representations */
+        mutable std::optional<std::string> trimmed;
+        mutable std::optional<std::string> hex;
+        mutable std::optional<std::vector<uint8_t>> bin;
+
         void transform(void);
+        bool isDecimal(void) const;
     public:
         Bignum(Datasource& ds);
         Bignum(nlohmann::json json);
@@ -59,9 +69,20 @@ class Bignum {
 
         bool operator==(const Bignum& rhs) const;
         size_t GetSize(void) const;
+        bool IsNegative(void) const;
         std::string ToString(void) const;
-        std::string ToTrimmedString(void) const;
+        const std::string& ToTrimmedString(void) const;
         std::string ToString(Datasource& ds) const;
+
+        /* Hexadecimal as returned by util::DecToHex, prefixed with '-' if negative.
+         * std::nullopt if the number is not a decimal string.
+         */
+        std::optional<std::string> ToHexString(void) const;
+
+        /* Big-endian absolute value, without leading zero bytes.
+         * std::nullopt if the number is not a decimal string.
+         */
+        std::optional<std::vector<uint8_t>> ToBin(void) const;
         nlohmann::json ToJSON(void) const;
         void Serialize(Datasource& ds) const;
 };
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+
+namespace cryptofuzz {
+
+/* Least recently used cache holding at most Size entries */
+template <class Key, class Value, size_t Size>
+class LRUCache {
+    private:
+        using Entry = std::pair<Key, Value>;
+
+        /* Most recently used first */
+        std::list<Entry> entries;
+        std::map<Key, typename std::list<Entry>::iterator> index;
+    public:
+        /* Returns nullptr if the key is not cached */
+        Value* Get(const Key& key) {
+            const auto it = index.find(key);
+            if ( it == index.end() ) {
+                return nullptr;
+            }
+
+            /* noret */ entries.splice(entries.begin(), entries, it->second);
+
+            return &(it->second->second);
+        }
+
+        Value& Put(const Key& key, Value value) {
+            {
+                auto existing = Get(key);
+                if ( existing != nullptr ) {
+                    *existing = std::move(value);
+                    return *existing;
+                }
+            }
+
+            if ( entries.size() == Size ) {
+                index.erase(entries.back().first);
+                entries.pop_back();
+            }
+
+            entries.emplace_front(key, std::move(value));
+            index[key] = entries.begin();
+
+            return entries.front().second;
+        }
+
+        size_t GetSize(void) const {
+            return entries.size();
+        }
+};
+
+} /* namespace cryptofuzz */
@@ -20,6 +20,20 @@ class Module {
 
         virtual ~Module() { }
 
+        /* Whether results only depend on the operation, so that they may be cached */
+        virtual bool IsDeterministic(void) const {
+            return true;
+        }
+
+        /* Under --deterministic-rng, randomized results are only compared
+         * between modules that return the same scheme here, which declares that
+         * they turn the same stream into the same keys and nonces. Modules that
+         * draw from the stream in their own way return their library's name.
+         */
+        virtual std::optional<std::string> DeterministicRNGScheme(void) const {
+            return std::nullopt;
+        }
+
         virtual std::optional<component::Digest> OpDigest(operation::Digest& op) {
             (void)op;
             return std::nullopt;
@@ -120,6 +134,22 @@ class Module {
             (void)op;
             return std::nullopt;
         }
+        virtual std::optional<component::ECC_Point> OpECC_Point_Add(operation::ECC_Point_Add& op) {
+            (void)op;
+            return std::nullopt;
+        }
+        virtual std::optional<component::ECC_Point> OpECC_Point_Mul(operation::ECC_Point_Mul& op) {
+            (void)op;
+            return std::nullopt;
+        }
+        virtual std::optional<component::ECC_Point> OpECC_Point_Dbl(operation::ECC_Point_Dbl& op) {
+            (void)op;
+            return std::nullopt;
+        }
+        virtual std::optional<component::ECC_Point> OpECC_MultiScalarMul(operation::ECC_MultiScalarMul& op) {
+            (void)op;
+            return std::nullopt;
+        }
         virtual std::optional<component::DH_KeyPair> OpDH_GenerateKeyPair(operation::DH_GenerateKeyPair& op) {
             (void)op;
             return std::nullopt;
@@ -132,6 +162,26 @@ class Module {
             (void)op;
             return std::nullopt;
         }
+        virtual std::optional<component::LargeBignum> OpBignumCalcLarge(operation::BignumCalcLarge& op) {
+            (void)op;
+            return std::nullopt;
+        }
+        virtual std::optional<component::BignumTrace> OpBignumCalcSequence(operation::BignumCalcSequence& op) {
+            (void)op;
+            return std::nullopt;
+        }
+        virtual std::optional<component::Digest> OpDigestStream(operation::DigestStream& op) {
+            (void)op;
+            return std::nullopt;
+        }
+        virtual std::optional<component::MAC> OpHMACStream(operation::HMACStream& op) {
+            (void)op;
+            return std::nullopt;
+        }
+        virtual std::optional<component::Ciphertext> OpSymmetricEncryptStream(operation::SymmetricEncryptStream& op) {
+            (void)op;
+            return std::nullopt;
+        }
 };
 
 } /* namespace cryptofuzz */
@@ -724,6 +724,13 @@ class KDF_BCRYPT : public Operation {
                 (keySize == rhs.keySize) &&
                 (modifier == rhs.modifier);
         }
+        void Serialize(Datasource& ds) const {
+            digestType.Serialize(ds);
+            secret.Serialize(ds);
+            salt.Serialize(ds);
+            ds.Put<>(iterations);
+            ds.Put<>(keySize);
+        }
 };
 
 class KDF_SP_800_108 : public Operation {
@@ -835,6 +842,12 @@ class Sign : public Operation {
             /* TODO */
             return false;
         }
+        void Serialize(Datasource& ds) const {
+            cleartext.Serialize(ds);
+            digestType.Serialize(ds);
+            pkeyPEM.Serialize(ds);
+            ds.Put<>(signatureSize);
+        }
 };
 
 class Verify : public Operation {
@@ -862,6 +875,12 @@ class Verify : public Operation {
             /* TODO */
             return false;
         }
+        void Serialize(Datasource& ds) const {
+            cleartext.Serialize(ds);
+            digestType.Serialize(ds);
+            pkeyPEM.Serialize(ds);
+            signature.Serialize(ds);
+        }
 };
 
 class ECC_PrivateToPublic : public Operation {
@@ -1038,6 +1057,14 @@ class ECDSA_Verify : public Operation {
             signature(json["signature"]),
             digestType(json["digestType"])
         { }
+        /* Verify a signature produced by opECDSA_Sign */
+        ECDSA_Verify(const ECDSA_Sign& opECDSA_Sign, const component::ECDSA_Signature signature, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            curveType(opECDSA_Sign.curveType),
+            cleartext(opECDSA_Sign.cleartext),
+            signature(signature),
+            digestType(opECDSA_Sign.digestType)
+        { }
 
         static size_t MaxOperations(void) { return 5; }
         std::string Name(void) const override;
@@ -1170,6 +1197,161 @@ class ECIES_Encrypt : public Operation {
         }
 };
 
+class ECC_Point_Add : public Operation {
+    public:
+        const component::CurveType curveType;
+        const component::ECC_Point a, b;
+
+        ECC_Point_Add(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            curveType(ds),
+            a(ds),
+            b(ds)
+        { }
+        ECC_Point_Add(nlohmann::json json) :
+            Operation(json["modifier"]),
+            curveType(json["curveType"]),
+            a(json["a_x"], json["a_y"]),
+            b(json["b_x"], json["b_y"])
+        { }
+
+        static size_t MaxOperations(void) { return 5; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        inline bool operator==(const ECC_Point_Add& rhs) const {
+            return
+                (curveType == rhs.curveType) &&
+                (a == rhs.a) &&
+                (b == rhs.b) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            curveType.Serialize(ds);
+            a.Serialize(ds);
+            b.Serialize(ds);
+        }
+};
+
+class ECC_Point_Mul : public Operation {
+    public:
+        const component::CurveType curveType;
+        const component::ECC_Point a;
+        const component::Bignum b;
+
+        ECC_Point_Mul(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            curveType(ds),
+            a(ds),
+            b(ds)
+        { }
+        ECC_Point_Mul(nlohmann::json json) :
+            Operation(json["modifier"]),
+            curveType(json["curveType"]),
+            a(json["a_x"], json["a_y"]),
+            b(json["b"])
+        { }
+
+        static size_t MaxOperations(void) { return 5; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        inline bool operator==(const ECC_Point_Mul& rhs) const {
+            return
+                (curveType == rhs.curveType) &&
+                (a == rhs.a) &&
+                (b == rhs.b) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            curveType.Serialize(ds);
+            a.Serialize(ds);
+            b.Serialize(ds);
+        }
+};
+
+class ECC_Point_Dbl : public Operation {
+    public:
+        const component::CurveType curveType;
+        const component::ECC_Point a;
+
+        ECC_Point_Dbl(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            curveType(ds),
+            a(ds)
+        { }
+        ECC_Point_Dbl(nlohmann::json json) :
+            Operation(json["modifier"]),
+            curveType(json["curveType"]),
+            a(json["a_x"], json["a_y"])
+        { }
+
+        static size_t MaxOperations(void) { return 5; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        inline bool operator==(const ECC_Point_Dbl& rhs) const {
+            return
+                (curveType == rhs.curveType) &&
+                (a == rhs.a) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            curveType.Serialize(ds);
+            a.Serialize(ds);
+        }
+};
+
+/* sum(scalars[i] * points[i]) */
+class ECC_MultiScalarMul : public Operation {
+    private:
+        static std::vector<component::ECC_Point> getPoints(Datasource& ds, const size_t numTerms);
+        static std::vector<component::ECC_Point> getPoints(nlohmann::json json);
+        static std::vector<component::Bignum> getScalars(Datasource& ds, const size_t numTerms);
+        static std::vector<component::Bignum> getScalars(nlohmann::json json, const size_t numTerms);
+    public:
+        static constexpr size_t MaxTerms = 16;
+
+        const component::CurveType curveType;
+        const std::vector<component::ECC_Point> points;
+        const std::vector<component::Bignum> scalars;
+
+        ECC_MultiScalarMul(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            curveType(ds),
+            points(getPoints(ds, ds.Get<uint8_t>() % (MaxTerms + 1))),
+            scalars(getScalars(ds, points.size()))
+        { }
+        ECC_MultiScalarMul(nlohmann::json json) :
+            Operation(json["modifier"]),
+            curveType(json["curveType"]),
+            points(getPoints(json["points"])),
+            scalars(getScalars(json["scalars"], points.size()))
+        { }
+
+        static size_t MaxOperations(void) { return 5; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        inline bool operator==(const ECC_MultiScalarMul& rhs) const {
+            return
+                (curveType == rhs.curveType) &&
+                (points == rhs.points) &&
+                (scalars == rhs.scalars) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            curveType.Serialize(ds);
+            ds.Put<uint8_t>(points.size());
+            for (const auto& point : points) {
+                point.Serialize(ds);
+            }
+            for (const auto& scalar : scalars) {
+                scalar.Serialize(ds);
+            }
+        }
+};
+
 class DH_GenerateKeyPair : public Operation {
     public:
         const component::Bignum prime;
@@ -1326,5 +1508,236 @@ class BignumCalc : public Operation {
         }
 };
 
+class BignumCalcLarge : public Operation {
+    public:
+        const component::CalcOp calcOp;
+        const component::LargeBignum bn0;
+        const component::LargeBignum bn1;
+        const component::LargeBignum bn2;
+
+        BignumCalcLarge(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            calcOp(ds),
+            bn0(ds),
+            bn1(ds),
+            bn2(ds)
+        { }
+        BignumCalcLarge(nlohmann::json json) :
+            Operation(json["modifier"]),
+            calcOp(json["calcOp"]),
+            bn0(json["bn0"]),
+            bn1(json["bn1"]),
+            bn2(json["bn2"])
+        { }
+
+        static size_t MaxOperations(void) { return 2; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        inline bool operator==(const BignumCalcLarge& rhs) const {
+            return
+                (calcOp == rhs.calcOp) &&
+                (bn0 == rhs.bn0) &&
+                (bn1 == rhs.bn1) &&
+                (bn2 == rhs.bn2) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            calcOp.Serialize(ds);
+            bn0.Serialize(ds);
+            bn1.Serialize(ds);
+            bn2.Serialize(ds);
+        }
+};
+
+class BignumCalcSequence : public Operation {
+    private:
+        static std::vector<component::Bignum> getRegisters(Datasource& ds);
+        static std::vector<component::Bignum> getRegisters(nlohmann::json json);
+        static std::vector<component::BignumInstruction> getProgram(Datasource& ds);
+        static std::vector<component::BignumInstruction> getProgram(nlohmann::json json);
+    public:
+        static constexpr size_t MaxInstructions = 32;
+
+        const std::vector<component::Bignum> registers;
+        const std::vector<component::BignumInstruction> program;
+
+        BignumCalcSequence(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            registers(getRegisters(ds)),
+            program(getProgram(ds))
+        { }
+        BignumCalcSequence(nlohmann::json json) :
+            Operation(json["modifier"]),
+            registers(getRegisters(json["registers"])),
+            program(getProgram(json["program"]))
+        { }
+
+        static size_t MaxOperations(void) { return 2; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        inline bool operator==(const BignumCalcSequence& rhs) const {
+            return
+                (registers == rhs.registers) &&
+                (program == rhs.program) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            for (const auto& r : registers) {
+                r.Serialize(ds);
+            }
+            ds.Put<uint8_t>(program.size());
+            for (const auto& instr : program) {
+                instr.Serialize(ds);
+            }
+        }
+};
+
+class DigestStream : public Operation {
+    public:
+        const component::VirtualCleartext cleartext;
+        const component::DigestType digestType;
+
+        DigestStream(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            cleartext(ds),
+            digestType(ds)
+        { }
+
+        DigestStream(nlohmann::json json) :
+            Operation(json["modifier"]),
+            cleartext(json["cleartext"]),
+            digestType(json["digestType"])
+        { }
+
+
+        static size_t MaxOperations(void) { return 2; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        std::string GetAlgorithmString(void) const override {
+            return repository::DigestToString(digestType.Get());
+        }
+        inline bool operator==(const DigestStream& rhs) const {
+            return
+                (cleartext == rhs.cleartext) &&
+                (digestType == rhs.digestType) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            cleartext.Serialize(ds);
+            digestType.Serialize(ds);
+        }
+};
+
+class HMACStream : public Operation {
+    public:
+        const component::VirtualCleartext cleartext;
+        const component::DigestType digestType;
+        const component::SymmetricCipher cipher;
+
+        HMACStream(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            cleartext(ds),
+            digestType(ds),
+            cipher(ds)
+        { }
+        HMACStream(nlohmann::json json) :
+            Operation(json["modifier"]),
+            cleartext(json["cleartext"]),
+            digestType(json["digestType"]),
+            cipher(json["cipher"])
+        { }
+
+        static size_t MaxOperations(void) { return 2; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        std::string GetAlgorithmString(void) const override {
+            return repository::DigestToString(digestType.Get());
+        }
+        inline bool operator==(const HMACStream& rhs) const {
+            return
+                (cleartext == rhs.cleartext) &&
+                (digestType == rhs.digestType) &&
+                (cipher == rhs.cipher) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            cleartext.Serialize(ds);
+            digestType.Serialize(ds);
+            cipher.Serialize(ds);
+        }
+};
+
+/* The result of this operation is the SHA-256 hash of the ciphertext
+ * stream, plus the tag if one was requested.
+ */
+class SymmetricEncryptStream : public Operation {
+    public:
+        const component::VirtualCleartext cleartext;
+        const component::SymmetricCipher cipher;
+        const std::optional<component::AAD> aad;
+        const std::optional<uint64_t> tagSize;
+
+        SymmetricEncryptStream(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            cleartext(ds),
+            cipher(ds),
+            aad(ds.Get<bool>() ? std::nullopt : std::make_optional<component::AAD>(ds)),
+            tagSize( ds.Get<bool>() ?
+                    std::nullopt :
+                    std::make_optional<uint64_t>(ds.Get<uint64_t>() % (10*1024*1024)) )
+        { }
+        SymmetricEncryptStream(nlohmann::json json) :
+            Operation(json["modifier"]),
+            cleartext(json["cleartext"]),
+            cipher(json["cipher"]),
+            aad(
+                    json["aad_enabled"].get<bool>() ?
+                        std::optional<component::AAD>(json["aad"]) :
+                        std::optional<component::AAD>(std::nullopt)
+            ),
+            tagSize(
+                    json["tagSize_enabled"].get<bool>() ?
+                        std::optional<uint64_t>(json["tagSize"].get<uint64_t>()) :
+                        std::optional<uint64_t>(std::nullopt)
+            )
+        { }
+
+        static size_t MaxOperations(void) { return 2; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        std::string GetAlgorithmString(void) const override {
+            return repository::CipherToString(cipher.cipherType.Get());
+        }
+        inline bool operator==(const SymmetricEncryptStream& rhs) const {
+            return
+                (cleartext == rhs.cleartext) &&
+                (cipher == rhs.cipher) &&
+                (aad == rhs.aad) &&
+                (tagSize == rhs.tagSize) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            cleartext.Serialize(ds);
+            cipher.Serialize(ds);
+            if ( aad == std::nullopt ) {
+                ds.Put<bool>(true);
+            } else {
+                ds.Put<bool>(false);
+                aad->Serialize(ds);
+            }
+            if ( tagSize == std::nullopt ) {
+                ds.Put<bool>(true);
+            } else {
+                ds.Put<bool>(false);
+                ds.Put<>(*tagSize);
+            }
+        }
+};
+
 } /* namespace operation */
 } /* namespace cryptofuzz */
@@ -8,6 +8,8 @@
 
 namespace cryptofuzz {
 
+class ResultDB;
+
 class Options {
     private:
         std::vector<std::string> arguments;
@@ -23,11 +25,29 @@ class Options {
         std::optional<uint64_t> forceModule = std::nullopt;
         std::optional<std::vector<uint64_t>> disableModules = std::nullopt;
         std::optional<FILE*> jsonDumpFP = std::nullopt;
+        std::optional<ResultDB*> recordResults = std::nullopt;
+        std::optional<ResultDB*> replayResults = std::nullopt;
         size_t minModules = 1;
+        uint64_t maxStreamSize = 1024 * 1024;
+        size_t maxLargeBignumBits = 65536;
+        /* Products of 64 bit limbs a BignumCalcLarge operation may take */
+        uint64_t maxLargeBignumCost = 1024 * 1024;
         bool debug = false;
         bool disableTests = false;
         bool noDecrypt = false;
         bool noCompare = false;
+        /* Feed module RNGs from a stream derived from the operation */
+        bool deterministicRNG = false;
+        /* Reuse the results of deterministic module calls */
+        bool resultCache = false;
+        /* Re-execute one in this many cache hits */
+        size_t resultCacheCheck = 16;
+        /* Cryptofuzz binaries whose modules run in child processes */
+        std::optional<std::vector<std::string>> remoteModules = std::nullopt;
+        /* Module plugins (shared objects) to load */
+        std::optional<std::vector<std::string>> loadModules = std::nullopt;
+        /* Set in child processes started for --remote-modules */
+        std::optional<int> hostFD = std::nullopt;
 };
 
 } /* namespace cryptofuzz */
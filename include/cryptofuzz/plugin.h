@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cryptofuzz/module.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* A plugin is a shared object which exports the functions below; they are
+ * implemented by plugin_entry.cpp. Only serialized operations and results
+ * cross the boundary, because the plugin has its own copy of the C and C++
+ * runtime in its link map namespace.
+ */
+#define CF_PLUGIN_ABI_VERSION 2
+
+extern "C" {
+    typedef uint32_t (*cryptofuzz_plugin_abi_t)(void);
+    /* The sanitizer coverage callbacks of the fuzzer, which the plugin cannot see */
+    typedef void (*cryptofuzz_plugin_counters_init_t)(uint8_t* start, uint8_t* stop);
+    typedef void (*cryptofuzz_plugin_pcs_init_t)(const uintptr_t* start, const uintptr_t* stop);
+    /* Passes the plugin's coverage counters and PC tables to the callbacks,
+     * either of which may be nullptr. Called once, after loading.
+     */
+    typedef void (*cryptofuzz_plugin_init_t)(cryptofuzz_plugin_counters_init_t countersInit, cryptofuzz_plugin_pcs_init_t pcsInit);
+    /* Returns the modules as serialized by remote::Describe() */
+    typedef int (*cryptofuzz_plugin_describe_t)(uint8_t** out, size_t* outSize);
+    /* Executes a request produced by remote::RemoteModule; returns 1 if there is a result */
+    typedef int (*cryptofuzz_plugin_call_t)(const uint8_t* request, const size_t requestSize, uint8_t** out, size_t* outSize);
+    /* Releases memory returned by the functions above */
+    typedef void (*cryptofuzz_plugin_free_t)(uint8_t* p);
+}
+
+namespace cryptofuzz {
+namespace plugin {
+
+/* Loads the shared object into a new link map namespace, and returns
+ * proxies for the modules it offers. A module whose name is already in
+ * use is loaded as name@file, or as name@path if that is in use too, so
+ * that two builds of the same library can be compared. Exits on failure,
+ * including if neither name is free.
+ */
+std::vector<std::shared_ptr<Module>> Load(
+        const std::string& path,
+        const std::map<uint64_t, std::shared_ptr<Module> >& loaded);
+
+} /* namespace plugin */
+} /* namespace cryptofuzz */
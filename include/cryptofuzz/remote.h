@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cryptofuzz/components.h>
+#include <cryptofuzz/module.h>
+#include <cryptofuzz/operations.h>
+#include <cstddef>
+#include <cstdint>
+#include <fuzzing/datasource/datasource.hpp>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+namespace cryptofuzz {
+namespace remote {
+
+/* Every operation a module can implement, as (result type, operation name) */
+#define CF_REMOTE_OPERATIONS(X) \
+    X(component::Digest, Digest) \
+    X(component::MAC, HMAC) \
+    X(component::Ciphertext, SymmetricEncrypt) \
+    X(component::Cleartext, SymmetricDecrypt) \
+    X(component::Key, KDF_SCRYPT) \
+    X(component::Key, KDF_HKDF) \
+    X(component::Key, KDF_TLS1_PRF) \
+    X(component::Key, KDF_PBKDF) \
+    X(component::Key, KDF_PBKDF1) \
+    X(component::Key, KDF_PBKDF2) \
+    X(component::Key, KDF_ARGON2) \
+    X(component::Key, KDF_SSH) \
+    X(component::Key, KDF_X963) \
+    X(component::Key, KDF_BCRYPT) \
+    X(component::Key, KDF_SP_800_108) \
+    X(component::MAC, CMAC) \
+    X(component::Signature, Sign) \
+    X(bool, Verify) \
+    X(component::ECC_PublicKey, ECC_PrivateToPublic) \
+    X(bool, ECC_ValidatePubkey) \
+    X(component::ECC_KeyPair, ECC_GenerateKeyPair) \
+    X(component::ECDSA_Signature, ECDSA_Sign) \
+    X(bool, ECDSA_Verify) \
+    X(component::Secret, ECDH_Derive) \
+    X(component::Ciphertext, ECIES_Encrypt) \
+    X(component::ECC_Point, ECC_Point_Add) \
+    X(component::ECC_Point, ECC_Point_Mul) \
+    X(component::ECC_Point, ECC_Point_Dbl) \
+    X(component::ECC_Point, ECC_MultiScalarMul) \
+    X(component::DH_KeyPair, DH_GenerateKeyPair) \
+    X(component::Bignum, DH_Derive) \
+    X(component::Bignum, BignumCalc) \
+    X(component::LargeBignum, BignumCalcLarge) \
+    X(component::BignumTrace, BignumCalcSequence) \
+    X(component::Digest, DigestStream) \
+    X(component::MAC, HMACStream) \
+    X(component::Ciphertext, SymmetricEncryptStream)
+
+/* Shared memory queue of messages, defined in remote.cpp */
+struct Ring;
+
+struct ModuleInfo {
+    std::string name;
+    bool deterministic;
+};
+
+/* Executes serialized operations on modules outside of this binary */
+class Channel {
+    public:
+        virtual ~Channel() { }
+
+        /* Starts executing the request without waiting for the response */
+        virtual void Submit(const std::vector<uint8_t>& request) {
+            (void)request;
+        }
+        /* Returns the serialized result, or nullopt if the module produced none */
+        virtual std::optional<std::vector<uint8_t>> Call(const std::vector<uint8_t>& request) = 0;
+        /* Discards the responses to submitted requests that were not claimed by Call() */
+        virtual void Flush(void) { }
+        virtual const std::string& GetPath(void) const = 0;
+};
+
+/* A child process which runs the modules of another cryptofuzz binary.
+ *
+ * Requests and responses travel through two single-producer
+ * single-consumer rings in a shared memory region. The host processes
+ * requests in order, so multiple requests can be in flight at once.
+ */
+class Host : public Channel {
+    private:
+        const std::string path;
+        pid_t pid = -1;
+        Ring* requests = nullptr;
+        Ring* responses = nullptr;
+
+        uint64_t sent = 0;
+        uint64_t received = 0;
+
+        /* Requests which have been sent but not claimed by Call() */
+        std::map<std::vector<uint8_t>, uint64_t> pending;
+        /* Responses which have been received but not claimed by Call() */
+        std::map<uint64_t, std::optional<std::vector<uint8_t>>> unclaimed;
+
+        std::optional<uint64_t> send(const std::vector<uint8_t>& request);
+        std::vector<uint8_t> receive(void);
+        void checkAlive(void) const;
+    public:
+        Host(const std::string path);
+        ~Host();
+        Host(const Host&) = delete;
+        Host& operator=(const Host&) = delete;
+
+        /* Spawns the process; returns the modules it offers, or nullopt on failure */
+        std::optional<std::vector<ModuleInfo>> Start(void);
+
+        void Submit(const std::vector<uint8_t>& request) override;
+        std::optional<std::vector<uint8_t>> Call(const std::vector<uint8_t>& request) override;
+        /* Waits for all requests in flight */
+        void Flush(void) override;
+        const std::string& GetPath(void) const override;
+};
+
+/* Proxy for a module which is reached through a Channel */
+class RemoteModule : public Module {
+    private:
+        const std::shared_ptr<Channel> channel;
+        const bool deterministic;
+        /* The ID of the module on the other side, which may be loaded under another name here */
+        const uint64_t remoteID;
+
+        template <class OperationType>
+        std::vector<uint8_t> encode(const uint64_t operationID, const OperationType& op) const {
+            fuzzing::datasource::Datasource ds(nullptr, 0);
+
+            ds.Put<uint64_t>(remoteID);
+            ds.Put<uint64_t>(operationID);
+            op.modifier.Serialize(ds);
+            op.Serialize(ds);
+
+            return ds.GetOut();
+        }
+
+        template <class ResultType>
+        std::optional<ResultType> call(const std::vector<uint8_t>& request);
+    public:
+        RemoteModule(const ModuleInfo& info, std::shared_ptr<Channel> channel, const std::string name);
+
+        bool IsDeterministic(void) const override;
+
+        /* Dispatches the operation to the host ahead of the corresponding Op* call */
+        template <class OperationType>
+        void Submit(const uint64_t operationID, const OperationType& op) {
+            channel->Submit(encode(operationID, op));
+        }
+
+#define CF_REMOTE_DECLARE(ResultType, Name) \
+        std::optional<ResultType> Op##Name(operation::Name& op) override;
+        CF_REMOTE_OPERATIONS(CF_REMOTE_DECLARE)
+#undef CF_REMOTE_DECLARE
+};
+
+/* Spawns a host for the cryptofuzz binary at path, and returns proxies
+ * for the modules it offers
+ */
+std::vector<std::shared_ptr<Module>> Spawn(const std::string& path);
+
+/* Flushes all hosts */
+void Flush(void);
+
+/* Serializes the names and properties of the modules */
+std::vector<uint8_t> Describe(const std::map<uint64_t, std::shared_ptr<Module> >& modules);
+std::optional<std::vector<ModuleInfo>> ParseDescription(const std::vector<uint8_t>& description);
+
+/* Executes a request produced by RemoteModule on one of the modules.
+ * Returns the serialized result, or nullopt if there is none.
+ */
+std::optional<std::vector<uint8_t>> Execute(
+        const std::map<uint64_t, std::shared_ptr<Module> >& modules,
+        const uint8_t* request,
+        const size_t size);
+
+/* Serves the modules to the parent process over the shared memory region
+ * referred to by fd. Does not return.
+ */
+[[noreturn]] void Serve(const int fd, const std::map<uint64_t, std::shared_ptr<Module> >& modules);
+
+} /* namespace remote */
+} /* namespace cryptofuzz */
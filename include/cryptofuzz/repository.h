@@ -1,47 +1,74 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <fuzzing/datasource/id.hpp>
+#include <optional>
+#include <string>
 
 namespace cryptofuzz {
 namespace repository {
 
-bool IsCBC(const uint64_t id);
-bool IsCCM(const uint64_t id);
-bool IsCFB(const uint64_t id);
-bool IsCTR(const uint64_t id);
-bool IsECB(const uint64_t id);
-bool IsGCM(const uint64_t id);
-bool IsOCB(const uint64_t id);
-bool IsOFB(const uint64_t id);
-bool IsXTS(const uint64_t id);
-bool IsAEAD(const uint64_t id);
-bool IsWRAP(const uint64_t id);
-bool IsAES(const uint64_t id);
 std::string DigestToString(const uint64_t id);
 std::optional<uint64_t> DigestFromString(const std::string& s);
 std::string CipherToString(const uint64_t id);
+std::optional<uint64_t> CipherFromString(const std::string& s);
 std::string ECC_CurveToString(const uint64_t id);
 std::optional<uint64_t> ECC_CurveFromString(const std::string& s);
 std::optional<std::string> ECC_CurveToOrder(const uint64_t id);
+std::optional<std::string> ECC_CurveToPrime(const uint64_t id);
+std::optional<std::string> ECC_CurveToA(const uint64_t id);
+std::optional<std::string> ECC_CurveToB(const uint64_t id);
+std::optional<std::string> ECC_CurveToX(const uint64_t id);
+std::optional<std::string> ECC_CurveToY(const uint64_t id);
 std::string CalcOpToString(const uint64_t id);
-std::optional<size_t> DigestSize(const uint64_t id);
+
+/* Maps x to [0, n) */
+inline constexpr uint32_t LUTReduce(const uint64_t x, const uint32_t n) noexcept {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) * n) >> 32;
+}
+
+/* Looks up an ID in a table with the minimal perfect hash generated by
+ * gen_repository.py: the bucket of the ID selects a seed, which maps the ID
+ * to a slot holding the index of its entry. IDs that are not in the table
+ * map to some other entry, and are rejected by comparing the ID.
+ */
+template <typename LUT, size_t N, size_t B>
+inline constexpr long LUTIndex(const uint64_t id, const LUT (&lut)[N], const uint32_t (&seeds)[B], const uint16_t (&slots)[N]) noexcept {
+    const uint32_t seed = seeds[LUTReduce(id, B)];
+    const long index = slots[LUTReduce(((id ^ seed) * 0x9E3779B97F4A7C15ULL) >> 32, N)];
+
+    return lut[index].id == id ? index : -1;
+}
 
 #include "../../repository_tbl.h"
 
-template <typename LUT>
-inline constexpr long LUTCheck(const uint64_t id, const LUT* lut, const size_t lutSize) noexcept {
-    for (size_t i = 0; i < lutSize; i++) {
-        if ( lut[i].id == id ) {
-            return i;
-        }
-    }
+inline constexpr bool cipherHas(const uint64_t id, const uint16_t flag) noexcept {
+    const long index = CipherLUTIndex(id);
+    return index != -1 && (CipherLUT[index].flags & flag) != 0;
+}
 
-    return -1;
+inline constexpr bool IsCBC(const uint64_t id) noexcept { return cipherHas(id, CipherFlagCBC); }
+inline constexpr bool IsCCM(const uint64_t id) noexcept { return cipherHas(id, CipherFlagCCM); }
+inline constexpr bool IsCFB(const uint64_t id) noexcept { return cipherHas(id, CipherFlagCFB); }
+inline constexpr bool IsCTR(const uint64_t id) noexcept { return cipherHas(id, CipherFlagCTR); }
+inline constexpr bool IsECB(const uint64_t id) noexcept { return cipherHas(id, CipherFlagECB); }
+inline constexpr bool IsGCM(const uint64_t id) noexcept { return cipherHas(id, CipherFlagGCM); }
+inline constexpr bool IsOCB(const uint64_t id) noexcept { return cipherHas(id, CipherFlagOCB); }
+inline constexpr bool IsOFB(const uint64_t id) noexcept { return cipherHas(id, CipherFlagOFB); }
+inline constexpr bool IsXTS(const uint64_t id) noexcept { return cipherHas(id, CipherFlagXTS); }
+inline constexpr bool IsAEAD(const uint64_t id) noexcept { return cipherHas(id, CipherFlagAEAD); }
+inline constexpr bool IsWRAP(const uint64_t id) noexcept { return cipherHas(id, CipherFlagWRAP); }
+inline constexpr bool IsAES(const uint64_t id) noexcept { return cipherHas(id, CipherFlagAES); }
+
+inline constexpr std::optional<size_t> DigestSize(const uint64_t id) noexcept {
+    const long index = DigestLUTIndex(id);
+    return index == -1 ? std::nullopt : DigestLUT[index].size;
 }
 
 template <uint64_t id>
 constexpr long moduleIndex(void) {
-    constexpr long index = LUTCheck(id, ModuleLUT, sizeof(ModuleLUT) / sizeof(ModuleLUT[0]));
+    constexpr long index = ModuleLUTIndex(id);
     static_assert(-1 != index, "Not a valid module");
     return index;
 }
@@ -54,7 +81,7 @@ constexpr uint64_t Module(void) {
 
 template <uint64_t id>
 constexpr long operationIndex(void) {
-    constexpr long index = LUTCheck(id, OperationLUT, sizeof(OperationLUT) / sizeof(OperationLUT[0]));
+    constexpr long index = OperationLUTIndex(id);
     static_assert(-1 != index, "Not a valid operation");
     return index;
 }
@@ -67,7 +94,7 @@ constexpr uint64_t Operation(void) {
 
 template <uint64_t id>
 constexpr long digestIndex(void) {
-    constexpr long index = LUTCheck(id, DigestLUT, sizeof(DigestLUT) / sizeof(DigestLUT[0]));
+    constexpr long index = DigestLUTIndex(id);
     static_assert(-1 != index, "Not a valid digest");
     return index;
 }
@@ -80,7 +107,7 @@ constexpr uint64_t Digest(void) {
 
 template <uint64_t id>
 constexpr long cipherIndex(void) {
-    constexpr long index = LUTCheck(id, CipherLUT, sizeof(CipherLUT) / sizeof(CipherLUT[0]));
+    constexpr long index = CipherLUTIndex(id);
     static_assert(-1 != index, "Not a valid cipher");
     return index;
 }
@@ -93,7 +120,7 @@ constexpr uint64_t Cipher(void) {
 
 template <uint64_t id>
 constexpr long ecc_CurveIndex(void) {
-    constexpr long index = LUTCheck(id, ECC_CurveLUT, sizeof(ECC_CurveLUT) / sizeof(ECC_CurveLUT[0]));
+    constexpr long index = ECC_CurveLUTIndex(id);
     static_assert(-1 != index, "Not a valid ECC curve");
     return index;
 }
@@ -106,7 +133,7 @@ constexpr uint64_t ECC_Curve(void) {
 
 template <uint64_t id>
 constexpr long calcOpIndex(void) {
-    constexpr long index = LUTCheck(id, CalcOpLUT, sizeof(CalcOpLUT) / sizeof(CalcOpLUT[0]));
+    constexpr long index = CalcOpLUTIndex(id);
     static_assert(-1 != index, "Not a valid calculation operation");
     return index;
 }
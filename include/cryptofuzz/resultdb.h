@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace cryptofuzz {
+
+/* On-disk hash index from (module, operation) to a fingerprint of the result.
+ *
+ * The file is a header followed by a fixed number of slots, probed
+ * linearly, and is accessed through mmap so that lookups do not need to
+ * read the whole database. Concurrent recorders claim slots atomically.
+ */
+class ResultDB {
+    public:
+        using Key = std::array<uint8_t, 16>;
+        using Fingerprint = std::array<uint8_t, 16>;
+
+        static constexpr uint64_t DefaultNumSlots = 1ULL << 22;
+    private:
+        struct Header {
+            uint8_t magic[8];
+            uint64_t numSlots;
+        };
+
+        struct Slot {
+            /* 0 if the slot is unused */
+            uint64_t tag;
+            uint8_t key[8];
+            uint8_t fingerprint[16];
+        };
+
+        void* map = nullptr;
+        size_t mapSize = 0;
+        Header* header = nullptr;
+        Slot* slots = nullptr;
+        const bool writable;
+
+        ResultDB(const bool writable);
+
+        static uint64_t tagOf(const Key& key);
+        static bool create(const std::string& path, const uint64_t numSlots);
+    public:
+        ~ResultDB();
+        ResultDB(const ResultDB&) = delete;
+        ResultDB& operator=(const ResultDB&) = delete;
+
+        /* Creates the database if it does not exist and writable is true.
+         * Returns nullptr on failure.
+         */
+        static ResultDB* Open(const std::string& path, const bool writable, const uint64_t numSlots = DefaultNumSlots);
+
+        /* Returns false if the database is full */
+        bool Put(const Key& key, const Fingerprint& fingerprint);
+        std::optional<Fingerprint> Get(const Key& key) const;
+};
+
+} /* namespace cryptofuzz */
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cryptofuzz {
+namespace rng {
+
+/* While a Scope exists, Generate() produces a deterministic stream of bytes
+ * derived from the seed. Modules route their library's random number
+ * generator through Generate(), so that every module consumes the same
+ * stream when it runs a randomized operation.
+ */
+class Scope {
+    public:
+        Scope(const std::vector<uint8_t>& seed);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        /* Number of bytes drawn from the stream so far */
+        uint64_t Consumed(void) const;
+};
+
+bool Active(void);
+
+/* Returns false if no Scope exists, in which case the caller should
+ * fall back to the library's own random number generator
+ */
+bool Generate(uint8_t* out, const size_t size);
+
+} /* namespace rng */
+} /* namespace cryptofuzz */
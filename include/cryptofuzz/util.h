@@ -30,6 +30,23 @@ Multipart ToParts(fuzzing::datasource::Datasource& ds, const Buffer& buffer);
 Multipart ToParts(fuzzing::datasource::Datasource& ds, const uint8_t* data, const size_t size);
 Multipart ToEqualParts(const Buffer& buffer, const size_t partSize);
 Multipart ToEqualParts(const uint8_t* data, const size_t size, const size_t partSize);
+
+/* Yields a VirtualCleartext in parts whose sizes are chosen by the datasource.
+ * Only the current part is held in memory.
+ */
+class VirtualParts {
+    private:
+        fuzzing::datasource::Datasource& ds;
+        const component::VirtualCleartext& cleartext;
+        uint64_t offset = 0;
+        std::vector<uint8_t> part;
+    public:
+        static constexpr size_t MaxPartSize = 1024 * 1024;
+
+        VirtualParts(fuzzing::datasource::Datasource& ds, const component::VirtualCleartext& cleartext);
+        std::optional< std::pair<const uint8_t*, size_t> > Next(void);
+};
+
 std::vector<uint8_t> Pkcs7Pad(std::vector<uint8_t> in, const size_t blocksize);
 std::optional<std::vector<uint8_t>> Pkcs7Unpad(std::vector<uint8_t> in, const size_t blocksize);
 std::string ToString(const Buffer& buffer);
@@ -39,6 +56,7 @@ std::string ToString(const component::ECC_PublicKey& val);
 std::string ToString(const component::ECC_KeyPair& val);
 std::string ToString(const component::ECDSA_Signature& val);
 std::string ToString(const component::Bignum& val);
+std::string ToString(const component::BignumTrace& val);
 nlohmann::json ToJSON(const Buffer& buffer);
 nlohmann::json ToJSON(const bool val);
 nlohmann::json ToJSON(const component::Ciphertext& val);
@@ -46,6 +64,7 @@ nlohmann::json ToJSON(const component::ECC_PublicKey& val);
 nlohmann::json ToJSON(const component::ECC_KeyPair& val);
 nlohmann::json ToJSON(const component::ECDSA_Signature& val);
 nlohmann::json ToJSON(const component::Bignum& val);
+nlohmann::json ToJSON(const component::BignumTrace& val);
 uint8_t* GetNullPtr(fuzzing::datasource::Datasource* ds = nullptr);
 uint8_t* malloc(const size_t n);
 uint8_t* realloc(void* ptr, const size_t n);
@@ -1,18 +1,43 @@
 #pragma once
 
 #include "../../third_party/json/json.hpp"
+#include <cryptofuzz/corpus.h>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <fuzzing/datasource/datasource.hpp>
 
 namespace cryptofuzz {
 
+/* Converts a Wycheproof test vector file into corpus inputs.
+ *
+ * The file is parsed as a stream: each test group is handed to a worker
+ * thread as soon as it has been read, and then discarded, so only a few
+ * groups are held in memory at any time.
+ */
 class Wycheproof {
     private:
-        nlohmann::json j;
+        using Handler = void (Wycheproof::*)(const nlohmann::json& group);
+
+        const std::string filename;
         const std::string outDir;
-        void ECDSA_Verify(const nlohmann::json& groups);
-        void EDDSA_Verify(const nlohmann::json& groups);
+        /* Set if outDir is a packed corpus (ends in .pack) */
+        std::unique_ptr<PackedCorpusWriter> packedCorpus;
+        std::mutex writeMutex;
+        /* Top-level "algorithm" of the file */
+        std::string algorithm;
+
+        static Handler handlerFor(const std::string& schema);
+
+        void ECDSA_Verify(const nlohmann::json& group);
+        void EDDSA_Verify(const nlohmann::json& group);
+        void Symmetric(const nlohmann::json& group);
+        void MAC(const nlohmann::json& group);
+        void HKDF(const nlohmann::json& group);
+        void ECDH(const nlohmann::json& group);
+        void Primality(const nlohmann::json& group);
         void write(const uint64_t operation, fuzzing::datasource::Datasource& dsOut2);
+        template <class T> void write(const uint64_t operation, const T& op);
     public:
         Wycheproof(const std::string filename, const std::string outDir);
         void Run(void);
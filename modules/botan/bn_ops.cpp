@@ -1,8 +1,12 @@
 #include <cryptofuzz/util.h>
 #include <cryptofuzz/repository.h>
+#include <cryptofuzz/lru.h>
 #include <fuzzing/datasource/id.hpp>
+#include <botan/monty.h>
 #include <botan/numthry.h>
+#include <botan/pow_mod.h>
 #include <botan/reducer.h>
+#include <memory>
 
 #include "bn_ops.h"
 
@@ -10,6 +14,36 @@ namespace cryptofuzz {
 namespace module {
 namespace Botan_bignum {
 
+namespace Botan_bignum_detail {
+    /* Montgomery arithmetic requires an odd modulus larger than 1 */
+    static bool isMontgomeryModulus(const ::Botan::BigInt& mod) {
+        return mod >= 3 && mod.is_odd();
+    }
+
+    /* Precomputed state for recently used moduli */
+    static std::shared_ptr<const ::Botan::Montgomery_Params> getMontgomeryParams(const ::Botan::BigInt& mod) {
+        static LRUCache<::Botan::BigInt, std::shared_ptr<const ::Botan::Montgomery_Params>, 16> cache;
+
+        auto cached = cache.Get(mod);
+        if ( cached != nullptr ) {
+            return *cached;
+        }
+
+        return cache.Put(mod, std::make_shared<const ::Botan::Montgomery_Params>(mod));
+    }
+
+    static ::Botan::Power_Mod& getPowerMod(const ::Botan::BigInt& mod) {
+        static LRUCache<::Botan::BigInt, std::unique_ptr<::Botan::Power_Mod>, 16> cache;
+
+        auto cached = cache.Get(mod);
+        if ( cached != nullptr ) {
+            return **cached;
+        }
+
+        return *cache.Put(mod, std::make_unique<::Botan::Power_Mod>(mod));
+    }
+}
+
 bool Add::Run(Datasource& ds, ::Botan::BigInt& res, std::vector<::Botan::BigInt>& bn) const {
     (void)ds;
 
@@ -49,14 +83,33 @@ bool Mod::Run(Datasource& ds, ::Botan::BigInt& res, std::vector<::Botan::BigInt>
 }
 
 bool ExpMod::Run(Datasource& ds, ::Botan::BigInt& res, std::vector<::Botan::BigInt>& bn) const {
-    (void)ds;
-
     /* Exponent and modulus must be positive, according to the documentation */
     if ( bn[1] <= 0 || bn[2] <= 0 ) {
         return false;
     }
 
-    res = ::Botan::power_mod(bn[0], bn[1], bn[2]);
+    switch ( ds.Get<uint8_t>() ) {
+        case    0:
+            res = ::Botan::power_mod(bn[0], bn[1], bn[2]);
+            break;
+        case    1:
+            {
+                if ( !Botan_bignum_detail::isMontgomeryModulus(bn[2]) ) {
+                    return false;
+                }
+                if ( bn[0] <= 0 || bn[0] >= bn[2] ) {
+                    return false;
+                }
+
+                auto& powMod = Botan_bignum_detail::getPowerMod(bn[2]);
+                powMod.set_base(bn[0]);
+                powMod.set_exponent(bn[1]);
+                res = powMod.execute();
+            }
+            break;
+        default:
+            return false;
+    }
 
     return true;
 }
@@ -97,6 +150,20 @@ bool SqrMod::Run(Datasource& ds, ::Botan::BigInt& res, std::vector<::Botan::BigI
             case    1:
                 res = ::Botan::square(bn[0]) % bn[1];
                 break;
+            case    2:
+                {
+                    if ( !Botan_bignum_detail::isMontgomeryModulus(bn[1]) ) {
+                        return false;
+                    }
+                    if ( bn[0].is_negative() || bn[0] >= bn[1] ) {
+                        return false;
+                    }
+
+                    ::Botan::secure_vector<::Botan::word> ws;
+                    const ::Botan::Montgomery_Int A(Botan_bignum_detail::getMontgomeryParams(bn[1]), bn[0]);
+                    res = A.square(ws).value();
+                }
+                break;
             default:
                 return false;
         }
@@ -248,6 +315,24 @@ bool MulMod::Run(Datasource& ds, ::Botan::BigInt& res, std::vector<::Botan::BigI
         case    1:
             res = (bn[0] * bn[1]) % bn[2];
             break;
+        case    2:
+            {
+                if ( !Botan_bignum_detail::isMontgomeryModulus(bn[2]) ) {
+                    return false;
+                }
+                if ( bn[0].is_negative() || bn[0] >= bn[2] ) {
+                    return false;
+                }
+                if ( bn[1].is_negative() || bn[1] >= bn[2] ) {
+                    return false;
+                }
+
+                const auto params = Botan_bignum_detail::getMontgomeryParams(bn[2]);
+                const ::Botan::Montgomery_Int A(params, bn[0]);
+                const ::Botan::Montgomery_Int B(params, bn[1]);
+                res = (A * B).value();
+            }
+            break;
         default:
             return false;
     }
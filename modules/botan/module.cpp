@@ -1,6 +1,8 @@
 #include "module.h"
 #include <cryptofuzz/util.h>
 #include <cryptofuzz/repository.h>
+#include <cryptofuzz/crypto.h>
+#include <cryptofuzz/rng.h>
 #include <botan/ber_dec.h>
 #include <botan/bigint.h>
 #include <botan/cipher_mode.h>
@@ -10,7 +12,9 @@
 #include <botan/hash.h>
 #include <botan/kdf.h>
 #include <botan/mac.h>
+#include <botan/numthry.h>
 #include <botan/pbkdf.h>
+#include <botan/point_gfp.h>
 #include <botan/pubkey.h>
 #include <botan/pwdhash.h>
 #include <botan/system_rng.h>
@@ -27,6 +31,37 @@ Botan::Botan(void) :
 }
 
 namespace Botan_detail {
+    /* Draws from the deterministic stream if there is one */
+    class RNG : public ::Botan::RandomNumberGenerator {
+        private:
+            ::Botan::System_RNG system;
+        public:
+            std::string name() const override {
+                return "Cryptofuzz";
+            }
+
+            void randomize(uint8_t output[], size_t length) override {
+                if ( rng::Generate(output, length) == false ) {
+                    system.randomize(output, length);
+                }
+            }
+
+            bool accepts_input() const override {
+                return false;
+            }
+
+            void add_entropy(const uint8_t input[], size_t length) override {
+                (void)input;
+                (void)length;
+            }
+
+            bool is_seeded() const override {
+                return true;
+            }
+
+            void clear() override { }
+    };
+
     const std::string parenthesize(const std::string parent, const std::string child) {
         static const std::string pOpen("(");
         static const std::string pClose(")");
@@ -334,6 +369,132 @@ std::optional<component::Cleartext> Botan::OpSymmetricDecrypt(operation::Symmetr
     return Botan_detail::Crypt<component::Cleartext, operation::SymmetricDecrypt>(op);
 }
 
+std::optional<component::Digest> Botan::OpDigestStream(operation::DigestStream& op) {
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+    std::optional<component::Digest> ret = std::nullopt;
+    std::unique_ptr<::Botan::HashFunction> hash = nullptr;
+    util::VirtualParts parts(ds, op.cleartext);
+
+    /* Initialize */
+    {
+        std::optional<std::string> algoString;
+        CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.digestType.Get()), std::nullopt);
+        CF_CHECK_NE(hash = ::Botan::HashFunction::create(*algoString), nullptr);
+    }
+
+    /* Process */
+    while ( const auto part = parts.Next() ) {
+        hash->update(part->first, part->second);
+    }
+
+    /* Finalize */
+    {
+        const auto res = hash->final();
+        ret = component::Digest(res.data(), res.size());
+    }
+
+end:
+
+    return ret;
+}
+
+std::optional<component::MAC> Botan::OpHMACStream(operation::HMACStream& op) {
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+    std::optional<component::MAC> ret = std::nullopt;
+    std::unique_ptr<::Botan::MessageAuthenticationCode> hmac = nullptr;
+    util::VirtualParts parts(ds, op.cleartext);
+
+    try {
+        /* Initialize */
+        {
+            std::optional<std::string> algoString;
+            CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.digestType.Get(), true, true), std::nullopt);
+
+            std::string hmacString;
+            if (
+                    op.digestType.Is(CF_DIGEST("SIPHASH64")) ||
+                    op.digestType.Is(CF_DIGEST("BLAKE2B_MAC")) ) {
+                hmacString = *algoString;
+            } else {
+                hmacString = Botan_detail::parenthesize("HMAC", *algoString);
+            }
+
+            CF_CHECK_NE(hmac = ::Botan::MessageAuthenticationCode::create(hmacString), nullptr);
+
+            try {
+                hmac->set_key(op.cipher.key.GetPtr(), op.cipher.key.GetSize());
+            } catch ( ... ) {
+                goto end;
+            }
+        }
+
+        /* Process */
+        while ( const auto part = parts.Next() ) {
+            hmac->update(part->first, part->second);
+        }
+
+        /* Finalize */
+        {
+            const auto res = hmac->final();
+            ret = component::MAC(res.data(), res.size());
+        }
+
+    } catch ( ... ) { }
+end:
+
+    return ret;
+}
+
+std::optional<component::Ciphertext> Botan::OpSymmetricEncryptStream(operation::SymmetricEncryptStream& op) {
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+    std::optional<component::Ciphertext> ret = std::nullopt;
+    std::unique_ptr<::Botan::Cipher_Mode> crypt = nullptr;
+    const ::Botan::SymmetricKey key(op.cipher.key.GetPtr(), op.cipher.key.GetSize());
+    const ::Botan::InitializationVector iv(op.cipher.iv.GetPtr(), op.cipher.iv.GetSize());
+    util::VirtualParts parts(ds, op.cleartext);
+    crypto::sha256_stream ciphertextHash;
+    std::vector<uint8_t> tmp;
+
+    /* AEAD output (tag appended by finish()) is not comparable to the other modules */
+    CF_CHECK_FALSE(repository::IsAEAD(op.cipher.cipherType.Get()));
+    CF_CHECK_EQ(op.aad, std::nullopt);
+    CF_CHECK_EQ(op.tagSize, std::nullopt);
+
+    try {
+        /* Initialize */
+        {
+            std::optional<std::string> algoString;
+            CF_CHECK_NE(algoString = Botan_detail::CipherIDToString(op.cipher.cipherType.Get()), std::nullopt);
+            CF_CHECK_NE(crypt = ::Botan::Cipher_Mode::create(*algoString, ::Botan::ENCRYPTION), nullptr);
+
+            /* Only modes which can process arbitrarily sized parts */
+            CF_CHECK_EQ(crypt->update_granularity(), 1);
+
+            crypt->set_key(key);
+            crypt->start(iv.bits_of());
+        }
+
+        /* Process */
+        while ( const auto part = parts.Next() ) {
+            tmp.assign(part->first, part->first + part->second);
+            crypt->process(tmp.data(), tmp.size());
+            ciphertextHash.update(tmp.data(), tmp.size());
+        }
+
+        /* Finalize */
+        {
+            ::Botan::secure_vector<uint8_t> remainder;
+            crypt->finish(remainder);
+            ciphertextHash.update(remainder.data(), remainder.size());
+
+            ret = component::Ciphertext(Buffer(ciphertextHash.finalize()));
+        }
+    } catch ( ... ) { }
+end:
+
+    return ret;
+}
+
 std::optional<component::Key> Botan::OpKDF_SCRYPT(operation::KDF_SCRYPT& op) {
     std::optional<component::Key> ret = std::nullopt;
     std::unique_ptr<::Botan::PasswordHashFamily> pwdhash_fam = nullptr;
@@ -646,7 +807,7 @@ std::optional<component::ECC_KeyPair> Botan::OpECC_GenerateKeyPair(operation::EC
     std::optional<component::ECC_KeyPair> ret = std::nullopt;
 
     std::optional<std::string> curveString;
-    static ::Botan::System_RNG rng;
+    static Botan_detail::RNG rng;
 
     CF_CHECK_NE(curveString = Botan_detail::CurveIDToString(op.curveType.Get()), std::nullopt);
 
@@ -668,7 +829,7 @@ std::optional<component::ECC_PublicKey> Botan::OpECC_PrivateToPublic(operation::
     std::optional<component::ECC_PublicKey> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
-    static ::Botan::System_RNG rng;
+    static Botan_detail::RNG rng;
     try {
         std::optional<std::string> curveString;
 
@@ -717,7 +878,7 @@ std::optional<component::ECDSA_Signature> Botan::OpECDSA_Sign(operation::ECDSA_S
     std::unique_ptr<::Botan::Public_Key> pub = nullptr;
     std::unique_ptr<::Botan::PK_Signer> signer;
 
-    static ::Botan::System_RNG rng;
+    static Botan_detail::RNG rng;
 
     CF_CHECK_EQ(op.UseRFC6979Nonce(), true);
     CF_CHECK_EQ(op.digestType.Get(), CF_DIGEST("SHA256"));
@@ -854,11 +1015,118 @@ end:
     return ret;
 }
 
+namespace Botan_detail {
+    /* Throws if the point is not on the curve */
+    ::Botan::PointGFp LoadPoint(Datasource& ds, const ::Botan::EC_Group& group, const component::ECC_Point& in) {
+        const ::Botan::BigInt x(in.first.ToString(ds));
+        const ::Botan::BigInt y(in.second.ToString(ds));
+
+        const auto ret = group.point(x, y);
+        if ( ret.on_the_curve() == false ) {
+            throw ::Botan::Invalid_Argument("Point is not on the curve");
+        }
+
+        return ret;
+    }
+
+    /* Returns nullopt for the point at infinity */
+    std::optional<component::ECC_Point> StorePoint(const ::Botan::PointGFp& point) {
+        if ( point.is_zero() ) {
+            return std::nullopt;
+        }
+
+        return component::ECC_Point(point.get_affine_x().to_dec_string(), point.get_affine_y().to_dec_string());
+    }
+} /* namespace Botan_detail */
+
+std::optional<component::ECC_Point> Botan::OpECC_Point_Add(operation::ECC_Point_Add& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    try {
+        std::optional<std::string> curveString;
+        CF_CHECK_NE(curveString = Botan_detail::CurveIDToString(op.curveType.Get()), std::nullopt);
+        ::Botan::EC_Group group(*curveString);
+
+        const auto a = Botan_detail::LoadPoint(ds, group, op.a);
+        const auto b = Botan_detail::LoadPoint(ds, group, op.b);
+
+        ret = Botan_detail::StorePoint(a + b);
+    } catch ( ... ) { }
+
+end:
+    return ret;
+}
+
+std::optional<component::ECC_Point> Botan::OpECC_Point_Mul(operation::ECC_Point_Mul& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    try {
+        std::optional<std::string> curveString;
+        CF_CHECK_NE(curveString = Botan_detail::CurveIDToString(op.curveType.Get()), std::nullopt);
+        ::Botan::EC_Group group(*curveString);
+
+        const auto a = Botan_detail::LoadPoint(ds, group, op.a);
+        const ::Botan::BigInt b(op.b.ToString(ds));
+
+        ret = Botan_detail::StorePoint(b * a);
+    } catch ( ... ) { }
+
+end:
+    return ret;
+}
+
+std::optional<component::ECC_Point> Botan::OpECC_Point_Dbl(operation::ECC_Point_Dbl& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    try {
+        std::optional<std::string> curveString;
+        CF_CHECK_NE(curveString = Botan_detail::CurveIDToString(op.curveType.Get()), std::nullopt);
+        ::Botan::EC_Group group(*curveString);
+
+        auto a = Botan_detail::LoadPoint(ds, group, op.a);
+
+        std::vector<::Botan::BigInt> workspace(::Botan::PointGFp::WORKSPACE_SIZE);
+        a.mult2(workspace);
+
+        ret = Botan_detail::StorePoint(a);
+    } catch ( ... ) { }
+
+end:
+    return ret;
+}
+
+std::optional<component::ECC_Point> Botan::OpECC_MultiScalarMul(operation::ECC_MultiScalarMul& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    try {
+        std::optional<std::string> curveString;
+        CF_CHECK_NE(curveString = Botan_detail::CurveIDToString(op.curveType.Get()), std::nullopt);
+        ::Botan::EC_Group group(*curveString);
+
+        /* Botan's multi-point multiplication (Shamir's trick) takes two terms */
+        CF_CHECK_EQ(op.points.size(), 2);
+
+        const auto p1 = Botan_detail::LoadPoint(ds, group, op.points[0]);
+        const ::Botan::BigInt z1(op.scalars[0].ToString(ds));
+        const auto p2 = Botan_detail::LoadPoint(ds, group, op.points[1]);
+        const ::Botan::BigInt z2(op.scalars[1].ToString(ds));
+
+        ret = Botan_detail::StorePoint(::Botan::multi_exponentiate(p1, z1, p2, z2));
+    } catch ( ... ) { }
+
+end:
+    return ret;
+}
+
 std::optional<component::Bignum> Botan::OpDH_Derive(operation::DH_Derive& op) {
     std::optional<component::Bignum> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
-    static ::Botan::System_RNG rng;
+    static Botan_detail::RNG rng;
 
     try {
         CF_CHECK_NE(op.priv.ToTrimmedString(), "0");
@@ -1050,5 +1318,49 @@ end:
     return ret;
 }
 
+std::optional<component::LargeBignum> Botan::OpBignumCalcLarge(operation::BignumCalcLarge& op) {
+    std::optional<component::LargeBignum> ret = std::nullopt;
+
+    try {
+        const ::Botan::BigInt A(op.bn0.GetPtr(), op.bn0.GetSize());
+        const ::Botan::BigInt B(op.bn1.GetPtr(), op.bn1.GetSize());
+        const ::Botan::BigInt C(op.bn2.GetPtr(), op.bn2.GetSize());
+        ::Botan::BigInt res;
+
+        switch ( op.calcOp.Get() ) {
+            case    CF_CALCOP("Mul(A,B)"):
+                res = A * B;
+                break;
+            case    CF_CALCOP("Sqr(A)"):
+                res = ::Botan::square(A);
+                break;
+            case    CF_CALCOP("Div(A,B)"):
+                CF_CHECK_EQ(B.is_zero(), false);
+                res = A / B;
+                break;
+            case    CF_CALCOP("Mod(A,B)"):
+                CF_CHECK_EQ(B.is_zero(), false);
+                res = A % B;
+                break;
+            case    CF_CALCOP("GCD(A,B)"):
+                res = ::Botan::gcd(A, B);
+                break;
+            case    CF_CALCOP("MulMod(A,B,C)"):
+                CF_CHECK_EQ(C.is_zero(), false);
+                res = (A * B) % C;
+                break;
+            default:
+                goto end;
+        }
+
+        std::vector<uint8_t> out(res.bytes());
+        res.binary_encode(out.data());
+        ret = component::LargeBignum(out);
+    } catch ( ... ) { }
+
+end:
+    return ret;
+}
+
 } /* namespace module */
 } /* namespace cryptofuzz */
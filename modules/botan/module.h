@@ -10,6 +10,9 @@ namespace module {
 class Botan : public Module {
     public:
         Botan(void);
+        std::optional<std::string> DeterministicRNGScheme(void) const override {
+            return "Botan";
+        }
         std::optional<component::Digest> OpDigest(operation::Digest& op) override;
         std::optional<component::MAC> OpHMAC(operation::HMAC& op) override;
         std::optional<component::MAC> OpCMAC(operation::CMAC& op) override;
@@ -27,8 +30,16 @@ class Botan : public Module {
         std::optional<component::ECC_PublicKey> OpECC_PrivateToPublic(operation::ECC_PrivateToPublic& op) override;
         std::optional<component::ECDSA_Signature> OpECDSA_Sign(operation::ECDSA_Sign& op) override;
         std::optional<bool> OpECDSA_Verify(operation::ECDSA_Verify& op) override;
+        std::optional<component::ECC_Point> OpECC_Point_Add(operation::ECC_Point_Add& op) override;
+        std::optional<component::ECC_Point> OpECC_Point_Mul(operation::ECC_Point_Mul& op) override;
+        std::optional<component::ECC_Point> OpECC_Point_Dbl(operation::ECC_Point_Dbl& op) override;
+        std::optional<component::ECC_Point> OpECC_MultiScalarMul(operation::ECC_MultiScalarMul& op) override;
         std::optional<component::Bignum> OpDH_Derive(operation::DH_Derive& op) override;
         std::optional<component::Bignum> OpBignumCalc(operation::BignumCalc& op) override;
+        std::optional<component::LargeBignum> OpBignumCalcLarge(operation::BignumCalcLarge& op) override;
+        std::optional<component::Digest> OpDigestStream(operation::DigestStream& op) override;
+        std::optional<component::MAC> OpHMACStream(operation::HMACStream& op) override;
+        std::optional<component::Ciphertext> OpSymmetricEncryptStream(operation::SymmetricEncryptStream& op) override;
 };
 
 } /* namespace module */
@@ -8,6 +8,24 @@ namespace cryptofuzz {
 namespace module {
 namespace libgmp_bignum {
 
+Operands::Operands(const size_t preallocBits) :
+    bn(4) {
+    if ( preallocBits == 0 ) {
+        return;
+    }
+
+    for (auto b : {&bn[0], &bn[1], &bn[2], &bn[3], &res}) {
+        /* noret */ mpz_realloc2(b->GetPtr(), preallocBits);
+    }
+}
+
+Operands& Operands::Pooled(void) {
+    /* Large enough for the BignumCalc operand size limit */
+    static thread_local Operands pooled(4096);
+
+    return pooled;
+}
+
 bool Add::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
     (void)ds;
 
@@ -10,27 +10,10 @@ namespace module {
 libgmp::libgmp(void) :
     Module("libgmp") { }
 
-std::optional<component::Bignum> libgmp::OpBignumCalc(operation::BignumCalc& op) {
-    std::optional<component::Bignum> ret = std::nullopt;
-    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+static std::unique_ptr<libgmp_bignum::Operation> getBignumOperation(const uint64_t calcOp) {
     std::unique_ptr<libgmp_bignum::Operation> opRunner = nullptr;
 
-    std::vector<libgmp_bignum::Bignum> bn{
-        libgmp_bignum::Bignum(),
-        libgmp_bignum::Bignum(),
-        libgmp_bignum::Bignum(),
-        libgmp_bignum::Bignum()
-    };
-    libgmp_bignum::Bignum res;
-
-    CF_CHECK_EQ(res.Set("0"), true);
-    CF_CHECK_EQ(bn[0].Set(op.bn0.ToString(ds)), true);
-    CF_CHECK_EQ(bn[1].Set(op.bn1.ToString(ds)), true);
-    CF_CHECK_EQ(bn[2].Set(op.bn2.ToString(ds)), true);
-    CF_CHECK_EQ(bn[3].Set(op.bn3.ToString(ds)), true);
-
-
-    switch ( op.calcOp.Get() ) {
+    switch ( calcOp ) {
         case    CF_CALCOP("Add(A,B)"):
             opRunner = std::make_unique<libgmp_bignum::Add>();
             break;
@@ -138,6 +121,29 @@ std::optional<component::Bignum> libgmp::OpBignumCalc(operation::BignumCalc& op)
             break;
     }
 
+    return opRunner;
+}
+
+std::optional<component::Bignum> libgmp::OpBignumCalc(operation::BignumCalc& op) {
+    std::optional<component::Bignum> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+    std::unique_ptr<libgmp_bignum::Operation> opRunner = getBignumOperation(op.calcOp.Get());
+
+    /* Fresh allocations keep the growth paths covered */
+    bool usePool = true;
+    try { usePool = ds.Get<bool>(); } catch ( fuzzing::datasource::Datasource::OutOfData ) { }
+
+    std::unique_ptr<libgmp_bignum::Operands> fresh = usePool ? nullptr : std::make_unique<libgmp_bignum::Operands>();
+    libgmp_bignum::Operands& operands = usePool ? libgmp_bignum::Operands::Pooled() : *fresh;
+    std::vector<libgmp_bignum::Bignum>& bn = operands.bn;
+    libgmp_bignum::Bignum& res = operands.res;
+
+    CF_CHECK_EQ(res.Set("0"), true);
+    CF_CHECK_EQ(bn[0].Set(op.bn0.ToString(ds)), true);
+    CF_CHECK_EQ(bn[1].Set(op.bn1.ToString(ds)), true);
+    CF_CHECK_EQ(bn[2].Set(op.bn2.ToString(ds)), true);
+    CF_CHECK_EQ(bn[3].Set(op.bn3.ToString(ds)), true);
+
     CF_CHECK_NE(opRunner, nullptr);
     CF_CHECK_EQ(opRunner->Run(ds, res, bn), true);
 
@@ -147,5 +153,98 @@ end:
     return ret;
 }
 
+std::optional<component::BignumTrace> libgmp::OpBignumCalcSequence(operation::BignumCalcSequence& op) {
+    std::optional<component::BignumTrace> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    /* The operand slots live for the entire program */
+    std::vector<libgmp_bignum::Bignum> bn(4);
+    std::vector<libgmp_bignum::Bignum> registers(op.registers.size());
+    libgmp_bignum::Bignum res;
+    component::BignumTrace trace;
+
+    for (size_t i = 0; i < op.registers.size(); i++) {
+        CF_CHECK_EQ(registers[i].Set(op.registers[i].ToString(ds)), true);
+    }
+
+    for (const auto& instr : op.program) {
+        std::unique_ptr<libgmp_bignum::Operation> opRunner = getBignumOperation(instr.calcOp.Get());
+        CF_CHECK_NE(opRunner, nullptr);
+
+        for (size_t i = 0; i < instr.src.size(); i++) {
+            /* noret */ mpz_set(bn[i].GetPtr(), registers[instr.src[i]].GetPtr());
+        }
+
+        CF_CHECK_EQ(res.Set("0"), true);
+        CF_CHECK_EQ(opRunner->Run(ds, res, bn), true);
+
+        {
+            const auto v = res.ToComponentBignum();
+            CF_CHECK_NE(v, std::nullopt);
+            /* Keep the registers within the BignumCalc operand size limit */
+            CF_CHECK_LTE(v->GetSize(), 1000);
+            trace.push_back(*v);
+        }
+
+        /* noret */ mpz_set(registers[instr.dst].GetPtr(), res.GetPtr());
+    }
+
+    ret = trace;
+
+end:
+    return ret;
+}
+
+std::optional<component::LargeBignum> libgmp::OpBignumCalcLarge(operation::BignumCalcLarge& op) {
+    std::optional<component::LargeBignum> ret = std::nullopt;
+
+    libgmp_bignum::Bignum A, B, C, res;
+    uint8_t* out = nullptr;
+
+    /* noret */ mpz_import(A.GetPtr(), op.bn0.GetSize(), 1, 1, 0, 0, op.bn0.GetPtr());
+    /* noret */ mpz_import(B.GetPtr(), op.bn1.GetSize(), 1, 1, 0, 0, op.bn1.GetPtr());
+    /* noret */ mpz_import(C.GetPtr(), op.bn2.GetSize(), 1, 1, 0, 0, op.bn2.GetPtr());
+
+    switch ( op.calcOp.Get() ) {
+        case    CF_CALCOP("Mul(A,B)"):
+            /* noret */ mpz_mul(res.GetPtr(), A.GetPtr(), B.GetPtr());
+            break;
+        case    CF_CALCOP("Sqr(A)"):
+            /* Identical operands select the squaring code paths */
+            /* noret */ mpz_mul(res.GetPtr(), A.GetPtr(), A.GetPtr());
+            break;
+        case    CF_CALCOP("Div(A,B)"):
+            CF_CHECK_NE(mpz_sgn(B.GetPtr()), 0);
+            /* noret */ mpz_fdiv_q(res.GetPtr(), A.GetPtr(), B.GetPtr());
+            break;
+        case    CF_CALCOP("Mod(A,B)"):
+            CF_CHECK_NE(mpz_sgn(B.GetPtr()), 0);
+            /* noret */ mpz_mod(res.GetPtr(), A.GetPtr(), B.GetPtr());
+            break;
+        case    CF_CALCOP("GCD(A,B)"):
+            /* noret */ mpz_gcd(res.GetPtr(), A.GetPtr(), B.GetPtr());
+            break;
+        case    CF_CALCOP("MulMod(A,B,C)"):
+            CF_CHECK_NE(mpz_sgn(C.GetPtr()), 0);
+            /* noret */ mpz_mul(res.GetPtr(), A.GetPtr(), B.GetPtr());
+            /* noret */ mpz_mod(res.GetPtr(), res.GetPtr(), C.GetPtr());
+            break;
+        default:
+            goto end;
+    }
+
+    {
+        size_t size = 0;
+        out = util::malloc((mpz_sizeinbase(res.GetPtr(), 2) + 7) / 8);
+        /* noret */ mpz_export(out, &size, 1, 1, 0, 0, res.GetPtr());
+        ret = component::LargeBignum(out, size);
+    }
+
+end:
+    util::free(out);
+
+    return ret;
+}
+
 } /* namespace module */
 } /* namespace cryptofuzz */
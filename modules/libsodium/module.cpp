@@ -1,13 +1,47 @@
 #include "module.h"
 #include <cryptofuzz/util.h>
 #include <cryptofuzz/repository.h>
+#include <cryptofuzz/rng.h>
 #include <sodium.h>
 
 namespace cryptofuzz {
 namespace module {
 
+namespace libsodium_detail {
+    /* Draw from the deterministic stream if there is one */
+    void randombytes_buf(void* const buf, const size_t size) {
+        if ( rng::Generate(static_cast<uint8_t*>(buf), size) == false ) {
+            randombytes_sysrandom_implementation.buf(buf, size);
+        }
+    }
+
+    uint32_t randombytes_random(void) {
+        uint32_t ret;
+        randombytes_buf(&ret, sizeof(ret));
+        return ret;
+    }
+
+    const char* randombytes_implementation_name(void) {
+        return "cryptofuzz";
+    }
+
+    randombytes_implementation rng = {
+        randombytes_implementation_name,
+        randombytes_random,
+        nullptr,
+        nullptr,
+        randombytes_buf,
+        nullptr,
+    };
+} /* namespace libsodium_detail */
+
 libsodium::libsodium(void) :
     Module("libsodium") {
+    /* Must precede sodium_init() */
+    if ( randombytes_set_implementation(&libsodium_detail::rng) != 0 ) {
+        abort();
+    }
+
     if ( sodium_init() == -1 ) {
         abort();
     }
@@ -17,6 +17,9 @@ class libsodium : public Module {
         std::optional<component::MAC> SIPHASH128(operation::HMAC& op) const;
     public:
         libsodium(void);
+        std::optional<std::string> DeterministicRNGScheme(void) const override {
+            return "libsodium";
+        }
         std::optional<component::Digest> OpDigest(operation::Digest& op) override;
         std::optional<component::MAC> OpHMAC(operation::HMAC& op) override;
         std::optional<component::Ciphertext> OpSymmetricEncrypt(operation::SymmetricEncrypt& op) override;
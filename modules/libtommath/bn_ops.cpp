@@ -8,6 +8,26 @@ namespace cryptofuzz {
 namespace module {
 namespace libtommath_bignum {
 
+Operands::Operands(const size_t preallocBits) :
+    bn(4) {
+    if ( preallocBits == 0 ) {
+        return;
+    }
+
+    for (auto b : {&bn[0], &bn[1], &bn[2], &bn[3], &res}) {
+        if ( mp_grow(b->GetPtr(), (preallocBits + MP_DIGIT_BIT - 1) / MP_DIGIT_BIT) != MP_OKAY ) {
+            throw std::exception();
+        }
+    }
+}
+
+Operands& Operands::Pooled(void) {
+    /* Large enough for the BignumCalc operand size limit */
+    static thread_local Operands pooled(4096);
+
+    return pooled;
+}
+
 bool Add::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
     (void)ds;
     bool ret = false;
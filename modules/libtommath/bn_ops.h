@@ -76,6 +76,23 @@ end:
         }
 };
 
+/* The operands and result of a single operation */
+class Operands {
+    public:
+        std::vector<Bignum> bn;
+        Bignum res;
+
+        /* Preallocates each value to hold preallocBits if non-zero */
+        Operands(const size_t preallocBits = 0);
+        Operands(const Operands&) = delete;
+        Operands& operator=(const Operands&) = delete;
+
+        /* Per-thread instance that is overwritten rather than freed by each
+         * operation, so that its digits stay allocated
+         */
+        static Operands& Pooled(void);
+};
+
 class Operation {
     public:
         virtual bool Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const = 0;
@@ -9,33 +9,10 @@ libtommath::libtommath(void) :
     Module("libtommath") {
 }
 
-std::optional<component::Bignum> libtommath::OpBignumCalc(operation::BignumCalc& op) {
-    std::optional<component::Bignum> ret = std::nullopt;
-    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+static std::unique_ptr<libtommath_bignum::Operation> getBignumOperation(const uint64_t calcOp) {
     std::unique_ptr<libtommath_bignum::Operation> opRunner = nullptr;
 
-    std::vector<libtommath_bignum::Bignum> bn{
-        libtommath_bignum::Bignum(),
-        libtommath_bignum::Bignum(),
-        libtommath_bignum::Bignum(),
-        libtommath_bignum::Bignum()
-    };
-    libtommath_bignum::Bignum res;
-
-    CF_CHECK_EQ(res.Set("0"), true);
-#if 0
-    CF_CHECK_EQ(bn[0].Set(op.bn0.ToString(ds)), true);
-    CF_CHECK_EQ(bn[1].Set(op.bn1.ToString(ds)), true);
-    CF_CHECK_EQ(bn[2].Set(op.bn2.ToString(ds)), true);
-    CF_CHECK_EQ(bn[3].Set(op.bn3.ToString(ds)), true);
-#endif
-    CF_CHECK_EQ(bn[0].Set(op.bn0.ToTrimmedString()), true);
-    CF_CHECK_EQ(bn[1].Set(op.bn1.ToTrimmedString()), true);
-    CF_CHECK_EQ(bn[2].Set(op.bn2.ToTrimmedString()), true);
-    CF_CHECK_EQ(bn[3].Set(op.bn3.ToTrimmedString()), true);
-
-
-    switch ( op.calcOp.Get() ) {
+    switch ( calcOp ) {
         case    CF_CALCOP("Add(A,B)"):
             opRunner = std::make_unique<libtommath_bignum::Add>();
             break;
@@ -116,6 +93,35 @@ std::optional<component::Bignum> libtommath::OpBignumCalc(operation::BignumCalc&
             break;
     }
 
+    return opRunner;
+}
+
+std::optional<component::Bignum> libtommath::OpBignumCalc(operation::BignumCalc& op) {
+    std::optional<component::Bignum> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+    std::unique_ptr<libtommath_bignum::Operation> opRunner = getBignumOperation(op.calcOp.Get());
+
+    /* Fresh allocations keep the growth paths covered */
+    bool usePool = true;
+    try { usePool = ds.Get<bool>(); } catch ( fuzzing::datasource::Datasource::OutOfData ) { }
+
+    std::unique_ptr<libtommath_bignum::Operands> fresh = usePool ? nullptr : std::make_unique<libtommath_bignum::Operands>();
+    libtommath_bignum::Operands& operands = usePool ? libtommath_bignum::Operands::Pooled() : *fresh;
+    std::vector<libtommath_bignum::Bignum>& bn = operands.bn;
+    libtommath_bignum::Bignum& res = operands.res;
+
+    CF_CHECK_EQ(res.Set("0"), true);
+#if 0
+    CF_CHECK_EQ(bn[0].Set(op.bn0.ToString(ds)), true);
+    CF_CHECK_EQ(bn[1].Set(op.bn1.ToString(ds)), true);
+    CF_CHECK_EQ(bn[2].Set(op.bn2.ToString(ds)), true);
+    CF_CHECK_EQ(bn[3].Set(op.bn3.ToString(ds)), true);
+#endif
+    CF_CHECK_EQ(bn[0].Set(op.bn0.ToTrimmedString()), true);
+    CF_CHECK_EQ(bn[1].Set(op.bn1.ToTrimmedString()), true);
+    CF_CHECK_EQ(bn[2].Set(op.bn2.ToTrimmedString()), true);
+    CF_CHECK_EQ(bn[3].Set(op.bn3.ToTrimmedString()), true);
+
     CF_CHECK_NE(opRunner, nullptr);
     CF_CHECK_EQ(opRunner->Run(ds, res, bn), true);
 
@@ -125,5 +131,94 @@ end:
     return ret;
 }
 
+std::optional<component::BignumTrace> libtommath::OpBignumCalcSequence(operation::BignumCalcSequence& op) {
+    std::optional<component::BignumTrace> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    /* The operand slots live for the entire program */
+    std::vector<libtommath_bignum::Bignum> bn(4);
+    std::vector<libtommath_bignum::Bignum> registers(op.registers.size());
+    libtommath_bignum::Bignum res;
+    component::BignumTrace trace;
+
+    for (size_t i = 0; i < op.registers.size(); i++) {
+        CF_CHECK_EQ(registers[i].Set(op.registers[i].ToTrimmedString()), true);
+    }
+
+    for (const auto& instr : op.program) {
+        std::unique_ptr<libtommath_bignum::Operation> opRunner = getBignumOperation(instr.calcOp.Get());
+        CF_CHECK_NE(opRunner, nullptr);
+
+        for (size_t i = 0; i < instr.src.size(); i++) {
+            CF_CHECK_EQ(mp_copy(registers[instr.src[i]].GetPtr(), bn[i].GetPtr()), MP_OKAY);
+        }
+
+        CF_CHECK_EQ(res.Set("0"), true);
+        CF_CHECK_EQ(opRunner->Run(ds, res, bn), true);
+
+        {
+            const auto v = res.ToComponentBignum();
+            CF_CHECK_NE(v, std::nullopt);
+            /* Keep the registers within the BignumCalc operand size limit */
+            CF_CHECK_LTE(v->GetSize(), 1000);
+            trace.push_back(*v);
+        }
+
+        CF_CHECK_EQ(mp_copy(res.GetPtr(), registers[instr.dst].GetPtr()), MP_OKAY);
+    }
+
+    ret = trace;
+
+end:
+    return ret;
+}
+
+std::optional<component::LargeBignum> libtommath::OpBignumCalcLarge(operation::BignumCalcLarge& op) {
+    std::optional<component::LargeBignum> ret = std::nullopt;
+
+    libtommath_bignum::Bignum A, B, C, res;
+    uint8_t* out = nullptr;
+
+    CF_CHECK_EQ(mp_from_ubin(A.GetPtr(), op.bn0.GetPtr(), op.bn0.GetSize()), MP_OKAY);
+    CF_CHECK_EQ(mp_from_ubin(B.GetPtr(), op.bn1.GetPtr(), op.bn1.GetSize()), MP_OKAY);
+    CF_CHECK_EQ(mp_from_ubin(C.GetPtr(), op.bn2.GetPtr(), op.bn2.GetSize()), MP_OKAY);
+
+    switch ( op.calcOp.Get() ) {
+        case    CF_CALCOP("Mul(A,B)"):
+            CF_CHECK_EQ(mp_mul(A.GetPtr(), B.GetPtr(), res.GetPtr()), MP_OKAY);
+            break;
+        case    CF_CALCOP("Sqr(A)"):
+            CF_CHECK_EQ(mp_sqr(A.GetPtr(), res.GetPtr()), MP_OKAY);
+            break;
+        case    CF_CALCOP("Div(A,B)"):
+            CF_CHECK_EQ(mp_div(A.GetPtr(), B.GetPtr(), res.GetPtr(), nullptr), MP_OKAY);
+            break;
+        case    CF_CALCOP("Mod(A,B)"):
+            CF_CHECK_EQ(mp_mod(A.GetPtr(), B.GetPtr(), res.GetPtr()), MP_OKAY);
+            break;
+        case    CF_CALCOP("GCD(A,B)"):
+            CF_CHECK_EQ(mp_gcd(A.GetPtr(), B.GetPtr(), res.GetPtr()), MP_OKAY);
+            break;
+        case    CF_CALCOP("MulMod(A,B,C)"):
+            CF_CHECK_EQ(mp_mulmod(A.GetPtr(), B.GetPtr(), C.GetPtr(), res.GetPtr()), MP_OKAY);
+            break;
+        default:
+            goto end;
+    }
+
+    {
+        const size_t size = mp_ubin_size(res.GetPtr());
+        size_t written = 0;
+        out = util::malloc(size);
+        CF_CHECK_EQ(mp_to_ubin(res.GetPtr(), out, size, &written), MP_OKAY);
+        ret = component::LargeBignum(out, written);
+    }
+
+end:
+    util::free(out);
+
+    return ret;
+}
+
 } /* namespace module */
 } /* namespace cryptofuzz */
@@ -11,6 +11,8 @@ class libtommath : public Module {
     public:
         libtommath(void);
         std::optional<component::Bignum> OpBignumCalc(operation::BignumCalc& op) override;
+        std::optional<component::LargeBignum> OpBignumCalcLarge(operation::BignumCalcLarge& op) override;
+        std::optional<component::BignumTrace> OpBignumCalcSequence(operation::BignumCalcSequence& op) override;
 };
 
 } /* namespace module */
@@ -1,5 +1,6 @@
 #include "module.h"
 #include <cryptofuzz/util.h>
+#include <algorithm>
 #include <cryptofuzz/repository.h>
 #include <fuzzing/datasource/id.hpp>
 #include <mpdecimal.h>
@@ -130,5 +131,95 @@ end:
     return ret;
 }
 
+namespace mpdecimal_detail {
+    /* Base 2^16 words, least significant first */
+    bool Import(mpdecimal_bignum::Bignum& bn, const component::LargeBignum& in) {
+        const size_t size = in.GetSize();
+        const uint8_t* data = in.GetPtr();
+        std::vector<uint16_t> words((size + 1) / 2, 0);
+        uint32_t status = 0;
+
+        for (size_t i = 0; i < size; i++) {
+            words[i / 2] |= static_cast<uint16_t>(data[size - 1 - i]) << ((i % 2) * 8);
+        }
+
+        if ( words.empty() ) {
+            words.push_back(0);
+        }
+
+        mpd_qimport_u16(bn.GetPtr(), words.data(), words.size(), MPD_POS, 65536, &ctx, &status);
+
+        return status == 0;
+    }
+
+    std::optional<component::LargeBignum> Export(mpdecimal_bignum::Bignum& bn) {
+        std::optional<component::LargeBignum> ret = std::nullopt;
+        uint16_t* words = nullptr;
+        uint32_t status = 0;
+        std::vector<uint8_t> out;
+
+        const size_t numWords = mpd_qexport_u16(&words, 0, 65536, bn.GetPtr(), &status);
+        CF_CHECK_NE(numWords, SIZE_MAX);
+        CF_CHECK_EQ(status, 0);
+
+        for (size_t i = numWords; i-- > 0; ) {
+            out.push_back(words[i] >> 8);
+            out.push_back(words[i] & 0xFF);
+        }
+
+        /* Strip leading zero bytes */
+        out.erase(out.begin(), std::find_if(out.begin(), out.end(), [](const uint8_t c) { return c != 0; }));
+
+        ret = component::LargeBignum(out);
+
+end:
+        mpd_free(words);
+        return ret;
+    }
+} /* namespace mpdecimal_detail */
+
+std::optional<component::LargeBignum> mpdecimal::OpBignumCalcLarge(operation::BignumCalcLarge& op) {
+    std::optional<component::LargeBignum> ret = std::nullopt;
+
+    mpdecimal_bignum::Bignum A(&ctx), B(&ctx), C(&ctx), res(&ctx);
+    uint32_t status = 0;
+
+    CF_CHECK_EQ(mpdecimal_detail::Import(A, op.bn0), true);
+    CF_CHECK_EQ(mpdecimal_detail::Import(B, op.bn1), true);
+    CF_CHECK_EQ(mpdecimal_detail::Import(C, op.bn2), true);
+
+    switch ( op.calcOp.Get() ) {
+        case    CF_CALCOP("Mul(A,B)"):
+            mpd_qmul(res.GetPtr(), A.GetPtr(), B.GetPtr(), &ctx, &status);
+            break;
+        case    CF_CALCOP("Sqr(A)"):
+            mpd_qmul(res.GetPtr(), A.GetPtr(), A.GetPtr(), &ctx, &status);
+            break;
+        case    CF_CALCOP("Div(A,B)"):
+            mpd_qdivint(res.GetPtr(), A.GetPtr(), B.GetPtr(), &ctx, &status);
+            break;
+        case    CF_CALCOP("Mod(A,B)"):
+            mpd_qrem(res.GetPtr(), A.GetPtr(), B.GetPtr(), &ctx, &status);
+            break;
+        case    CF_CALCOP("MulMod(A,B,C)"):
+            {
+                mpdecimal_bignum::Bignum AB(&ctx);
+                mpd_qmul(AB.GetPtr(), A.GetPtr(), B.GetPtr(), &ctx, &status);
+                mpd_qrem(res.GetPtr(), AB.GetPtr(), C.GetPtr(), &ctx, &status);
+            }
+            break;
+        default:
+            goto end;
+    }
+
+    /* Also rejects results that exceed the context precision */
+    CF_CHECK_EQ(status, 0);
+
+    ret = mpdecimal_detail::Export(res);
+
+end:
+    return ret;
+}
+
 } /* namespace module */
 } /* namespace cryptofuzz */
@@ -11,6 +11,7 @@ class mpdecimal : public Module {
     public:
         mpdecimal(void);
         std::optional<component::Bignum> OpBignumCalc(operation::BignumCalc& op) override;
+        std::optional<component::LargeBignum> OpBignumCalcLarge(operation::BignumCalcLarge& op) override;
 };
 
 } /* namespace module */
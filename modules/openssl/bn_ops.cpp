@@ -1,6 +1,8 @@
 #include <cryptofuzz/util.h>
 #include <cryptofuzz/repository.h>
+#include <cryptofuzz/lru.h>
 #include <fuzzing/datasource/id.hpp>
+#include <memory>
 
 #include "bn_ops.h"
 
@@ -27,6 +29,108 @@ namespace cryptofuzz {
 namespace module {
 namespace OpenSSL_bignum {
 
+namespace OpenSSL_bignum_detail {
+    struct PoolState {
+        std::array<BIGNUM*, Pool::NumBignums> bn = {};
+        ::BN_CTX* ctx = nullptr;
+
+        ~PoolState() {
+            for (auto& b : bn) {
+                BN_free(b);
+            }
+            BN_CTX_free(ctx);
+        }
+    };
+
+    static thread_local PoolState poolState;
+}
+
+::BN_CTX* Pool::GetCtx(void) {
+    auto& state = OpenSSL_bignum_detail::poolState;
+
+    if ( state.ctx == nullptr ) {
+        state.ctx = BN_CTX_new();
+    }
+
+    return state.ctx;
+}
+
+BIGNUM* Pool::Take(const size_t index) {
+    auto& state = OpenSSL_bignum_detail::poolState;
+
+    if ( index >= NumBignums ) {
+        abort();
+    }
+
+    BIGNUM* ret = state.bn[index];
+    state.bn[index] = nullptr;
+
+    if ( ret == nullptr ) {
+        ret = BN_new();
+    }
+
+    return ret;
+}
+
+void Pool::Put(const size_t index, BIGNUM* bn) {
+    auto& state = OpenSSL_bignum_detail::poolState;
+
+    if ( index >= NumBignums ) {
+        abort();
+    }
+
+#if !defined(CRYPTOFUZZ_BORINGSSL)
+    /* The flag cannot be cleared, and it must not leak into the next input */
+    if ( bn != nullptr && BN_get_flags(bn, BN_FLG_CONSTTIME) != 0 ) {
+        BN_free(bn);
+        bn = nullptr;
+    }
+#endif
+
+    if ( bn != nullptr ) {
+        /* Also clears the sign, which BN_bin2bn preserves for zero */
+        /* noret */ BN_zero(bn);
+    }
+
+    BN_free(state.bn[index]);
+    state.bn[index] = bn;
+}
+
+/* Returns a cached Montgomery context for the modulus, or nullptr if the
+ * modulus is not odd and positive. Keeping the contexts of recently used
+ * moduli mirrors how RSA and DH implementations use these APIs.
+ */
+static ::BN_MONT_CTX* getMontCtx(Datasource& ds, const BIGNUM* mod, BN_CTX& ctx) {
+    static LRUCache<std::vector<uint8_t>, std::unique_ptr<BN_MONT_CTX>, 16> cache;
+
+    ::BN_MONT_CTX* ret = nullptr;
+    std::vector<uint8_t> key;
+
+    CF_CHECK_EQ(BN_is_negative(mod), 0);
+    CF_CHECK_EQ(BN_is_odd(mod), 1);
+    CF_CHECK_EQ(BN_is_one(mod), 0);
+
+    key.resize(BN_num_bytes(mod));
+    /* noret */ BN_bn2bin(mod, key.data());
+
+    {
+        auto cached = cache.Get(key);
+        if ( cached != nullptr ) {
+            return (*cached)->GetPtr();
+        }
+    }
+
+    {
+        auto mont = std::make_unique<BN_MONT_CTX>(ds);
+        CF_CHECK_EQ(BN_MONT_CTX_set(mont->GetPtr(), mod, ctx.GetPtr()), 1);
+
+        ret = cache.Put(key, std::move(mont))->GetPtr();
+    }
+
+end:
+    return ret;
+}
+
 bool Add::Run(Datasource& ds, Bignum& res, BignumCluster& bn, BN_CTX& ctx) const {
     (void)ctx;
     bool ret = false;
@@ -238,6 +342,20 @@ bool ExpMod::Run(Datasource& ds, Bignum& res, BignumCluster& bn, BN_CTX& ctx) co
             goto end;
 #endif
             break;
+        case    4:
+            {
+                ::BN_MONT_CTX* mont = nullptr;
+                CF_CHECK_NE(mont = getMontCtx(ds, bn[2].GetPtr(), ctx), nullptr);
+                CF_CHECK_EQ(BN_mod_exp_mont(res.GetDestPtr(), bn[0].GetPtr(), bn[1].GetPtr(), bn[2].GetPtr(), ctx.GetPtr(), mont), 1);
+            }
+            break;
+        case    5:
+            {
+                ::BN_MONT_CTX* mont = nullptr;
+                CF_CHECK_NE(mont = getMontCtx(ds, bn[2].GetPtr(), ctx), nullptr);
+                CF_CHECK_EQ(BN_mod_exp_mont_consttime(res.GetDestPtr(), bn[0].GetPtr(), bn[1].GetPtr(), bn[2].GetPtr(), ctx.GetPtr(), mont), 1);
+            }
+            break;
         default:
             goto end;
             break;
@@ -354,6 +472,27 @@ bool MulMod::Run(Datasource& ds, Bignum& res, BignumCluster& bn, BN_CTX& ctx) co
         case    0:
             CF_CHECK_EQ(BN_mod_mul(res.GetDestPtr(), bn[0].GetPtr(), bn[1].GetPtr(), bn[2].GetPtr(), ctx.GetPtr()), 1);
             break;
+        case    1:
+            {
+                ::BN_MONT_CTX* mont = nullptr;
+                Bignum A(ds), B(ds);
+
+                CF_CHECK_NE(mont = getMontCtx(ds, bn[2].GetPtr(), ctx), nullptr);
+
+                /* Montgomery multiplication requires non-negative inputs less than the modulus */
+                CF_CHECK_EQ(BN_is_negative(bn[0].GetPtr()), 0);
+                CF_CHECK_EQ(BN_is_negative(bn[1].GetPtr()), 0);
+                CF_CHECK_LT(BN_cmp(bn[0].GetPtr(), bn[2].GetPtr()), 0);
+                CF_CHECK_LT(BN_cmp(bn[1].GetPtr(), bn[2].GetPtr()), 0);
+
+                CF_CHECK_EQ(A.New(), true);
+                CF_CHECK_EQ(B.New(), true);
+                CF_CHECK_EQ(BN_to_montgomery(A.GetDestPtr(false), bn[0].GetPtr(), mont, ctx.GetPtr()), 1);
+                CF_CHECK_EQ(BN_to_montgomery(B.GetDestPtr(false), bn[1].GetPtr(), mont, ctx.GetPtr()), 1);
+                CF_CHECK_EQ(BN_mod_mul_montgomery(A.GetDestPtr(false), A.GetPtr(false), B.GetPtr(false), mont, ctx.GetPtr()), 1);
+                CF_CHECK_EQ(BN_from_montgomery(res.GetDestPtr(), A.GetPtr(false), mont, ctx.GetPtr()), 1);
+            }
+            break;
         default:
             goto end;
             break;
@@ -372,6 +511,23 @@ bool SqrMod::Run(Datasource& ds, Bignum& res, BignumCluster& bn, BN_CTX& ctx) co
         case    0:
             CF_CHECK_EQ(BN_mod_sqr(res.GetDestPtr(), bn[0].GetPtr(), bn[1].GetPtr(), ctx.GetPtr()), 1);
             break;
+        case    1:
+            {
+                ::BN_MONT_CTX* mont = nullptr;
+                Bignum A(ds);
+
+                CF_CHECK_NE(mont = getMontCtx(ds, bn[1].GetPtr(), ctx), nullptr);
+
+                /* Montgomery multiplication requires a non-negative input less than the modulus */
+                CF_CHECK_EQ(BN_is_negative(bn[0].GetPtr()), 0);
+                CF_CHECK_LT(BN_cmp(bn[0].GetPtr(), bn[1].GetPtr()), 0);
+
+                CF_CHECK_EQ(A.New(), true);
+                CF_CHECK_EQ(BN_to_montgomery(A.GetDestPtr(false), bn[0].GetPtr(), mont, ctx.GetPtr()), 1);
+                CF_CHECK_EQ(BN_mod_mul_montgomery(A.GetDestPtr(false), A.GetPtr(false), A.GetPtr(false), mont, ctx.GetPtr()), 1);
+                CF_CHECK_EQ(BN_from_montgomery(res.GetDestPtr(), A.GetPtr(false), mont, ctx.GetPtr()), 1);
+            }
+            break;
         default:
             goto end;
             break;
@@ -53,6 +53,26 @@ class Bignum {
             return bn != nullptr;
         }
 
+        /* Takes ownership of a BIGNUM allocated elsewhere */
+        bool Adopt(BIGNUM* other) {
+            if ( locked == true ) {
+                printf("Cannot renew locked Bignum\n");
+                abort();
+            }
+
+            BN_free(bn);
+            bn = other;
+
+            return bn != nullptr;
+        }
+
+        /* Relinquishes ownership of the BIGNUM */
+        BIGNUM* Release(void) {
+            BIGNUM* ret = bn;
+            bn = nullptr;
+            return ret;
+        }
+
         bool Set(Bignum& other) {
             bool ret = false;
 
@@ -78,6 +98,35 @@ end:
             return ret;
         }
 
+        bool Set(const component::Bignum& v) {
+            if ( locked == true ) {
+                printf("Cannot set locked Bignum\n");
+                abort();
+            }
+
+            bool ret = false;
+
+            bool useBin = true;
+            try { useBin = ds.Get<bool>(); } catch ( fuzzing::datasource::Datasource::OutOfData ) { }
+
+            {
+                /* Avoid the quadratic BN_dec2bn by using the cached binary representation */
+                const auto bin = useBin ? v.ToBin() : std::nullopt;
+                if ( bin == std::nullopt ) {
+                    return Set(v.ToString(ds));
+                }
+
+                CF_CHECK_NE(bn = BN_bin2bn(bin->data(), bin->size(), bn), nullptr);
+
+                /* BN_bin2bn does not clear the sign of a reused BIGNUM if the value is 0 */
+                /* noret */ BN_set_negative(bn, v.IsNegative() ? 1 : 0);
+            }
+
+            ret = true;
+end:
+            return ret;
+        }
+
         std::optional<uint64_t> AsUint64(void) const {
             std::optional<uint64_t> ret = std::nullopt;
             try {
@@ -358,11 +407,20 @@ class BignumCluster {
 
             return bn[index].Set(s);
         }
+
+        bool Set(const size_t index, const component::Bignum& v) {
+            if ( index >= bn.size() ) {
+                abort();
+            }
+
+            return bn[index].Set(v);
+        }
 };
 
 class BN_CTX {
     private:
         ::BN_CTX* ctx = nullptr;
+        bool noFree = false;
     public:
         BN_CTX(Datasource& ds) :
             ctx(BN_CTX_new())
@@ -373,14 +431,42 @@ class BN_CTX {
             }
         }
 
+        /* Wraps a context that is owned elsewhere */
+        BN_CTX(::BN_CTX* ctx) :
+            ctx(ctx),
+            noFree(true)
+        {
+            if ( ctx == nullptr ) {
+                abort();
+            }
+        }
+
         ::BN_CTX* GetPtr() {
             return ctx;
         }
 
         ~BN_CTX() {
-            BN_CTX_free(ctx);
+            if ( noFree == false ) {
+                BN_CTX_free(ctx);
+            }
         }
 };
+
+/* BIGNUMs and a BN_CTX that are kept per thread and reused by subsequent
+ * operations, rather than allocated and freed for each of them.
+ */
+class Pool {
+    public:
+        static constexpr size_t NumBignums = 5;
+
+        static ::BN_CTX* GetCtx(void);
+
+        /* Removes the BIGNUM from the slot, allocating one if the slot is empty */
+        static BIGNUM* Take(const size_t index);
+
+        /* Returns the BIGNUM to the slot, or frees it if it cannot be reused */
+        static void Put(const size_t index, BIGNUM* bn);
+};
 class BN_MONT_CTX {
     private:
         ::BN_MONT_CTX* ctx = nullptr;
@@ -1,8 +1,11 @@
 #include "module.h"
 #include <cryptofuzz/util.h>
 #include <cryptofuzz/repository.h>
+#include <cryptofuzz/crypto.h>
+#include <cryptofuzz/rng.h>
 #include <fuzzing/datasource/id.hpp>
 #include <openssl/aes.h>
+#include <openssl/rand.h>
 #if defined(CRYPTOFUZZ_BORINGSSL)
 #include <openssl/siphash.h>
 #endif
@@ -53,6 +56,26 @@ static void OPENSSL_custom_free(void* ptr, const char* file, int line) {
 #endif
 #endif
 
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL)
+namespace OpenSSL_detail {
+    const RAND_METHOD* defaultRandMethod = nullptr;
+    RAND_METHOD randMethod;
+
+    /* Draw from the deterministic stream if there is one */
+    int RAND_bytes(unsigned char* buf, int num) {
+        if ( num < 0 ) {
+            return 0;
+        }
+
+        if ( rng::Generate(buf, num) == true ) {
+            return 1;
+        }
+
+        return defaultRandMethod->bytes(buf, num);
+    }
+} /* namespace OpenSSL_detail */
+#endif
+
 OpenSSL::OpenSSL(void) :
     Module("OpenSSL") {
 #if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102)
@@ -71,6 +94,15 @@ OpenSSL::OpenSSL(void) :
 #else
      OpenSSL_add_all_algorithms();
 #endif
+
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL)
+    /* Route RAND_bytes through rng::Generate, falling back to the default method */
+    CF_ASSERT((OpenSSL_detail::defaultRandMethod = RAND_get_rand_method()) != nullptr, "Cannot get RAND method");
+    OpenSSL_detail::randMethod = *OpenSSL_detail::defaultRandMethod;
+    OpenSSL_detail::randMethod.bytes = OpenSSL_detail::RAND_bytes;
+    OpenSSL_detail::randMethod.pseudorand = OpenSSL_detail::RAND_bytes;
+    CF_ASSERT(RAND_set_rand_method(&OpenSSL_detail::randMethod) == 1, "Cannot set RAND method");
+#endif
 }
 
 
@@ -3237,7 +3269,7 @@ std::optional<component::ECC_PublicKey> OpenSSL::OpECC_PrivateToPublic(operation
         OpenSSL_bignum::Bignum priv(ds), pub(ds);
         CF_CHECK_EQ(pub.New(), true);
 
-        CF_CHECK_EQ(priv.Set(op.priv.ToString(ds)), true);
+        CF_CHECK_EQ(priv.Set(op.priv), true);
 
         /* Load private key */
         CF_CHECK_NE(BN_bn2binpad(priv.GetPtr(), priv_bytes, sizeof(priv_bytes)), -1);
@@ -3259,7 +3291,7 @@ std::optional<component::ECC_PublicKey> OpenSSL::OpECC_PrivateToPublic(operation
         OpenSSL_bignum::Bignum priv(ds), pub(ds);
         CF_CHECK_EQ(pub.New(), true);
 
-        CF_CHECK_EQ(priv.Set(op.priv.ToString(ds)), true);
+        CF_CHECK_EQ(priv.Set(op.priv), true);
 
         /* Load private key */
         CF_CHECK_NE(BN_bn2binpad(priv.GetPtr(), priv_bytes, sizeof(priv_bytes)), -1);
@@ -3294,7 +3326,7 @@ std::optional<component::ECC_PublicKey> OpenSSL::OpECC_PrivateToPublic(operation
         CF_CHECK_EQ(EC_KEY_set_group(key.GetPtr(), group->GetPtr()), 1);
 
         /* Load private key */
-        CF_CHECK_EQ(prv.Set(op.priv.ToString(ds)), true);
+        CF_CHECK_EQ(prv.Set(op.priv), true);
 
         /* Set private key */
         CF_CHECK_EQ(EC_KEY_set_private_key(key.GetPtr(), prv.GetPtr()), 1);
@@ -3411,8 +3443,8 @@ std::optional<bool> OpenSSL::OpECC_ValidatePubkey(operation::ECC_ValidatePubkey&
 
     /* Construct key */
     CF_CHECK_NE(pub = std::make_unique<CF_EC_POINT>(ds, group), nullptr);
-    CF_CHECK_EQ(pub_x.Set(op.pub.first.ToString(ds)), true);
-    CF_CHECK_EQ(pub_y.Set(op.pub.second.ToString(ds)), true);
+    CF_CHECK_EQ(pub_x.Set(op.pub.first), true);
+    CF_CHECK_EQ(pub_y.Set(op.pub.second), true);
 #if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_110)
     CF_CHECK_NE(EC_POINT_set_affine_coordinates(group->GetPtr(), pub->GetPtr(), pub_x.GetPtr(), pub_y.GetPtr(), nullptr), 0);
 #else
@@ -3454,7 +3486,7 @@ std::optional<component::ECDSA_Signature> OpenSSL::OpECDSA_Sign(operation::ECDSA
     CF_CHECK_EQ(EC_KEY_set_group(key.GetPtr(), group->GetPtr()), 1);
 
     /* Load private key */
-    CF_CHECK_EQ(prv.Set(op.priv.ToString(ds)), true);
+    CF_CHECK_EQ(prv.Set(op.priv), true);
 
     /* Set private key */
     CF_CHECK_EQ(EC_KEY_set_private_key(key.GetPtr(), prv.GetPtr()), 1);
@@ -3530,8 +3562,8 @@ std::optional<bool> OpenSSL::OpECDSA_Verify(operation::ECDSA_Verify& op) {
         CF_CHECK_EQ(EC_KEY_set_group(key.GetPtr(), group->GetPtr()), 1);
 
         /* Construct signature */
-        CF_CHECK_EQ(sig_r.Set(op.signature.signature.first.ToString(ds)), true);
-        CF_CHECK_EQ(sig_s.Set(op.signature.signature.second.ToString(ds)), true);
+        CF_CHECK_EQ(sig_r.Set(op.signature.signature.first), true);
+        CF_CHECK_EQ(sig_s.Set(op.signature.signature.second), true);
         CF_CHECK_NE(signature = ECDSA_SIG_new(), nullptr);
 #if defined(CRYPTOFUZZ_OPENSSL_102)
         BN_free(signature->r);
@@ -3547,8 +3579,8 @@ std::optional<bool> OpenSSL::OpECDSA_Verify(operation::ECDSA_Verify& op) {
 
         /* Construct key */
         CF_CHECK_NE(pub = std::make_unique<CF_EC_POINT>(ds, group), nullptr);
-        CF_CHECK_EQ(pub_x.Set(op.signature.pub.first.ToString(ds)), true);
-        CF_CHECK_EQ(pub_y.Set(op.signature.pub.second.ToString(ds)), true);
+        CF_CHECK_EQ(pub_x.Set(op.signature.pub.first), true);
+        CF_CHECK_EQ(pub_y.Set(op.signature.pub.second), true);
 #if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_110)
         CF_CHECK_NE(EC_POINT_set_affine_coordinates(group->GetPtr(), pub->GetPtr(), pub_x.GetPtr(), pub_y.GetPtr(), nullptr), 0);
 #else
@@ -3616,11 +3648,11 @@ std::optional<component::Secret> OpenSSL::OpECDH_Derive(operation::ECDH_Derive&
 
         CF_CHECK_NE(pub = std::make_unique<CF_EC_POINT>(ds, group), nullptr);
         if ( i == 0 ) {
-            CF_CHECK_EQ(pub_x.Set(op.pub1.first.ToString(ds)), true);
-            CF_CHECK_EQ(pub_y.Set(op.pub1.second.ToString(ds)), true);
+            CF_CHECK_EQ(pub_x.Set(op.pub1.first), true);
+            CF_CHECK_EQ(pub_y.Set(op.pub1.second), true);
         } else {
-            CF_CHECK_EQ(pub_x.Set(op.pub2.first.ToString(ds)), true);
-            CF_CHECK_EQ(pub_y.Set(op.pub2.second.ToString(ds)), true);
+            CF_CHECK_EQ(pub_x.Set(op.pub2.first), true);
+            CF_CHECK_EQ(pub_y.Set(op.pub2.second), true);
         }
 #if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_110)
         CF_CHECK_NE(EC_POINT_set_affine_coordinates(group->GetPtr(), pub->GetPtr(), pub_x.GetPtr(), pub_y.GetPtr(), nullptr), 0);
@@ -3659,6 +3691,199 @@ end:
     return ret;
 }
 
+namespace OpenSSL_detail {
+    std::shared_ptr<CF_EC_GROUP> ECC_Group(Datasource& ds, const component::CurveType& curveType) {
+        std::shared_ptr<CF_EC_GROUP> ret = nullptr;
+
+        std::optional<int> curveNID;
+        CF_CHECK_NE(curveNID = toCurveNID(curveType), std::nullopt);
+        CF_CHECK_NE(ret = std::make_shared<CF_EC_GROUP>(ds, *curveNID), nullptr);
+        ret->Lock();
+        if ( ret->GetPtr() == nullptr ) {
+            ret = nullptr;
+        }
+end:
+        return ret;
+    }
+
+    /* Returns nullptr if the coordinates do not describe a point on the curve */
+    std::unique_ptr<CF_EC_POINT> ECC_LoadPoint(Datasource& ds, std::shared_ptr<CF_EC_GROUP> group, const component::ECC_Point& in) {
+        std::unique_ptr<CF_EC_POINT> ret = nullptr;
+        OpenSSL_bignum::Bignum x(ds), y(ds);
+
+        CF_CHECK_EQ(x.Set(in.first), true);
+        CF_CHECK_EQ(y.Set(in.second), true);
+
+        ret = std::make_unique<CF_EC_POINT>(ds, group);
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_110)
+        if ( EC_POINT_set_affine_coordinates(group->GetPtr(), ret->GetPtr(), x.GetPtr(), y.GetPtr(), nullptr) != 1 ) {
+            ret = nullptr;
+        }
+#else
+        if ( EC_POINT_set_affine_coordinates_GFp(group->GetPtr(), ret->GetPtr(), x.GetPtr(), y.GetPtr(), nullptr) != 1 ) {
+            ret = nullptr;
+        }
+#endif
+
+        /* Older versions do not check this in EC_POINT_set_affine_coordinates */
+        if ( ret != nullptr && EC_POINT_is_on_curve(group->GetPtr(), ret->GetPtr(), nullptr) != 1 ) {
+            ret = nullptr;
+        }
+
+end:
+        return ret;
+    }
+
+    /* Returns nullopt for the point at infinity */
+    std::optional<component::ECC_Point> ECC_StorePoint(Datasource& ds, std::shared_ptr<CF_EC_GROUP> group, CF_EC_POINT& point) {
+        std::optional<component::ECC_Point> ret = std::nullopt;
+        OpenSSL_bignum::Bignum x(ds), y(ds);
+        std::optional<component::Bignum> x_str, y_str;
+
+        CF_CHECK_EQ(EC_POINT_is_at_infinity(group->GetPtr(), point.GetPtr()), 0);
+
+        CF_CHECK_EQ(x.New(), true);
+        CF_CHECK_EQ(y.New(), true);
+
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_110)
+        CF_CHECK_NE(EC_POINT_get_affine_coordinates(group->GetPtr(), point.GetPtr(), x.GetDestPtr(), y.GetDestPtr(), nullptr), 0);
+#else
+        CF_CHECK_NE(EC_POINT_get_affine_coordinates_GFp(group->GetPtr(), point.GetPtr(), x.GetDestPtr(), y.GetDestPtr(), nullptr), 0);
+#endif
+
+        CF_CHECK_NE(x_str = x.ToComponentBignum(), std::nullopt);
+        CF_CHECK_NE(y_str = y.ToComponentBignum(), std::nullopt);
+
+        ret = component::ECC_Point(x_str->ToTrimmedString(), y_str->ToTrimmedString());
+
+end:
+        return ret;
+    }
+} /* namespace OpenSSL_detail */
+
+std::optional<component::ECC_Point> OpenSSL::OpECC_Point_Add(operation::ECC_Point_Add& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    std::shared_ptr<CF_EC_GROUP> group = nullptr;
+    std::unique_ptr<CF_EC_POINT> a = nullptr, b = nullptr, res = nullptr;
+    OpenSSL_bignum::BN_CTX ctx(ds);
+
+    CF_CHECK_NE(group = OpenSSL_detail::ECC_Group(ds, op.curveType), nullptr);
+    CF_CHECK_NE(a = OpenSSL_detail::ECC_LoadPoint(ds, group, op.a), nullptr);
+    CF_CHECK_NE(b = OpenSSL_detail::ECC_LoadPoint(ds, group, op.b), nullptr);
+
+    res = std::make_unique<CF_EC_POINT>(ds, group);
+    CF_CHECK_EQ(EC_POINT_add(group->GetPtr(), res->GetPtr(), a->GetPtr(), b->GetPtr(), ctx.GetPtr()), 1);
+
+    ret = OpenSSL_detail::ECC_StorePoint(ds, group, *res);
+
+end:
+    return ret;
+}
+
+std::optional<component::ECC_Point> OpenSSL::OpECC_Point_Mul(operation::ECC_Point_Mul& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    std::shared_ptr<CF_EC_GROUP> group = nullptr;
+    std::unique_ptr<CF_EC_POINT> a = nullptr, res = nullptr;
+    OpenSSL_bignum::Bignum b(ds);
+    OpenSSL_bignum::BN_CTX ctx(ds);
+
+    CF_CHECK_NE(group = OpenSSL_detail::ECC_Group(ds, op.curveType), nullptr);
+    CF_CHECK_NE(a = OpenSSL_detail::ECC_LoadPoint(ds, group, op.a), nullptr);
+    CF_CHECK_EQ(b.Set(op.b), true);
+
+    res = std::make_unique<CF_EC_POINT>(ds, group);
+    CF_CHECK_EQ(EC_POINT_mul(group->GetPtr(), res->GetPtr(), nullptr, a->GetPtr(), b.GetPtr(), ctx.GetPtr()), 1);
+
+    ret = OpenSSL_detail::ECC_StorePoint(ds, group, *res);
+
+end:
+    return ret;
+}
+
+std::optional<component::ECC_Point> OpenSSL::OpECC_Point_Dbl(operation::ECC_Point_Dbl& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    std::shared_ptr<CF_EC_GROUP> group = nullptr;
+    std::unique_ptr<CF_EC_POINT> a = nullptr, res = nullptr;
+    OpenSSL_bignum::BN_CTX ctx(ds);
+
+    CF_CHECK_NE(group = OpenSSL_detail::ECC_Group(ds, op.curveType), nullptr);
+    CF_CHECK_NE(a = OpenSSL_detail::ECC_LoadPoint(ds, group, op.a), nullptr);
+
+    res = std::make_unique<CF_EC_POINT>(ds, group);
+    CF_CHECK_EQ(EC_POINT_dbl(group->GetPtr(), res->GetPtr(), a->GetPtr(), ctx.GetPtr()), 1);
+
+    ret = OpenSSL_detail::ECC_StorePoint(ds, group, *res);
+
+end:
+    return ret;
+}
+
+std::optional<component::ECC_Point> OpenSSL::OpECC_MultiScalarMul(operation::ECC_MultiScalarMul& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    std::shared_ptr<CF_EC_GROUP> group = nullptr;
+    std::vector<std::unique_ptr<CF_EC_POINT>> points;
+    std::vector<std::unique_ptr<OpenSSL_bignum::Bignum>> scalars;
+    std::unique_ptr<CF_EC_POINT> res = nullptr;
+    OpenSSL_bignum::BN_CTX ctx(ds);
+
+    CF_CHECK_NE(group = OpenSSL_detail::ECC_Group(ds, op.curveType), nullptr);
+
+    for (size_t i = 0; i < op.points.size(); i++) {
+        std::unique_ptr<CF_EC_POINT> point = nullptr;
+        CF_CHECK_NE(point = OpenSSL_detail::ECC_LoadPoint(ds, group, op.points[i]), nullptr);
+        points.push_back(std::move(point));
+
+        scalars.push_back(std::make_unique<OpenSSL_bignum::Bignum>(ds));
+        CF_CHECK_EQ(scalars.back()->Set(op.scalars[i]), true);
+    }
+
+    res = std::make_unique<CF_EC_POINT>(ds, group);
+
+    {
+        bool useMulti = false;
+#if !defined(CRYPTOFUZZ_BORINGSSL)
+        try { useMulti = ds.Get<bool>(); } catch ( fuzzing::datasource::Datasource::OutOfData ) { }
+#endif
+
+        if ( useMulti == true ) {
+#if !defined(CRYPTOFUZZ_BORINGSSL)
+            std::vector<const EC_POINT*> p;
+            std::vector<const BIGNUM*> k;
+
+            for (size_t i = 0; i < points.size(); i++) {
+                p.push_back(points[i]->GetPtr());
+                k.push_back(scalars[i]->GetPtr());
+            }
+
+            CF_CHECK_EQ(EC_POINTs_mul(group->GetPtr(), res->GetPtr(), nullptr, p.size(), p.data(), k.data(), ctx.GetPtr()), 1);
+#endif
+        } else {
+            /* Sum of separate multiplications */
+            CF_CHECK_EQ(EC_POINT_set_to_infinity(group->GetPtr(), res->GetPtr()), 1);
+
+            for (size_t i = 0; i < points.size(); i++) {
+                CF_EC_POINT tmp(ds, group);
+
+                CF_CHECK_EQ(EC_POINT_mul(group->GetPtr(), tmp.GetPtr(), nullptr, points[i]->GetPtr(), scalars[i]->GetPtr(), ctx.GetPtr()), 1);
+                CF_CHECK_EQ(EC_POINT_add(group->GetPtr(), res->GetPtr(), res->GetPtr(), tmp.GetPtr(), ctx.GetPtr()), 1);
+            }
+        }
+    }
+
+    ret = OpenSSL_detail::ECC_StorePoint(ds, group, *res);
+
+end:
+    return ret;
+}
+
 std::optional<component::DH_KeyPair> OpenSSL::OpDH_GenerateKeyPair(operation::DH_GenerateKeyPair& op) {
     std::optional<component::DH_KeyPair> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
@@ -3672,8 +3897,8 @@ std::optional<component::DH_KeyPair> OpenSSL::OpDH_GenerateKeyPair(operation::DH
 
     /* Set prime and base */
     {
-        CF_CHECK_EQ(prime.Set(op.prime.ToString(ds)), true);
-        CF_CHECK_EQ(base.Set(op.base.ToString(ds)), true);
+        CF_CHECK_EQ(prime.Set(op.prime), true);
+        CF_CHECK_EQ(base.Set(op.base), true);
 
         CF_CHECK_EQ(DH_set0_pqg(dh, prime.GetPtrConst(), nullptr, base.GetPtrConst()), 1);
         prime.ReleaseOwnership();
@@ -3715,14 +3940,14 @@ std::optional<component::Bignum> OpenSSL::OpDH_Derive(operation::DH_Derive& op)
 
     /* Set prime, base and private key */
     {
-        CF_CHECK_EQ(prime.Set(op.prime.ToString(ds)), true);
-        CF_CHECK_EQ(base.Set(op.base.ToString(ds)), true);
+        CF_CHECK_EQ(prime.Set(op.prime), true);
+        CF_CHECK_EQ(base.Set(op.base), true);
 
         CF_CHECK_EQ(DH_set0_pqg(dh, prime.GetPtrConst(), nullptr, base.GetPtrConst()), 1);
         prime.ReleaseOwnership();
         base.ReleaseOwnership();
 
-        CF_CHECK_EQ(priv.Set(op.priv.ToString(ds)), true);
+        CF_CHECK_EQ(priv.Set(op.priv), true);
         CF_CHECK_EQ(DH_set0_key(dh, nullptr, priv.GetPtrConst()), 1);
         priv.ReleaseOwnership();
     }
@@ -3730,7 +3955,7 @@ std::optional<component::Bignum> OpenSSL::OpDH_Derive(operation::DH_Derive& op)
     derived_size = DH_size(dh);
     derived_bytes = util::malloc(derived_size);
 
-    CF_CHECK_EQ(pub.Set(op.pub.ToString(ds)), true);
+    CF_CHECK_EQ(pub.Set(op.pub), true);
 
     CF_CHECK_NE(derived_size = DH_compute_key(derived_bytes, pub.GetPtr(), dh), -1);
 
@@ -3747,32 +3972,10 @@ end:
     return ret;
 }
 
-std::optional<component::Bignum> OpenSSL::OpBignumCalc(operation::BignumCalc& op) {
-    std::optional<component::Bignum> ret = std::nullopt;
-    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
-
-    OpenSSL_bignum::BN_CTX ctx(ds);
-    OpenSSL_bignum::BignumCluster bn(ds,
-        OpenSSL_bignum::Bignum(ds),
-        OpenSSL_bignum::Bignum(ds),
-        OpenSSL_bignum::Bignum(ds),
-        OpenSSL_bignum::Bignum(ds));
-    OpenSSL_bignum::Bignum res(ds);
+static std::unique_ptr<OpenSSL_bignum::Operation> getBignumOperation(const uint64_t calcOp) {
     std::unique_ptr<OpenSSL_bignum::Operation> opRunner = nullptr;
 
-    CF_CHECK_EQ(res.New(), true);
-    CF_CHECK_EQ(bn.New(0), true);
-    CF_CHECK_EQ(bn.New(1), true);
-    CF_CHECK_EQ(bn.New(2), true);
-    CF_CHECK_EQ(bn.New(3), true);
-
-    CF_CHECK_EQ(res.Set("0"), true);
-    CF_CHECK_EQ(bn.Set(0, op.bn0.ToString(ds)), true);
-    CF_CHECK_EQ(bn.Set(1, op.bn1.ToString(ds)), true);
-    CF_CHECK_EQ(bn.Set(2, op.bn2.ToString(ds)), true);
-    CF_CHECK_EQ(bn.Set(3, op.bn3.ToString(ds)), true);
-
-    switch ( op.calcOp.Get() ) {
+    switch ( calcOp ) {
         case    CF_CALCOP("Add(A,B)"):
             opRunner = std::make_unique<OpenSSL_bignum::Add>();
             break;
@@ -3908,16 +4111,343 @@ std::optional<component::Bignum> OpenSSL::OpBignumCalc(operation::BignumCalc& op
             break;
     }
 
+    return opRunner;
+}
+
+std::optional<component::Bignum> OpenSSL::OpBignumCalc(operation::BignumCalc& op) {
+    std::optional<component::Bignum> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    /* Fresh allocations keep the BIGNUM growth paths covered */
+    bool usePool = true;
+    try { usePool = ds.Get<bool>(); } catch ( fuzzing::datasource::Datasource::OutOfData ) { }
+
+    OpenSSL_bignum::BN_CTX ctx = usePool ?
+        OpenSSL_bignum::BN_CTX(OpenSSL_bignum::Pool::GetCtx()) :
+        OpenSSL_bignum::BN_CTX(ds);
+    OpenSSL_bignum::BignumCluster bn(ds,
+        OpenSSL_bignum::Bignum(ds),
+        OpenSSL_bignum::Bignum(ds),
+        OpenSSL_bignum::Bignum(ds),
+        OpenSSL_bignum::Bignum(ds));
+    OpenSSL_bignum::Bignum res(ds);
+    std::unique_ptr<OpenSSL_bignum::Operation> opRunner = getBignumOperation(op.calcOp.Get());
+
+    if ( usePool == true ) {
+        CF_CHECK_EQ(res.Adopt(OpenSSL_bignum::Pool::Take(4)), true);
+        CF_CHECK_EQ(bn.Get(0).Adopt(OpenSSL_bignum::Pool::Take(0)), true);
+        CF_CHECK_EQ(bn.Get(1).Adopt(OpenSSL_bignum::Pool::Take(1)), true);
+        CF_CHECK_EQ(bn.Get(2).Adopt(OpenSSL_bignum::Pool::Take(2)), true);
+        CF_CHECK_EQ(bn.Get(3).Adopt(OpenSSL_bignum::Pool::Take(3)), true);
+    } else {
+        CF_CHECK_EQ(res.New(), true);
+        CF_CHECK_EQ(bn.New(0), true);
+        CF_CHECK_EQ(bn.New(1), true);
+        CF_CHECK_EQ(bn.New(2), true);
+        CF_CHECK_EQ(bn.New(3), true);
+    }
+
+    CF_CHECK_EQ(res.Set("0"), true);
+    CF_CHECK_EQ(bn.Set(0, op.bn0), true);
+    CF_CHECK_EQ(bn.Set(1, op.bn1), true);
+    CF_CHECK_EQ(bn.Set(2, op.bn2), true);
+    CF_CHECK_EQ(bn.Set(3, op.bn3), true);
+
     CF_CHECK_NE(opRunner, nullptr);
     CF_CHECK_EQ(opRunner->Run(ds, res, bn, ctx), true);
 
     ret = res.ToComponentBignum();
 
 end:
+    if ( usePool == true ) {
+        OpenSSL_bignum::Pool::Put(4, res.Release());
+        OpenSSL_bignum::Pool::Put(0, bn.Get(0).Release());
+        OpenSSL_bignum::Pool::Put(1, bn.Get(1).Release());
+        OpenSSL_bignum::Pool::Put(2, bn.Get(2).Release());
+        OpenSSL_bignum::Pool::Put(3, bn.Get(3).Release());
+    }
+
     return ret;
 }
 
+std::optional<component::BignumTrace> OpenSSL::OpBignumCalcSequence(operation::BignumCalcSequence& op) {
+    std::optional<component::BignumTrace> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    /* The context and the operand slots live for the entire program */
+    OpenSSL_bignum::BN_CTX ctx(ds);
+    OpenSSL_bignum::BignumCluster bn(ds,
+        OpenSSL_bignum::Bignum(ds),
+        OpenSSL_bignum::Bignum(ds),
+        OpenSSL_bignum::Bignum(ds),
+        OpenSSL_bignum::Bignum(ds));
+    OpenSSL_bignum::Bignum res(ds);
+    std::vector<std::unique_ptr<OpenSSL_bignum::Bignum>> registers;
+    component::BignumTrace trace;
+
+    CF_CHECK_EQ(res.New(), true);
+    CF_CHECK_EQ(bn.New(0), true);
+    CF_CHECK_EQ(bn.New(1), true);
+    CF_CHECK_EQ(bn.New(2), true);
+    CF_CHECK_EQ(bn.New(3), true);
+
+    for (const auto& r : op.registers) {
+        registers.push_back(std::make_unique<OpenSSL_bignum::Bignum>(ds));
+        CF_CHECK_EQ(registers.back()->New(), true);
+        CF_CHECK_EQ(registers.back()->Set(r), true);
+    }
+
+    for (const auto& instr : op.program) {
+        std::unique_ptr<OpenSSL_bignum::Operation> opRunner = getBignumOperation(instr.calcOp.Get());
+        CF_CHECK_NE(opRunner, nullptr);
+
+        for (size_t i = 0; i < instr.src.size(); i++) {
+            CF_CHECK_EQ(bn.Get(i).Set(*registers[instr.src[i]]), true);
+        }
+
+        CF_CHECK_EQ(res.Set("0"), true);
+        CF_CHECK_EQ(opRunner->Run(ds, res, bn, ctx), true);
+
+        {
+            const auto v = res.ToComponentBignum();
+            CF_CHECK_NE(v, std::nullopt);
+            /* Keep the registers within the BignumCalc operand size limit */
+            CF_CHECK_LTE(v->GetSize(), 1000);
+            trace.push_back(*v);
+        }
+
+        CF_CHECK_EQ(registers[instr.dst]->Set(res), true);
+    }
+
+    ret = trace;
+
+end:
+    return ret;
+}
+
+std::optional<component::LargeBignum> OpenSSL::OpBignumCalcLarge(operation::BignumCalcLarge& op) {
+    std::optional<component::LargeBignum> ret = std::nullopt;
+
+    ::BN_CTX* ctx = nullptr;
+    BIGNUM* A = nullptr;
+    BIGNUM* B = nullptr;
+    BIGNUM* C = nullptr;
+    BIGNUM* res = nullptr;
+    uint8_t* out = nullptr;
+
+    CF_CHECK_NE(ctx = BN_CTX_new(), nullptr);
+    CF_CHECK_NE(A = BN_bin2bn(op.bn0.GetPtr(), op.bn0.GetSize(), nullptr), nullptr);
+    CF_CHECK_NE(B = BN_bin2bn(op.bn1.GetPtr(), op.bn1.GetSize(), nullptr), nullptr);
+    CF_CHECK_NE(C = BN_bin2bn(op.bn2.GetPtr(), op.bn2.GetSize(), nullptr), nullptr);
+    CF_CHECK_NE(res = BN_new(), nullptr);
+
+    switch ( op.calcOp.Get() ) {
+        case    CF_CALCOP("Mul(A,B)"):
+            CF_CHECK_EQ(BN_mul(res, A, B, ctx), 1);
+            break;
+        case    CF_CALCOP("Sqr(A)"):
+            CF_CHECK_EQ(BN_sqr(res, A, ctx), 1);
+            break;
+        case    CF_CALCOP("Div(A,B)"):
+            CF_CHECK_EQ(BN_div(res, nullptr, A, B, ctx), 1);
+            break;
+        case    CF_CALCOP("Mod(A,B)"):
+            CF_CHECK_EQ(BN_mod(res, A, B, ctx), 1);
+            break;
+        case    CF_CALCOP("GCD(A,B)"):
+            CF_CHECK_EQ(BN_gcd(res, A, B, ctx), 1);
+            break;
+        case    CF_CALCOP("MulMod(A,B,C)"):
+            CF_CHECK_EQ(BN_mod_mul(res, A, B, C, ctx), 1);
+            break;
+        default:
+            goto end;
+    }
+
+    {
+        const size_t size = BN_num_bytes(res);
+        out = util::malloc(size);
+        CF_CHECK_EQ(BN_bn2bin(res, out), static_cast<int>(size));
+        ret = component::LargeBignum(out, size);
+    }
+
+end:
+    util::free(out);
+    BN_free(A);
+    BN_free(B);
+    BN_free(C);
+    BN_free(res);
+    BN_CTX_free(ctx);
+
+    return ret;
+}
+
+#endif
+
+std::optional<component::Digest> OpenSSL::OpDigestStream(operation::DigestStream& op) {
+    std::optional<component::Digest> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    util::VirtualParts parts(ds, op.cleartext);
+
+    CF_EVP_MD_CTX ctx(ds);
+    const EVP_MD* md = nullptr;
+
+    /* Initialize */
+    {
+        CF_CHECK_NE(md = toEVPMD(op.digestType), nullptr);
+        CF_CHECK_EQ(EVP_DigestInit_ex(ctx.GetPtr(), md, nullptr), 1);
+    }
+
+    /* Process */
+    while ( const auto part = parts.Next() ) {
+        CF_CHECK_EQ(EVP_DigestUpdate(ctx.GetPtr(), part->first, part->second), 1);
+    }
+
+    /* Finalize */
+    {
+        unsigned int len = -1;
+        unsigned char md[EVP_MAX_MD_SIZE];
+        CF_CHECK_EQ(EVP_DigestFinal_ex(ctx.GetPtr(), md, &len), 1);
+
+        ret = component::Digest(md, len);
+    }
+
+end:
+    return ret;
+}
+
+#if !defined(CRYPTOFUZZ_OPENSSL_102)
+std::optional<component::MAC> OpenSSL::OpHMACStream(operation::HMACStream& op) {
+    std::optional<component::MAC> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    util::VirtualParts parts(ds, op.cleartext);
+
+    CF_HMAC_CTX ctx(ds);
+    const EVP_MD* md = nullptr;
+
+    /* Initialize */
+    {
+        CF_CHECK_NE(md = toEVPMD(op.digestType), nullptr);
+        CF_CHECK_EQ(HMAC_Init_ex(ctx.GetPtr(), op.cipher.key.GetPtr(), op.cipher.key.GetSize(), md, nullptr), 1);
+    }
+
+    /* Process */
+    while ( const auto part = parts.Next() ) {
+        CF_CHECK_EQ(HMAC_Update(ctx.GetPtr(), part->first, part->second), 1);
+    }
+
+    /* Finalize */
+    {
+        unsigned int len = -1;
+        uint8_t out[EVP_MAX_MD_SIZE];
+        CF_CHECK_EQ(HMAC_Final(ctx.GetPtr(), out, &len), 1);
+
+        ret = component::MAC(out, len);
+    }
+
+end:
+    return ret;
+}
+#endif
+
+std::optional<component::Ciphertext> OpenSSL::OpSymmetricEncryptStream(operation::SymmetricEncryptStream& op) {
+    std::optional<component::Ciphertext> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    util::VirtualParts parts(ds, op.cleartext);
+    util::Multipart partsAAD;
+    crypto::sha256_stream ciphertextHash;
+
+    const EVP_CIPHER* cipher = nullptr;
+    CF_EVP_CIPHER_CTX ctx(ds);
+
+    uint8_t* out = util::malloc(util::VirtualParts::MaxPartSize + EVP_MAX_BLOCK_LENGTH);
+    uint8_t* outTag = op.tagSize != std::nullopt ? util::malloc(*op.tagSize) : nullptr;
+
+    /* Initialize */
+    {
+        /* CCM requires the total cleartext size upfront, and XTS and
+         * wrap ciphers cannot process their input incrementally.
+         */
+        CF_CHECK_FALSE(repository::IsCCM(op.cipher.cipherType.Get()));
+        CF_CHECK_FALSE(repository::IsXTS(op.cipher.cipherType.Get()));
+        CF_CHECK_FALSE(repository::IsWRAP(op.cipher.cipherType.Get()));
+
+        CF_CHECK_NE(cipher = toEVPCIPHER(op.cipher.cipherType), nullptr);
+        if ( op.tagSize != std::nullopt || op.aad != std::nullopt ) {
+            /* See OpSymmetricEncrypt_EVP */
+            CF_CHECK_EQ(isAEAD(cipher, op.cipher.cipherType.Get()), true);
+        }
+
+        CF_CHECK_EQ(EVP_EncryptInit_ex(ctx.GetPtr(), cipher, nullptr, nullptr, nullptr), 1);
+
+        if ( op.aad != std::nullopt ) {
+            partsAAD = util::ToParts(ds, *(op.aad));
+        }
+
+        if ( op.cipher.cipherType.Get() != CF_CIPHER("CHACHA20") ) {
+            CF_CHECK_EQ(checkSetIVLength(op.cipher.cipherType.Get(), cipher, ctx.GetPtr(), op.cipher.iv.GetSize()), true);
+        } else {
+            CF_CHECK_EQ(op.cipher.iv.GetSize(), 12);
+        }
+        CF_CHECK_EQ(checkSetKeyLength(cipher, ctx.GetPtr(), op.cipher.key.GetSize()), true);
+
+        if ( op.cipher.cipherType.Get() != CF_CIPHER("CHACHA20") ) {
+            CF_CHECK_EQ(EVP_EncryptInit_ex(ctx.GetPtr(), nullptr, nullptr, op.cipher.key.GetPtr(), op.cipher.iv.GetPtr()), 1);
+        } else {
+            /* Prepend the 32 bit counter (which is 0) to the iv */
+            uint8_t cc20IV[16];
+            memset(cc20IV, 0, 4);
+            memcpy(cc20IV + 4, op.cipher.iv.GetPtr(), op.cipher.iv.GetSize());
+            CF_CHECK_EQ(EVP_EncryptInit_ex(ctx.GetPtr(), nullptr, nullptr, op.cipher.key.GetPtr(), cc20IV), 1);
+        }
+
+        /* Disable ECB padding for consistency with mbed TLS */
+        if ( repository::IsECB(op.cipher.cipherType.Get()) ) {
+            CF_CHECK_EQ(EVP_CIPHER_CTX_set_padding(ctx.GetPtr(), 0), 1);
+        }
+    }
+
+    /* Process */
+    {
+        /* Set AAD */
+        for (const auto& part : partsAAD) {
+            int len;
+            CF_CHECK_EQ(EVP_EncryptUpdate(ctx.GetPtr(), nullptr, &len, part.first, part.second), 1);
+        }
+
+        while ( const auto part = parts.Next() ) {
+            int len = -1;
+            CF_CHECK_EQ(EVP_EncryptUpdate(ctx.GetPtr(), out, &len, part->first, part->second), 1);
+            ciphertextHash.update(out, len);
+        }
+    }
+
+    /* Finalize */
+    {
+        int len = -1;
+        CF_CHECK_EQ(EVP_EncryptFinal_ex(ctx.GetPtr(), out, &len), 1);
+        ciphertextHash.update(out, len);
+
+        if ( op.tagSize != std::nullopt ) {
+#if !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102)
+            CF_CHECK_EQ(EVP_CIPHER_CTX_ctrl(ctx.GetPtr(), EVP_CTRL_AEAD_GET_TAG, *op.tagSize, outTag), 1);
+            ret = component::Ciphertext(Buffer(ciphertextHash.finalize()), Buffer(outTag, *op.tagSize));
 #endif
+        } else {
+            ret = component::Ciphertext(Buffer(ciphertextHash.finalize()));
+        }
+    }
+
+end:
+
+    util::free(out);
+    util::free(outTag);
+
+    return ret;
+}
 
 } /* namespace module */
 } /* namespace cryptofuzz */
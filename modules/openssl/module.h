@@ -61,6 +61,11 @@ class OpenSSL : public Module {
 #endif
     public:
         OpenSSL(void);
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL)
+        std::optional<std::string> DeterministicRNGScheme(void) const override {
+            return "OpenSSL";
+        }
+#endif
         std::optional<component::Digest> OpDigest(operation::Digest& op) override;
         std::optional<component::MAC> OpHMAC(operation::HMAC& op) override;
         std::optional<component::Ciphertext> OpSymmetricEncrypt(operation::SymmetricEncrypt& op) override;
@@ -95,10 +100,21 @@ class OpenSSL : public Module {
         std::optional<component::ECDSA_Signature> OpECDSA_Sign(operation::ECDSA_Sign& op) override;
         std::optional<bool> OpECDSA_Verify(operation::ECDSA_Verify& op) override;
         std::optional<component::Secret> OpECDH_Derive(operation::ECDH_Derive& op) override;
+        std::optional<component::ECC_Point> OpECC_Point_Add(operation::ECC_Point_Add& op) override;
+        std::optional<component::ECC_Point> OpECC_Point_Mul(operation::ECC_Point_Mul& op) override;
+        std::optional<component::ECC_Point> OpECC_Point_Dbl(operation::ECC_Point_Dbl& op) override;
+        std::optional<component::ECC_Point> OpECC_MultiScalarMul(operation::ECC_MultiScalarMul& op) override;
         std::optional<component::DH_KeyPair> OpDH_GenerateKeyPair(operation::DH_GenerateKeyPair& op) override;
         std::optional<component::Bignum> OpDH_Derive(operation::DH_Derive& op) override;
         std::optional<component::Bignum> OpBignumCalc(operation::BignumCalc& op) override;
+        std::optional<component::LargeBignum> OpBignumCalcLarge(operation::BignumCalcLarge& op) override;
+        std::optional<component::BignumTrace> OpBignumCalcSequence(operation::BignumCalcSequence& op) override;
+#endif
+        std::optional<component::Digest> OpDigestStream(operation::DigestStream& op) override;
+#if !defined(CRYPTOFUZZ_OPENSSL_102)
+        std::optional<component::MAC> OpHMACStream(operation::HMACStream& op) override;
 #endif
+        std::optional<component::Ciphertext> OpSymmetricEncryptStream(operation::SymmetricEncryptStream& op) override;
 };
 
 } /* namespace module */
@@ -0,0 +1,794 @@
+#include "bignum.h"
+#include <cryptofuzz/util.h>
+#include <algorithm>
+#include <cstring>
+
+namespace cryptofuzz {
+namespace module {
+namespace Reference_bignum {
+
+using Limb = Bignum::Limb;
+using DoubleLimb = unsigned __int128;
+
+/* Below this amount of limbs, schoolbook multiplication is faster */
+static constexpr size_t KaratsubaThreshold = 24;
+
+namespace limbs {
+
+/* out[0..an+bn) = a * b; out must be zeroed */
+static void mulSchoolbook(const Limb* a, const size_t an, const Limb* b, const size_t bn, Limb* out) {
+    for (size_t i = 0; i < an; i++) {
+        Limb carry = 0;
+        for (size_t j = 0; j < bn; j++) {
+            const DoubleLimb t = static_cast<DoubleLimb>(a[i]) * b[j] + out[i + j] + carry;
+            out[i + j] = static_cast<Limb>(t);
+            carry = static_cast<Limb>(t >> 64);
+        }
+        out[i + bn] = carry;
+    }
+}
+
+/* out[offset..] += v; out must be large enough to absorb the carry */
+static void addAt(Limb* out, const size_t outSize, const Limb* v, const size_t vn, const size_t offset) {
+    Limb carry = 0;
+    size_t i = 0;
+
+    for (; i < vn; i++) {
+        const DoubleLimb t = static_cast<DoubleLimb>(out[offset + i]) + v[i] + carry;
+        out[offset + i] = static_cast<Limb>(t);
+        carry = static_cast<Limb>(t >> 64);
+    }
+
+    for (; carry && offset + i < outSize; i++) {
+        out[offset + i] += carry;
+        carry = out[offset + i] == 0 ? 1 : 0;
+    }
+}
+
+/* a -= b; requires a >= b. Returns the borrow. */
+static Limb subInPlace(Limb* a, const size_t an, const Limb* b, const size_t bn) {
+    Limb borrow = 0;
+
+    for (size_t i = 0; i < an; i++) {
+        const Limb bi = i < bn ? b[i] : 0;
+        const Limb t = a[i] - bi - borrow;
+        borrow = (a[i] < bi || (a[i] == bi && borrow)) ? 1 : 0;
+        a[i] = t;
+
+        if ( i >= bn && !borrow ) {
+            break;
+        }
+    }
+
+    return borrow;
+}
+
+static void mulKaratsuba(const Limb* a, size_t an, const Limb* b, size_t bn, Limb* out) {
+    if ( an < bn ) {
+        std::swap(a, b);
+        std::swap(an, bn);
+    }
+
+    if ( bn < KaratsubaThreshold ) {
+        mulSchoolbook(a, an, b, bn, out);
+        return;
+    }
+
+    if ( bn <= an / 2 ) {
+        /* Unbalanced: multiply b by bn-sized slices of a */
+        std::vector<Limb> tmp(2 * bn);
+        for (size_t i = 0; i < an; i += bn) {
+            const size_t n = std::min(bn, an - i);
+            std::fill(tmp.begin(), tmp.end(), 0);
+            mulKaratsuba(a + i, n, b, bn, tmp.data());
+            addAt(out, an + bn, tmp.data(), n + bn, i);
+        }
+        return;
+    }
+
+    /* a = a1 * X + a0, b = b1 * X + b0 with X = 2^(64m) */
+    const size_t m = an / 2;
+    const size_t a1n = an - m;
+    const size_t b1n = bn - m;
+
+    /* z0 = a0 * b0 and z2 = a1 * b1 go straight into the output */
+    mulKaratsuba(a, m, b, m, out);
+    mulKaratsuba(a + m, a1n, b + m, b1n, out + 2 * m);
+
+    /* z1 = (a0 + a1) * (b0 + b1) - z0 - z2 */
+    std::vector<Limb> sa(a1n + 1, 0), sb(std::max(m, b1n) + 1, 0);
+    memcpy(sa.data(), a + m, a1n * sizeof(Limb));
+    addAt(sa.data(), sa.size(), a, m, 0);
+    memcpy(sb.data(), b, m * sizeof(Limb));
+    addAt(sb.data(), sb.size(), b + m, b1n, 0);
+
+    std::vector<Limb> z1(sa.size() + sb.size(), 0);
+    mulKaratsuba(sa.data(), sa.size(), sb.data(), sb.size(), z1.data());
+    subInPlace(z1.data(), z1.size(), out, 2 * m);
+    subInPlace(z1.data(), z1.size(), out + 2 * m, a1n + b1n);
+
+    size_t z1n = z1.size();
+    while ( z1n && z1[z1n - 1] == 0 ) {
+        z1n--;
+    }
+
+    addAt(out, an + bn, z1.data(), z1n, m);
+}
+
+} /* namespace limbs */
+
+Bignum::Bignum(const uint64_t v) {
+    if ( v ) {
+        limbs.push_back(v);
+    }
+}
+
+void Bignum::normalize(void) {
+    while ( !limbs.empty() && limbs.back() == 0 ) {
+        limbs.pop_back();
+    }
+}
+
+std::optional<Bignum> Bignum::FromString(const std::string& s) {
+    if ( s.empty() ) {
+        return Bignum(0);
+    }
+
+    for (const char c : s) {
+        if ( c < '0' || c > '9' ) {
+            return std::nullopt;
+        }
+    }
+
+    const auto bin = util::DecToBin(s);
+    if ( bin == std::nullopt ) {
+        return std::nullopt;
+    }
+
+    Bignum ret;
+    ret.limbs.resize((bin->size() + 7) / 8, 0);
+    for (size_t i = 0; i < bin->size(); i++) {
+        ret.limbs[i / 8] |= static_cast<Limb>((*bin)[bin->size() - 1 - i]) << ((i % 8) * 8);
+    }
+    ret.normalize();
+
+    return ret;
+}
+
+std::string Bignum::ToString(void) const {
+    std::vector<uint8_t> bin(limbs.size() * 8);
+    for (size_t i = 0; i < bin.size(); i++) {
+        bin[bin.size() - 1 - i] = static_cast<uint8_t>(limbs[i / 8] >> ((i % 8) * 8));
+    }
+
+    const auto ret = util::BinToDec(bin);
+
+    if ( negative && ret != "0" ) {
+        return "-" + ret;
+    }
+
+    return ret;
+}
+
+bool Bignum::IsZero(void) const {
+    return limbs.empty();
+}
+
+bool Bignum::IsOne(void) const {
+    return limbs.size() == 1 && limbs[0] == 1;
+}
+
+bool Bignum::IsOdd(void) const {
+    return !limbs.empty() && (limbs[0] & 1);
+}
+
+bool Bignum::IsNegative(void) const {
+    return negative && !IsZero();
+}
+
+void Bignum::SetNegative(const bool negative) {
+    this->negative = negative;
+}
+
+size_t Bignum::NumBits(void) const {
+    if ( limbs.empty() ) {
+        return 0;
+    }
+
+    return (limbs.size() - 1) * 64 + (64 - __builtin_clzll(limbs.back()));
+}
+
+size_t Bignum::NumLSZeroBits(void) const {
+    for (size_t i = 0; i < limbs.size(); i++) {
+        if ( limbs[i] ) {
+            return i * 64 + __builtin_ctzll(limbs[i]);
+        }
+    }
+
+    return 0;
+}
+
+bool Bignum::Bit(const size_t pos) const {
+    if ( pos / 64 >= limbs.size() ) {
+        return false;
+    }
+
+    return (limbs[pos / 64] >> (pos % 64)) & 1;
+}
+
+void Bignum::SetBit(const size_t pos) {
+    if ( pos / 64 >= limbs.size() ) {
+        limbs.resize(pos / 64 + 1, 0);
+    }
+
+    limbs[pos / 64] |= static_cast<Limb>(1) << (pos % 64);
+}
+
+void Bignum::ClearBit(const size_t pos) {
+    if ( pos / 64 >= limbs.size() ) {
+        return;
+    }
+
+    limbs[pos / 64] &= ~(static_cast<Limb>(1) << (pos % 64));
+    normalize();
+}
+
+std::optional<uint64_t> Bignum::ToU64(void) const {
+    if ( limbs.size() > 1 ) {
+        return std::nullopt;
+    }
+
+    return limbs.empty() ? 0 : limbs[0];
+}
+
+Bignum Bignum::FromLimbs(const Limb* limbs, const size_t size) {
+    Bignum ret;
+
+    ret.limbs.assign(limbs, limbs + size);
+    ret.normalize();
+
+    return ret;
+}
+
+std::vector<Limb> Bignum::ToLimbs(const size_t size) const {
+    std::vector<Limb> ret(std::max(size, limbs.size()), 0);
+
+    std::copy(limbs.begin(), limbs.end(), ret.begin());
+
+    return ret;
+}
+
+int Bignum::Cmp(const Bignum& A, const Bignum& B) {
+    if ( A.limbs.size() != B.limbs.size() ) {
+        return A.limbs.size() < B.limbs.size() ? -1 : 1;
+    }
+
+    for (size_t i = A.limbs.size(); i-- > 0; ) {
+        if ( A.limbs[i] != B.limbs[i] ) {
+            return A.limbs[i] < B.limbs[i] ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+Bignum Bignum::Add(const Bignum& A, const Bignum& B) {
+    const Bignum& longest = A.limbs.size() >= B.limbs.size() ? A : B;
+    const Bignum& shortest = A.limbs.size() >= B.limbs.size() ? B : A;
+
+    Bignum ret;
+    ret.limbs.resize(longest.limbs.size() + 1, 0);
+    std::copy(longest.limbs.begin(), longest.limbs.end(), ret.limbs.begin());
+    limbs::addAt(ret.limbs.data(), ret.limbs.size(), shortest.limbs.data(), shortest.limbs.size(), 0);
+    ret.normalize();
+
+    return ret;
+}
+
+Bignum Bignum::Sub(const Bignum& A, const Bignum& B) {
+    Bignum ret = A;
+    ret.negative = false;
+    limbs::subInPlace(ret.limbs.data(), ret.limbs.size(), B.limbs.data(), B.limbs.size());
+    ret.normalize();
+
+    return ret;
+}
+
+Bignum Bignum::Mul(const Bignum& A, const Bignum& B) {
+    Bignum ret;
+
+    if ( A.IsZero() || B.IsZero() ) {
+        return ret;
+    }
+
+    ret.limbs.resize(A.limbs.size() + B.limbs.size(), 0);
+    limbs::mulKaratsuba(A.limbs.data(), A.limbs.size(), B.limbs.data(), B.limbs.size(), ret.limbs.data());
+    ret.normalize();
+
+    return ret;
+}
+
+Bignum Bignum::Sqr(const Bignum& A) {
+    return Mul(A, A);
+}
+
+/* Knuth, TAOCP vol. 2, 4.3.1, Algorithm D */
+bool Bignum::DivMod(const Bignum& A, const Bignum& B, Bignum* Q, Bignum* R) {
+    if ( B.IsZero() ) {
+        return false;
+    }
+
+    if ( Cmp(A, B) < 0 ) {
+        if ( Q != nullptr ) {
+            *Q = Bignum(0);
+        }
+        if ( R != nullptr ) {
+            *R = A;
+            R->negative = false;
+        }
+        return true;
+    }
+
+    const size_t n = B.limbs.size();
+    const size_t m = A.limbs.size() - n;
+
+    Bignum q;
+    q.limbs.resize(m + 1, 0);
+
+    if ( n == 1 ) {
+        const Limb d = B.limbs[0];
+        Limb rem = 0;
+        for (size_t i = A.limbs.size(); i-- > 0; ) {
+            const DoubleLimb cur = (static_cast<DoubleLimb>(rem) << 64) | A.limbs[i];
+            q.limbs[i] = static_cast<Limb>(cur / d);
+            rem = static_cast<Limb>(cur % d);
+        }
+        q.normalize();
+
+        if ( Q != nullptr ) {
+            *Q = q;
+        }
+        if ( R != nullptr ) {
+            *R = Bignum(rem);
+        }
+        return true;
+    }
+
+    /* Normalize so that the top limb of the divisor has its high bit set */
+    const size_t shift = __builtin_clzll(B.limbs.back());
+    const Bignum vn = Shl(B, shift);
+    Bignum un = Shl(A, shift);
+    un.limbs.resize(A.limbs.size() + 1, 0);
+
+    const Limb* v = vn.limbs.data();
+    Limb* u = un.limbs.data();
+
+    for (size_t j = m + 1; j-- > 0; ) {
+        const DoubleLimb num = (static_cast<DoubleLimb>(u[j + n]) << 64) | u[j + n - 1];
+        DoubleLimb qhat = num / v[n - 1];
+        DoubleLimb rhat = num % v[n - 1];
+
+        while ( (qhat >> 64) != 0 ||
+                qhat * v[n - 2] > ((rhat << 64) | u[j + n - 2]) ) {
+            qhat--;
+            rhat += v[n - 1];
+            if ( (rhat >> 64) != 0 ) {
+                break;
+            }
+        }
+
+        /* u[j..j+n] -= qhat * v */
+        Limb borrow = 0;
+        Limb carry = 0;
+        for (size_t i = 0; i < n; i++) {
+            const DoubleLimb p = qhat * v[i] + carry;
+            carry = static_cast<Limb>(p >> 64);
+            const Limb pl = static_cast<Limb>(p);
+            const Limb t = u[i + j] - pl - borrow;
+            borrow = (u[i + j] < pl || (u[i + j] == pl && borrow)) ? 1 : 0;
+            u[i + j] = t;
+        }
+        {
+            const Limb t = u[j + n] - carry - borrow;
+            borrow = (u[j + n] < carry || (u[j + n] == carry && borrow)) ? 1 : 0;
+            u[j + n] = t;
+        }
+
+        q.limbs[j] = static_cast<Limb>(qhat);
+
+        if ( borrow ) {
+            /* qhat was one too large; add v back */
+            q.limbs[j]--;
+            Limb c = 0;
+            for (size_t i = 0; i < n; i++) {
+                const DoubleLimb t = static_cast<DoubleLimb>(u[i + j]) + v[i] + c;
+                u[i + j] = static_cast<Limb>(t);
+                c = static_cast<Limb>(t >> 64);
+            }
+            u[j + n] += c;
+        }
+    }
+
+    q.normalize();
+
+    if ( Q != nullptr ) {
+        *Q = q;
+    }
+
+    if ( R != nullptr ) {
+        un.limbs.resize(n);
+        un.normalize();
+        *R = Shr(un, shift);
+    }
+
+    return true;
+}
+
+std::optional<Bignum> Bignum::Mod(const Bignum& A, const Bignum& B) {
+    Bignum r;
+
+    if ( DivMod(A, B, nullptr, &r) == false ) {
+        return std::nullopt;
+    }
+
+    return r;
+}
+
+Bignum Bignum::Shl(const Bignum& A, const size_t count) {
+    Bignum ret;
+
+    if ( A.IsZero() ) {
+        return ret;
+    }
+
+    const size_t limbShift = count / 64;
+    const size_t bitShift = count % 64;
+
+    ret.limbs.resize(A.limbs.size() + limbShift + 1, 0);
+    for (size_t i = 0; i < A.limbs.size(); i++) {
+        ret.limbs[i + limbShift] |= A.limbs[i] << bitShift;
+        if ( bitShift ) {
+            ret.limbs[i + limbShift + 1] |= A.limbs[i] >> (64 - bitShift);
+        }
+    }
+    ret.normalize();
+
+    return ret;
+}
+
+Bignum Bignum::Shr(const Bignum& A, const size_t count) {
+    Bignum ret;
+
+    const size_t limbShift = count / 64;
+    const size_t bitShift = count % 64;
+
+    if ( limbShift >= A.limbs.size() ) {
+        return ret;
+    }
+
+    ret.limbs.resize(A.limbs.size() - limbShift, 0);
+    for (size_t i = 0; i < ret.limbs.size(); i++) {
+        ret.limbs[i] = A.limbs[i + limbShift] >> bitShift;
+        if ( bitShift && i + limbShift + 1 < A.limbs.size() ) {
+            ret.limbs[i] |= A.limbs[i + limbShift + 1] << (64 - bitShift);
+        }
+    }
+    ret.normalize();
+
+    return ret;
+}
+
+Bignum Bignum::And(const Bignum& A, const Bignum& B) {
+    Bignum ret;
+
+    ret.limbs.resize(std::min(A.limbs.size(), B.limbs.size()));
+    for (size_t i = 0; i < ret.limbs.size(); i++) {
+        ret.limbs[i] = A.limbs[i] & B.limbs[i];
+    }
+    ret.normalize();
+
+    return ret;
+}
+
+Bignum Bignum::Or(const Bignum& A, const Bignum& B) {
+    Bignum ret;
+
+    ret.limbs.resize(std::max(A.limbs.size(), B.limbs.size()), 0);
+    for (size_t i = 0; i < ret.limbs.size(); i++) {
+        ret.limbs[i] =
+            (i < A.limbs.size() ? A.limbs[i] : 0) |
+            (i < B.limbs.size() ? B.limbs[i] : 0);
+    }
+
+    return ret;
+}
+
+Bignum Bignum::Xor(const Bignum& A, const Bignum& B) {
+    Bignum ret;
+
+    ret.limbs.resize(std::max(A.limbs.size(), B.limbs.size()), 0);
+    for (size_t i = 0; i < ret.limbs.size(); i++) {
+        ret.limbs[i] =
+            (i < A.limbs.size() ? A.limbs[i] : 0) ^
+            (i < B.limbs.size() ? B.limbs[i] : 0);
+    }
+    ret.normalize();
+
+    return ret;
+}
+
+namespace {
+
+/* Montgomery arithmetic modulo an odd N, with R = 2^(64 * size) */
+class Montgomery {
+    private:
+        std::vector<Limb> n;
+        Limb nInv; /* -N^-1 mod 2^64 */
+        Bignum RR; /* R^2 mod N */
+    public:
+        Montgomery(const Bignum& N, const std::vector<Limb>& nLimbs) :
+            n(nLimbs) {
+            /* Newton iteration doubles the amount of correct bits per step */
+            Limb inv = 1;
+            for (size_t i = 0; i < 6; i++) {
+                inv *= 2 - n[0] * inv;
+            }
+            nInv = -inv;
+
+            RR = *Bignum::Mod(Bignum::Shl(Bignum(1), 128 * n.size()), N);
+        }
+
+        size_t Size(void) const {
+            return n.size();
+        }
+
+        /* Coarsely Integrated Operand Scanning; out = a * b * R^-1 mod N */
+        void Mul(const Limb* a, const Limb* b, Limb* out) const {
+            const size_t s = n.size();
+            std::vector<Limb> t(s + 2, 0);
+
+            for (size_t i = 0; i < s; i++) {
+                Limb carry = 0;
+                for (size_t j = 0; j < s; j++) {
+                    const DoubleLimb cur = static_cast<DoubleLimb>(a[j]) * b[i] + t[j] + carry;
+                    t[j] = static_cast<Limb>(cur);
+                    carry = static_cast<Limb>(cur >> 64);
+                }
+                {
+                    const DoubleLimb cur = static_cast<DoubleLimb>(t[s]) + carry;
+                    t[s] = static_cast<Limb>(cur);
+                    t[s + 1] = static_cast<Limb>(cur >> 64);
+                }
+
+                const Limb m = t[0] * nInv;
+                {
+                    const DoubleLimb cur = static_cast<DoubleLimb>(m) * n[0] + t[0];
+                    carry = static_cast<Limb>(cur >> 64);
+                }
+                for (size_t j = 1; j < s; j++) {
+                    const DoubleLimb cur = static_cast<DoubleLimb>(m) * n[j] + t[j] + carry;
+                    t[j - 1] = static_cast<Limb>(cur);
+                    carry = static_cast<Limb>(cur >> 64);
+                }
+                {
+                    const DoubleLimb cur = static_cast<DoubleLimb>(t[s]) + carry;
+                    t[s - 1] = static_cast<Limb>(cur);
+                    t[s] = t[s + 1] + static_cast<Limb>(cur >> 64);
+                }
+            }
+
+            /* Final conditional subtraction */
+            bool geq = t[s] != 0;
+            if ( !geq ) {
+                geq = true;
+                for (size_t i = s; i-- > 0; ) {
+                    if ( t[i] != n[i] ) {
+                        geq = t[i] > n[i];
+                        break;
+                    }
+                }
+            }
+            if ( geq ) {
+                limbs::subInPlace(t.data(), s + 1, n.data(), s);
+            }
+
+            std::copy(t.begin(), t.begin() + s, out);
+        }
+
+        const Bignum& GetRR(void) const {
+            return RR;
+        }
+};
+
+std::vector<Limb> toFixed(const std::vector<Limb>& v, const size_t size) {
+    std::vector<Limb> ret(size, 0);
+    std::copy(v.begin(), v.begin() + std::min(v.size(), size), ret.begin());
+    return ret;
+}
+
+} /* namespace */
+
+std::optional<Bignum> Bignum::ExpMod(const Bignum& A, const Bignum& B, const Bignum& C) {
+    if ( C.IsZero() ) {
+        return std::nullopt;
+    }
+
+    if ( C.IsOne() ) {
+        return Bignum(0);
+    }
+
+    const Bignum base = *Mod(A, C);
+
+    if ( !C.IsOdd() ) {
+        /* Left-to-right square-and-multiply with plain reduction */
+        Bignum ret(1);
+        for (size_t i = B.NumBits(); i-- > 0; ) {
+            ret = *Mod(Sqr(ret), C);
+            if ( B.Bit(i) ) {
+                ret = *Mod(Mul(ret, base), C);
+            }
+        }
+        return ret;
+    }
+
+    const Montgomery mont(C, C.limbs);
+    const size_t s = mont.Size();
+
+    /* Fixed 4-bit window: table[i] = base^i in Montgomery form */
+    std::vector<std::vector<Limb>> table(16, std::vector<Limb>(s));
+    {
+        const auto rr = toFixed(mont.GetRR().limbs, s);
+        const auto one = toFixed({1}, s);
+        const auto b = toFixed(base.limbs, s);
+
+        mont.Mul(one.data(), rr.data(), table[0].data());
+        mont.Mul(b.data(), rr.data(), table[1].data());
+        for (size_t i = 2; i < 16; i++) {
+            mont.Mul(table[i - 1].data(), table[1].data(), table[i].data());
+        }
+    }
+
+    std::vector<Limb> acc = table[0];
+    const size_t numBits = B.NumBits();
+    const size_t numWindows = (numBits + 3) / 4;
+
+    for (size_t w = numWindows; w-- > 0; ) {
+        for (size_t i = 0; i < 4; i++) {
+            mont.Mul(acc.data(), acc.data(), acc.data());
+        }
+
+        size_t idx = 0;
+        for (size_t i = 4; i-- > 0; ) {
+            idx = (idx << 1) | (B.Bit(w * 4 + i) ? 1 : 0);
+        }
+        if ( idx ) {
+            mont.Mul(acc.data(), table[idx].data(), acc.data());
+        }
+    }
+
+    /* Convert out of Montgomery form */
+    Bignum ret;
+    {
+        const auto one = toFixed({1}, s);
+        ret.limbs.resize(s);
+        mont.Mul(acc.data(), one.data(), ret.limbs.data());
+        ret.normalize();
+    }
+
+    return ret;
+}
+
+Bignum Bignum::GCD(const Bignum& A, const Bignum& B) {
+    Bignum a = A, b = B;
+    a.negative = b.negative = false;
+
+    if ( a.IsZero() ) {
+        return b;
+    }
+    if ( b.IsZero() ) {
+        return a;
+    }
+
+    const size_t shift = std::min(a.NumLSZeroBits(), b.NumLSZeroBits());
+    a = Shr(a, a.NumLSZeroBits());
+
+    while ( !b.IsZero() ) {
+        b = Shr(b, b.NumLSZeroBits());
+        if ( Cmp(a, b) > 0 ) {
+            std::swap(a, b);
+        }
+        b = Sub(b, a);
+    }
+
+    return Shl(a, shift);
+}
+
+std::optional<Bignum> Bignum::InvMod(const Bignum& A, const Bignum& B) {
+    if ( B.IsZero() ) {
+        return std::nullopt;
+    }
+
+    if ( B.IsOne() ) {
+        return Bignum(0);
+    }
+
+    /* Extended Euclid, keeping the Bezout coefficient of A reduced modulo B */
+    Bignum r0 = B, r1 = *Mod(A, B);
+    Bignum t0(0), t1(1);
+
+    while ( !r1.IsZero() ) {
+        Bignum q, r;
+        DivMod(r0, r1, &q, &r);
+
+        const Bignum qt = *Mod(Mul(q, t1), B);
+        Bignum t2 = Cmp(t0, qt) >= 0 ? Sub(t0, qt) : Sub(Add(t0, B), qt);
+
+        r0 = std::move(r1);
+        r1 = std::move(r);
+        t0 = std::move(t1);
+        t1 = std::move(t2);
+    }
+
+    if ( !r0.IsOne() ) {
+        return Bignum(0);
+    }
+
+    return t0;
+}
+
+std::optional<int> Bignum::Jacobi(const Bignum& A, const Bignum& B) {
+    if ( !B.IsOdd() ) {
+        return std::nullopt;
+    }
+
+    Bignum a = *Mod(A, B);
+    Bignum n = B;
+    int t = 1;
+
+    while ( !a.IsZero() ) {
+        const size_t zeroes = a.NumLSZeroBits();
+        a = Shr(a, zeroes);
+
+        const Limb n8 = n.limbs[0] & 7;
+        if ( (zeroes & 1) && (n8 == 3 || n8 == 5) ) {
+            t = -t;
+        }
+
+        std::swap(a, n);
+        if ( (a.limbs[0] & 3) == 3 && (n.limbs[0] & 3) == 3 ) {
+            t = -t;
+        }
+
+        a = *Mod(a, n);
+    }
+
+    return n.IsOne() ? t : 0;
+}
+
+Bignum Bignum::Sqrt(const Bignum& A) {
+    if ( A.IsZero() ) {
+        return Bignum(0);
+    }
+
+    /* Newton's method, starting from a power of 2 not below the root */
+    Bignum x = Shl(Bignum(1), (A.NumBits() + 1) / 2);
+
+    while ( true ) {
+        Bignum q;
+        DivMod(A, x, &q, nullptr);
+        const Bignum y = Shr(Add(x, q), 1);
+
+        if ( Cmp(y, x) >= 0 ) {
+            break;
+        }
+
+        x = y;
+    }
+
+    x.negative = false;
+    return x;
+}
+
+} /* namespace Reference_bignum */
+} /* namespace module */
+} /* namespace cryptofuzz */
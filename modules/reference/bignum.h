@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cryptofuzz {
+namespace module {
+namespace Reference_bignum {
+
+/* Arbitrary precision integer with 64-bit limbs.
+ *
+ * Arithmetic is defined on magnitudes; the sign flag only exists so
+ * that operations like Sub and Neg can express a negative result.
+ */
+class Bignum {
+    public:
+        using Limb = uint64_t;
+    private:
+        /* Little-endian, without leading zero limbs */
+        std::vector<Limb> limbs;
+        bool negative = false;
+
+        void normalize(void);
+    public:
+        Bignum(void) = default;
+        Bignum(const uint64_t v);
+
+        /* Non-negative decimal strings only */
+        static std::optional<Bignum> FromString(const std::string& s);
+        std::string ToString(void) const;
+
+        bool IsZero(void) const;
+        bool IsOne(void) const;
+        bool IsOdd(void) const;
+        bool IsNegative(void) const;
+        void SetNegative(const bool negative);
+
+        size_t NumBits(void) const;
+        size_t NumLSZeroBits(void) const;
+        bool Bit(const size_t pos) const;
+        void SetBit(const size_t pos);
+        void ClearBit(const size_t pos);
+
+        /* Returns nullopt if the value does not fit in 64 bits */
+        std::optional<uint64_t> ToU64(void) const;
+
+        /* Raw little-endian limbs; ToLimbs() zero-pads to size */
+        static Bignum FromLimbs(const Limb* limbs, const size_t size);
+        std::vector<Limb> ToLimbs(const size_t size) const;
+
+        static int Cmp(const Bignum& A, const Bignum& B);
+
+        static Bignum Add(const Bignum& A, const Bignum& B);
+        /* Requires A >= B */
+        static Bignum Sub(const Bignum& A, const Bignum& B);
+        static Bignum Mul(const Bignum& A, const Bignum& B);
+        static Bignum Sqr(const Bignum& A);
+
+        /* Returns false on division by zero; Q and R may be nullptr */
+        static bool DivMod(const Bignum& A, const Bignum& B, Bignum* Q, Bignum* R);
+        static std::optional<Bignum> Mod(const Bignum& A, const Bignum& B);
+
+        static Bignum Shl(const Bignum& A, const size_t count);
+        static Bignum Shr(const Bignum& A, const size_t count);
+
+        static Bignum And(const Bignum& A, const Bignum& B);
+        static Bignum Or(const Bignum& A, const Bignum& B);
+        static Bignum Xor(const Bignum& A, const Bignum& B);
+
+        /* Montgomery multiplication for odd moduli, plain reduction otherwise */
+        static std::optional<Bignum> ExpMod(const Bignum& A, const Bignum& B, const Bignum& C);
+
+        /* Binary GCD */
+        static Bignum GCD(const Bignum& A, const Bignum& B);
+
+        /* Extended Euclid; returns 0 if there is no inverse */
+        static std::optional<Bignum> InvMod(const Bignum& A, const Bignum& B);
+
+        /* Requires an odd modulus */
+        static std::optional<int> Jacobi(const Bignum& A, const Bignum& B);
+
+        /* Floor of the square root */
+        static Bignum Sqrt(const Bignum& A);
+};
+
+} /* namespace Reference_bignum */
+} /* namespace module */
+} /* namespace cryptofuzz */
@@ -0,0 +1,527 @@
+#include <cryptofuzz/util.h>
+#include <cryptofuzz/repository.h>
+#include <fuzzing/datasource/id.hpp>
+
+#include "bn_ops.h"
+
+namespace cryptofuzz {
+namespace module {
+namespace Reference_bignum {
+
+/* Bit positions and shift counts beyond this are not supported */
+static constexpr uint64_t MaxBitPosition = 1 << 20;
+
+static std::optional<size_t> toBitPosition(const Bignum& A) {
+    const auto ret = A.ToU64();
+
+    if ( ret == std::nullopt || *ret > MaxBitPosition ) {
+        return std::nullopt;
+    }
+
+    return static_cast<size_t>(*ret);
+}
+
+static bool modNIST(Bignum& res, const Bignum& A, const char* p) {
+    res = *Bignum::Mod(A, *Bignum::FromString(p));
+
+    return true;
+}
+
+bool Add::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::Add(bn[0], bn[1]);
+
+    return true;
+}
+
+bool Sub::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    if ( Bignum::Cmp(bn[0], bn[1]) >= 0 ) {
+        res = Bignum::Sub(bn[0], bn[1]);
+    } else {
+        res = Bignum::Sub(bn[1], bn[0]);
+        res.SetNegative(true);
+    }
+
+    return true;
+}
+
+bool Mul::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::Mul(bn[0], bn[1]);
+
+    return true;
+}
+
+bool Div::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    return Bignum::DivMod(bn[0], bn[1], &res, nullptr);
+}
+
+bool Mod::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    return Bignum::DivMod(bn[0], bn[1], nullptr, &res);
+}
+
+bool ExpMod::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+    bool ret = false;
+    std::optional<Bignum> r;
+
+    CF_CHECK_NE(r = Bignum::ExpMod(bn[0], bn[1], bn[2]), std::nullopt);
+    res = *r;
+
+    ret = true;
+
+end:
+    return ret;
+}
+
+bool Sqr::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::Sqr(bn[0]);
+
+    return true;
+}
+
+bool GCD::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::GCD(bn[0], bn[1]);
+
+    return true;
+}
+
+bool SqrMod::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    return Bignum::DivMod(Bignum::Sqr(bn[0]), bn[1], nullptr, &res);
+}
+
+bool InvMod::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+    bool ret = false;
+    std::optional<Bignum> r;
+
+    CF_CHECK_NE(r = Bignum::InvMod(bn[0], bn[1]), std::nullopt);
+    res = *r;
+
+    ret = true;
+
+end:
+    return ret;
+}
+
+bool Cmp::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    const int cmp = Bignum::Cmp(bn[0], bn[1]);
+
+    res = Bignum(cmp == 0 ? 0 : 1);
+    res.SetNegative(cmp < 0);
+
+    return true;
+}
+
+bool CmpAbs::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    /* All operands are non-negative */
+    return Cmp().Run(ds, res, bn);
+}
+
+bool LCM::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    if ( bn[0].IsZero() || bn[1].IsZero() ) {
+        res = Bignum(0);
+        return true;
+    }
+
+    Bignum q;
+    Bignum::DivMod(bn[0], Bignum::GCD(bn[0], bn[1]), &q, nullptr);
+    res = Bignum::Mul(q, bn[1]);
+
+    return true;
+}
+
+bool Abs::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = bn[0];
+
+    return true;
+}
+
+bool Neg::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = bn[0];
+    res.SetNegative(true);
+
+    return true;
+}
+
+bool IsNeg::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+    (void)bn;
+
+    res = Bignum(0);
+
+    return true;
+}
+
+bool IsEq::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum(Bignum::Cmp(bn[0], bn[1]) == 0 ? 1 : 0);
+
+    return true;
+}
+
+bool IsEven::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum(bn[0].IsOdd() ? 0 : 1);
+
+    return true;
+}
+
+bool IsOdd::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum(bn[0].IsOdd() ? 1 : 0);
+
+    return true;
+}
+
+bool IsZero::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum(bn[0].IsZero() ? 1 : 0);
+
+    return true;
+}
+
+bool IsOne::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum(bn[0].IsOne() ? 1 : 0);
+
+    return true;
+}
+
+bool Jacobi::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+    bool ret = false;
+    std::optional<int> r;
+
+    CF_CHECK_NE(r = Bignum::Jacobi(bn[0], bn[1]), std::nullopt);
+    res = Bignum(*r == 0 ? 0 : 1);
+    res.SetNegative(*r < 0);
+
+    ret = true;
+
+end:
+    return ret;
+}
+
+bool RShift::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    const auto count = bn[1].ToU64();
+
+    if ( count == std::nullopt || *count >= bn[0].NumBits() ) {
+        res = Bignum(0);
+    } else {
+        res = Bignum::Shr(bn[0], *count);
+    }
+
+    return true;
+}
+
+bool LShift1::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::Shl(bn[0], 1);
+
+    return true;
+}
+
+bool Bit::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    const auto pos = bn[1].ToU64();
+
+    res = Bignum(pos != std::nullopt && bn[0].Bit(*pos) ? 1 : 0);
+
+    return true;
+}
+
+bool SetBit::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+    bool ret = false;
+    std::optional<size_t> pos;
+
+    CF_CHECK_NE(pos = toBitPosition(bn[1]), std::nullopt);
+
+    res = bn[0];
+    res.SetBit(*pos);
+
+    ret = true;
+
+end:
+    return ret;
+}
+
+bool ClearBit::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    const auto pos = bn[1].ToU64();
+
+    res = bn[0];
+    if ( pos != std::nullopt ) {
+        res.ClearBit(*pos);
+    }
+
+    return true;
+}
+
+bool Mask::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    const auto count = bn[1].ToU64();
+
+    if ( count == std::nullopt || *count >= bn[0].NumBits() ) {
+        res = bn[0];
+    } else {
+        /* A mod 2^B */
+        res = Bignum::Sub(bn[0], Bignum::Shl(Bignum::Shr(bn[0], *count), *count));
+    }
+
+    return true;
+}
+
+bool NumBits::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum(bn[0].NumBits());
+
+    return true;
+}
+
+bool NumLSZeroBits::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum(bn[0].NumLSZeroBits());
+
+    return true;
+}
+
+bool Sqrt::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::Sqrt(bn[0]);
+
+    return true;
+}
+
+bool Exp::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+    bool ret = false;
+    std::optional<size_t> exponent;
+
+    CF_CHECK_NE(exponent = toBitPosition(bn[1]), std::nullopt);
+
+    res = Bignum(1);
+    for (size_t i = 64; i-- > 0; ) {
+        res = Bignum::Sqr(res);
+        if ( (*exponent >> i) & 1 ) {
+            res = Bignum::Mul(res, bn[0]);
+        }
+    }
+
+    ret = true;
+
+end:
+    return ret;
+}
+
+bool Exp2::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+    bool ret = false;
+    std::optional<size_t> exponent;
+
+    CF_CHECK_NE(exponent = toBitPosition(bn[0]), std::nullopt);
+
+    res = Bignum::Shl(Bignum(1), *exponent);
+
+    ret = true;
+
+end:
+    return ret;
+}
+
+bool Min::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::Cmp(bn[0], bn[1]) <= 0 ? bn[0] : bn[1];
+
+    return true;
+}
+
+bool Max::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::Cmp(bn[0], bn[1]) >= 0 ? bn[0] : bn[1];
+
+    return true;
+}
+
+bool And::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::And(bn[0], bn[1]);
+
+    return true;
+}
+
+bool Or::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::Or(bn[0], bn[1]);
+
+    return true;
+}
+
+bool Xor::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::Xor(bn[0], bn[1]);
+
+    return true;
+}
+
+bool IsPow2::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum(!bn[0].IsZero() && bn[0].NumLSZeroBits() == bn[0].NumBits() - 1 ? 1 : 0);
+
+    return true;
+}
+
+bool IsCoprime::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum(Bignum::GCD(bn[0], bn[1]).IsOne() ? 1 : 0);
+
+    return true;
+}
+
+bool ModLShift::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+    bool ret = false;
+    std::optional<size_t> count;
+
+    CF_CHECK_NE(count = toBitPosition(bn[1]), std::nullopt);
+    CF_CHECK_TRUE(Bignum::DivMod(Bignum::Shl(bn[0], *count), bn[2], nullptr, &res));
+
+    ret = true;
+
+end:
+    return ret;
+}
+
+bool AddMod::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    return Bignum::DivMod(Bignum::Add(bn[0], bn[1]), bn[2], nullptr, &res);
+}
+
+bool SubMod::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+    bool ret = false;
+    std::optional<Bignum> a, b;
+
+    CF_CHECK_NE(a = Bignum::Mod(bn[0], bn[2]), std::nullopt);
+    CF_CHECK_NE(b = Bignum::Mod(bn[1], bn[2]), std::nullopt);
+
+    if ( Bignum::Cmp(*a, *b) >= 0 ) {
+        res = Bignum::Sub(*a, *b);
+    } else {
+        res = Bignum::Sub(Bignum::Add(*a, bn[2]), *b);
+    }
+
+    ret = true;
+
+end:
+    return ret;
+}
+
+bool MulMod::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    return Bignum::DivMod(Bignum::Mul(bn[0], bn[1]), bn[2], nullptr, &res);
+}
+
+bool MulAdd::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = Bignum::Add(Bignum::Mul(bn[0], bn[1]), bn[2]);
+
+    return true;
+}
+
+bool Set::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = bn[0];
+
+    return true;
+}
+
+bool CondSet::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    res = bn[1].IsZero() ? Bignum(0) : bn[0];
+
+    return true;
+}
+
+bool Mod_NIST_192::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    return modNIST(res, bn[0], "6277101735386680763835789423207666416083908700390324961279");
+}
+
+bool Mod_NIST_224::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    return modNIST(res, bn[0], "26959946667150639794667015087019630673557916260026308143510066298881");
+}
+
+bool Mod_NIST_256::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    return modNIST(res, bn[0], "115792089210356248762697446949407573530086143415290314195533631308867097853951");
+}
+
+bool Mod_NIST_384::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    return modNIST(res, bn[0], "39402006196394479212279040100143613805079739270465446667948293404245721771496870329047266088258938001861606973112319");
+}
+
+bool Mod_NIST_521::Run(Datasource& ds, Bignum& res, std::vector<Bignum>& bn) const {
+    (void)ds;
+
+    return modNIST(res, bn[0], "6864797660130609714981900799081393217269435300143305409394463459185543183397656052122559640661454554977296311391480858037121987999716643812574028291115057151");
+}
+
+} /* namespace Reference_bignum */
+} /* namespace module */
+} /* namespace cryptofuzz */
@@ -0,0 +1,652 @@
+#include "ecc.h"
+#include <cryptofuzz/crypto.h>
+#include <cryptofuzz/repository.h>
+#include <map>
+
+namespace cryptofuzz {
+namespace module {
+namespace Reference_ecc {
+
+using Element = Field::Element;
+using DoubleLimb = unsigned __int128;
+
+/* Window sizes for the w-NAF expansions of scalars multiplied with
+ * the generator (precomputed once per curve) and with other points
+ */
+static constexpr size_t WindowG = 5;
+static constexpr size_t WindowQ = 4;
+
+Field::Field(const Bignum& prime) :
+    n(prime.ToLimbs(0).size()),
+    p{}, rr{}, one{},
+    pMinus2(Bignum::Sub(prime, Bignum(2))) {
+    const auto pLimbs = prime.ToLimbs(n);
+    std::copy(pLimbs.begin(), pLimbs.end(), p.begin());
+
+    /* Newton iteration doubles the amount of correct bits per step */
+    uint64_t inv = 1;
+    for (size_t i = 0; i < 6; i++) {
+        inv *= 2 - p[0] * inv;
+    }
+    pInv = -inv;
+
+    const auto R = *Bignum::Mod(Bignum::Shl(Bignum(1), 64 * n), prime);
+    const auto RR = *Bignum::Mod(Bignum::Shl(Bignum(1), 128 * n), prime);
+
+    const auto oneLimbs = R.ToLimbs(n);
+    std::copy(oneLimbs.begin(), oneLimbs.end(), one.begin());
+
+    const auto rrLimbs = RR.ToLimbs(n);
+    std::copy(rrLimbs.begin(), rrLimbs.end(), rr.begin());
+}
+
+Element Field::FromBignum(const Bignum& v) const {
+    Element ret{};
+
+    const auto limbs = v.ToLimbs(n);
+    std::copy(limbs.begin(), limbs.begin() + n, ret.begin());
+
+    return Mul(ret, rr);
+}
+
+Bignum Field::ToBignum(const Element& v) const {
+    Element unity{};
+    unity[0] = 1;
+
+    const Element ret = Mul(v, unity);
+
+    return Bignum::FromLimbs(ret.data(), n);
+}
+
+Element Field::Add(const Element& a, const Element& b) const {
+    Element ret{};
+    uint64_t carry = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        const DoubleLimb t = static_cast<DoubleLimb>(a[i]) + b[i] + carry;
+        ret[i] = static_cast<uint64_t>(t);
+        carry = static_cast<uint64_t>(t >> 64);
+    }
+
+    bool geq = carry != 0;
+    if ( !geq ) {
+        geq = true;
+        for (size_t i = n; i-- > 0; ) {
+            if ( ret[i] != p[i] ) {
+                geq = ret[i] > p[i];
+                break;
+            }
+        }
+    }
+
+    if ( geq ) {
+        uint64_t borrow = 0;
+        for (size_t i = 0; i < n; i++) {
+            const uint64_t t = ret[i] - p[i] - borrow;
+            borrow = (ret[i] < p[i] || (ret[i] == p[i] && borrow)) ? 1 : 0;
+            ret[i] = t;
+        }
+    }
+
+    return ret;
+}
+
+Element Field::Sub(const Element& a, const Element& b) const {
+    Element ret{};
+    uint64_t borrow = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        const uint64_t t = a[i] - b[i] - borrow;
+        borrow = (a[i] < b[i] || (a[i] == b[i] && borrow)) ? 1 : 0;
+        ret[i] = t;
+    }
+
+    if ( borrow ) {
+        uint64_t carry = 0;
+        for (size_t i = 0; i < n; i++) {
+            const DoubleLimb t = static_cast<DoubleLimb>(ret[i]) + p[i] + carry;
+            ret[i] = static_cast<uint64_t>(t);
+            carry = static_cast<uint64_t>(t >> 64);
+        }
+    }
+
+    return ret;
+}
+
+/* Coarsely Integrated Operand Scanning; a * b * R^-1 mod p */
+Element Field::Mul(const Element& a, const Element& b) const {
+    std::array<uint64_t, MaxLimbs + 2> t{};
+
+    for (size_t i = 0; i < n; i++) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < n; j++) {
+            const DoubleLimb cur = static_cast<DoubleLimb>(a[j]) * b[i] + t[j] + carry;
+            t[j] = static_cast<uint64_t>(cur);
+            carry = static_cast<uint64_t>(cur >> 64);
+        }
+        {
+            const DoubleLimb cur = static_cast<DoubleLimb>(t[n]) + carry;
+            t[n] = static_cast<uint64_t>(cur);
+            t[n + 1] = static_cast<uint64_t>(cur >> 64);
+        }
+
+        const uint64_t m = t[0] * pInv;
+        {
+            const DoubleLimb cur = static_cast<DoubleLimb>(m) * p[0] + t[0];
+            carry = static_cast<uint64_t>(cur >> 64);
+        }
+        for (size_t j = 1; j < n; j++) {
+            const DoubleLimb cur = static_cast<DoubleLimb>(m) * p[j] + t[j] + carry;
+            t[j - 1] = static_cast<uint64_t>(cur);
+            carry = static_cast<uint64_t>(cur >> 64);
+        }
+        {
+            const DoubleLimb cur = static_cast<DoubleLimb>(t[n]) + carry;
+            t[n - 1] = static_cast<uint64_t>(cur);
+            t[n] = t[n + 1] + static_cast<uint64_t>(cur >> 64);
+        }
+    }
+
+    /* Final conditional subtraction */
+    bool geq = t[n] != 0;
+    if ( !geq ) {
+        geq = true;
+        for (size_t i = n; i-- > 0; ) {
+            if ( t[i] != p[i] ) {
+                geq = t[i] > p[i];
+                break;
+            }
+        }
+    }
+
+    Element ret{};
+    if ( geq ) {
+        uint64_t borrow = 0;
+        for (size_t i = 0; i < n; i++) {
+            const uint64_t d = t[i] - p[i] - borrow;
+            borrow = (t[i] < p[i] || (t[i] == p[i] && borrow)) ? 1 : 0;
+            ret[i] = d;
+        }
+    } else {
+        std::copy(t.begin(), t.begin() + n, ret.begin());
+    }
+
+    return ret;
+}
+
+Element Field::Sqr(const Element& a) const {
+    return Mul(a, a);
+}
+
+Element Field::Inv(const Element& a) const {
+    Element ret = one;
+
+    for (size_t i = pMinus2.NumBits(); i-- > 0; ) {
+        ret = Sqr(ret);
+        if ( pMinus2.Bit(i) ) {
+            ret = Mul(ret, a);
+        }
+    }
+
+    return ret;
+}
+
+bool Field::IsZero(const Element& a) const {
+    for (size_t i = 0; i < n; i++) {
+        if ( a[i] ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+const Element& Field::One(void) const {
+    return one;
+}
+
+/* Width-w non-adjacent form, least significant digit first */
+static std::vector<int> toWNAF(const Bignum& k, const size_t w) {
+    std::vector<int> ret;
+    auto limbs = k.ToLimbs(0);
+    limbs.push_back(0);
+
+    const auto isZero = [&limbs]() {
+        for (const auto l : limbs) {
+            if ( l ) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    while ( !isZero() ) {
+        int d = 0;
+
+        if ( limbs[0] & 1 ) {
+            d = static_cast<int>(limbs[0] & ((1 << w) - 1));
+            if ( d >= (1 << (w - 1)) ) {
+                d -= (1 << w);
+            }
+
+            /* k -= d */
+            if ( d > 0 ) {
+                uint64_t borrow = static_cast<uint64_t>(d);
+                for (size_t i = 0; i < limbs.size() && borrow; i++) {
+                    const uint64_t prev = limbs[i];
+                    limbs[i] -= borrow;
+                    borrow = prev < borrow ? 1 : 0;
+                }
+            } else {
+                uint64_t carry = static_cast<uint64_t>(-d);
+                for (size_t i = 0; i < limbs.size() && carry; i++) {
+                    limbs[i] += carry;
+                    carry = limbs[i] < carry ? 1 : 0;
+                }
+            }
+        }
+
+        ret.push_back(d);
+
+        /* k >>= 1 */
+        for (size_t i = 0; i < limbs.size(); i++) {
+            limbs[i] >>= 1;
+            if ( i + 1 < limbs.size() ) {
+                limbs[i] |= limbs[i + 1] << 63;
+            }
+        }
+    }
+
+    return ret;
+}
+
+Curve::Curve(const Bignum& prime, const Bignum& a, const Bignum& b, const Bignum& order) :
+    F(prime),
+    prime(prime),
+    order(order),
+    a(F.FromBignum(a)),
+    b(F.FromBignum(b)),
+    G{} {
+}
+
+const Curve* Curve::Get(const uint64_t curveID) {
+    static std::map<uint64_t, std::unique_ptr<Curve>> curves;
+
+    {
+        const auto it = curves.find(curveID);
+        if ( it != curves.end() ) {
+            return it->second.get();
+        }
+    }
+
+    std::unique_ptr<Curve> curve = nullptr;
+
+    do {
+        const auto primeStr = repository::ECC_CurveToPrime(curveID);
+        const auto aStr = repository::ECC_CurveToA(curveID);
+        const auto bStr = repository::ECC_CurveToB(curveID);
+        const auto xStr = repository::ECC_CurveToX(curveID);
+        const auto yStr = repository::ECC_CurveToY(curveID);
+        const auto orderStr = repository::ECC_CurveToOrder(curveID);
+
+        if ( !primeStr || !aStr || !bStr || !xStr || !yStr || !orderStr ) {
+            break;
+        }
+
+        const auto prime = Bignum::FromString(*primeStr);
+        const auto a = Bignum::FromString(*aStr);
+        const auto b = Bignum::FromString(*bStr);
+        const auto x = Bignum::FromString(*xStr);
+        const auto y = Bignum::FromString(*yStr);
+        const auto order = Bignum::FromString(*orderStr);
+
+        if ( !prime || !a || !b || !x || !y || !order ) {
+            break;
+        }
+
+        if ( prime->NumBits() > Field::MaxLimbs * 64 || !prime->IsOdd() ) {
+            break;
+        }
+
+        curve = std::unique_ptr<Curve>(new Curve(*prime, *a, *b, *order));
+
+        const auto G = curve->FromAffine(*x, *y);
+        if ( G == std::nullopt ) {
+            /* Inconsistent parameters */
+            abort();
+        }
+        curve->G = *G;
+        curve->tableG = curve->oddMultiples(curve->G, WindowG);
+    } while ( 0 );
+
+    return (curves[curveID] = std::move(curve)).get();
+}
+
+const Bignum& Curve::Prime(void) const {
+    return prime;
+}
+
+const Bignum& Curve::Order(void) const {
+    return order;
+}
+
+std::optional<Curve::Point> Curve::FromAffine(const Bignum& x, const Bignum& y) const {
+    if ( Bignum::Cmp(x, prime) >= 0 || Bignum::Cmp(y, prime) >= 0 ) {
+        return std::nullopt;
+    }
+
+    Point ret;
+    ret.X = F.FromBignum(x);
+    ret.Y = F.FromBignum(y);
+    ret.Z = F.One();
+    ret.infinity = false;
+
+    /* y^2 == x^3 + ax + b */
+    const auto lhs = F.Sqr(ret.Y);
+    const auto rhs = F.Add(F.Mul(F.Add(F.Sqr(ret.X), a), ret.X), b);
+
+    if ( lhs != rhs ) {
+        return std::nullopt;
+    }
+
+    return ret;
+}
+
+std::optional<std::pair<Bignum, Bignum>> Curve::ToAffine(const Point& P) const {
+    if ( P.infinity ) {
+        return std::nullopt;
+    }
+
+    const auto zInv = F.Inv(P.Z);
+    const auto zInv2 = F.Sqr(zInv);
+    const auto zInv3 = F.Mul(zInv2, zInv);
+
+    return std::make_pair(
+            F.ToBignum(F.Mul(P.X, zInv2)),
+            F.ToBignum(F.Mul(P.Y, zInv3)));
+}
+
+Curve::Point Curve::negate(const Point& P) const {
+    Point ret = P;
+    ret.Y = F.Sub(Element{}, P.Y);
+    return ret;
+}
+
+Curve::Point Curve::Dbl(const Point& P) const {
+    if ( P.infinity || F.IsZero(P.Y) ) {
+        return Point{{}, {}, {}, true};
+    }
+
+    const auto XX = F.Sqr(P.X);
+    const auto YY = F.Sqr(P.Y);
+    const auto YYYY = F.Sqr(YY);
+    const auto ZZ = F.Sqr(P.Z);
+
+    /* S = 4 * X * Y^2 */
+    auto S = F.Mul(P.X, YY);
+    S = F.Add(S, S);
+    S = F.Add(S, S);
+
+    /* M = 3 * X^2 + a * Z^4 */
+    const auto M = F.Add(F.Add(F.Add(XX, XX), XX), F.Mul(a, F.Sqr(ZZ)));
+
+    Point ret;
+    ret.infinity = false;
+
+    /* X3 = M^2 - 2S */
+    ret.X = F.Sub(F.Sqr(M), F.Add(S, S));
+
+    /* Y3 = M * (S - X3) - 8 * Y^4 */
+    auto Y4x8 = F.Add(YYYY, YYYY);
+    Y4x8 = F.Add(Y4x8, Y4x8);
+    Y4x8 = F.Add(Y4x8, Y4x8);
+    ret.Y = F.Sub(F.Mul(M, F.Sub(S, ret.X)), Y4x8);
+
+    /* Z3 = 2 * Y * Z */
+    const auto YZ = F.Mul(P.Y, P.Z);
+    ret.Z = F.Add(YZ, YZ);
+
+    return ret;
+}
+
+Curve::Point Curve::Add(const Point& P, const Point& Q) const {
+    if ( P.infinity ) {
+        return Q;
+    }
+    if ( Q.infinity ) {
+        return P;
+    }
+
+    const auto Z1Z1 = F.Sqr(P.Z);
+    const auto Z2Z2 = F.Sqr(Q.Z);
+    const auto U1 = F.Mul(P.X, Z2Z2);
+    const auto U2 = F.Mul(Q.X, Z1Z1);
+    const auto S1 = F.Mul(P.Y, F.Mul(Q.Z, Z2Z2));
+    const auto S2 = F.Mul(Q.Y, F.Mul(P.Z, Z1Z1));
+
+    if ( U1 == U2 ) {
+        if ( S1 == S2 ) {
+            return Dbl(P);
+        }
+
+        /* P == -Q */
+        return Point{{}, {}, {}, true};
+    }
+
+    const auto H = F.Sub(U2, U1);
+    const auto R = F.Sub(S2, S1);
+    const auto HH = F.Sqr(H);
+    const auto HHH = F.Mul(HH, H);
+    const auto V = F.Mul(U1, HH);
+
+    Point ret;
+    ret.infinity = false;
+
+    /* X3 = R^2 - H^3 - 2 * U1 * H^2 */
+    ret.X = F.Sub(F.Sub(F.Sqr(R), HHH), F.Add(V, V));
+
+    /* Y3 = R * (U1 * H^2 - X3) - S1 * H^3 */
+    ret.Y = F.Sub(F.Mul(R, F.Sub(V, ret.X)), F.Mul(S1, HHH));
+
+    /* Z3 = H * Z1 * Z2 */
+    ret.Z = F.Mul(H, F.Mul(P.Z, Q.Z));
+
+    return ret;
+}
+
+std::vector<Curve::Point> Curve::oddMultiples(const Point& P, const size_t window) const {
+    std::vector<Point> ret(static_cast<size_t>(1) << (window - 2));
+
+    ret[0] = P;
+    const auto P2 = Dbl(P);
+    for (size_t i = 1; i < ret.size(); i++) {
+        ret[i] = Add(ret[i - 1], P2);
+    }
+
+    return ret;
+}
+
+Curve::Point Curve::MulG(const Bignum& k) const {
+    return MulAdd(k, Bignum(0), G);
+}
+
+Curve::Point Curve::MulAdd(const Bignum& k1, const Bignum& k2, const Point& Q) const {
+    const auto naf1 = toWNAF(k1, WindowG);
+    const auto naf2 = toWNAF(k2, WindowQ);
+    const auto tableQ = naf2.empty() ? std::vector<Point>{} : oddMultiples(Q, WindowQ);
+
+    Point ret{{}, {}, {}, true};
+
+    for (size_t i = std::max(naf1.size(), naf2.size()); i-- > 0; ) {
+        ret = Dbl(ret);
+
+        const int d1 = i < naf1.size() ? naf1[i] : 0;
+        if ( d1 > 0 ) {
+            ret = Add(ret, tableG[d1 / 2]);
+        } else if ( d1 < 0 ) {
+            ret = Add(ret, negate(tableG[-d1 / 2]));
+        }
+
+        const int d2 = i < naf2.size() ? naf2[i] : 0;
+        if ( d2 > 0 ) {
+            ret = Add(ret, tableQ[d2 / 2]);
+        } else if ( d2 < 0 ) {
+            ret = Add(ret, negate(tableQ[-d2 / 2]));
+        }
+    }
+
+    return ret;
+}
+
+static Bignum fromBytes(const uint8_t* data, const size_t size) {
+    std::vector<uint64_t> limbs((size + 7) / 8, 0);
+
+    for (size_t i = 0; i < size; i++) {
+        limbs[i / 8] |= static_cast<uint64_t>(data[size - 1 - i]) << ((i % 8) * 8);
+    }
+
+    return Bignum::FromLimbs(limbs.data(), limbs.size());
+}
+
+static std::vector<uint8_t> toBytes(const Bignum& v, const size_t size) {
+    std::vector<uint8_t> ret(size, 0);
+    const auto limbs = v.ToLimbs((size + 7) / 8);
+
+    for (size_t i = 0; i < size; i++) {
+        ret[size - 1 - i] = static_cast<uint8_t>(limbs[i / 8] >> ((i % 8) * 8));
+    }
+
+    return ret;
+}
+
+/* The leftmost qlen bits of the input, as an integer (RFC 6979 2.3.2) */
+static Bignum bits2int(const std::vector<uint8_t>& data, const size_t qlen) {
+    const auto ret = fromBytes(data.data(), data.size());
+
+    if ( data.size() * 8 > qlen ) {
+        return Bignum::Shr(ret, data.size() * 8 - qlen);
+    }
+
+    return ret;
+}
+
+static std::optional<std::pair<Bignum, Bignum>> signWithNonce(
+        const Curve& curve,
+        const Bignum& priv,
+        const Bignum& e,
+        const Bignum& k) {
+    const auto& n = curve.Order();
+
+    if ( k.IsZero() || Bignum::Cmp(k, n) >= 0 ) {
+        return std::nullopt;
+    }
+
+    const auto R = curve.ToAffine(curve.MulG(k));
+    if ( R == std::nullopt ) {
+        return std::nullopt;
+    }
+
+    const auto r = *Bignum::Mod(R->first, n);
+    if ( r.IsZero() ) {
+        return std::nullopt;
+    }
+
+    /* s = k^-1 * (e + r * priv) mod n */
+    const auto kInv = *Bignum::InvMod(k, n);
+    const auto s = *Bignum::Mod(Bignum::Mul(kInv, Bignum::Add(e, Bignum::Mul(r, priv))), n);
+    if ( s.IsZero() ) {
+        return std::nullopt;
+    }
+
+    return std::make_pair(r, s);
+}
+
+std::optional<std::pair<Bignum, Bignum>> ECDSA_Sign(
+        const Curve& curve,
+        const Bignum& priv,
+        const std::vector<uint8_t>& hash,
+        const std::optional<Bignum>& nonce) {
+    const auto& n = curve.Order();
+    const size_t qlen = n.NumBits();
+
+    if ( priv.IsZero() || Bignum::Cmp(priv, n) >= 0 ) {
+        return std::nullopt;
+    }
+
+    const auto e = *Bignum::Mod(bits2int(hash, qlen), n);
+
+    if ( nonce != std::nullopt ) {
+        return signWithNonce(curve, priv, e, *nonce);
+    }
+
+    /* RFC 6979 3.2 */
+    const size_t rlen = (qlen + 7) / 8;
+    const auto x = toBytes(priv, rlen);
+    const auto h = toBytes(e, rlen);
+
+    std::vector<uint8_t> V(32, 0x01);
+    std::vector<uint8_t> K(32, 0x00);
+
+    for (const uint8_t sep : {0x00, 0x01}) {
+        std::vector<uint8_t> msg = V;
+        msg.push_back(sep);
+        msg.insert(msg.end(), x.begin(), x.end());
+        msg.insert(msg.end(), h.begin(), h.end());
+
+        K = crypto::hmac_sha256(msg, K);
+        V = crypto::hmac_sha256(V, K);
+    }
+
+    /* Each retry is overwhelmingly unlikely; bound the loop regardless */
+    for (size_t i = 0; i < 64; i++) {
+        std::vector<uint8_t> T;
+        while ( T.size() * 8 < qlen ) {
+            V = crypto::hmac_sha256(V, K);
+            T.insert(T.end(), V.begin(), V.end());
+        }
+
+        const auto ret = signWithNonce(curve, priv, e, bits2int(T, qlen));
+        if ( ret != std::nullopt ) {
+            return ret;
+        }
+
+        std::vector<uint8_t> msg = V;
+        msg.push_back(0x00);
+        K = crypto::hmac_sha256(msg, K);
+        V = crypto::hmac_sha256(V, K);
+    }
+
+    return std::nullopt;
+}
+
+bool ECDSA_Verify(
+        const Curve& curve,
+        const Curve::Point& pub,
+        const Bignum& r,
+        const Bignum& s,
+        const std::vector<uint8_t>& hash) {
+    const auto& n = curve.Order();
+
+    if ( r.IsZero() || Bignum::Cmp(r, n) >= 0 ) {
+        return false;
+    }
+    if ( s.IsZero() || Bignum::Cmp(s, n) >= 0 ) {
+        return false;
+    }
+
+    const auto e = *Bignum::Mod(bits2int(hash, n.NumBits()), n);
+    const auto w = *Bignum::InvMod(s, n);
+    const auto u1 = *Bignum::Mod(Bignum::Mul(e, w), n);
+    const auto u2 = *Bignum::Mod(Bignum::Mul(r, w), n);
+
+    const auto X = curve.ToAffine(curve.MulAdd(u1, u2, pub));
+    if ( X == std::nullopt ) {
+        return false;
+    }
+
+    return Bignum::Cmp(*Bignum::Mod(X->first, n), r) == 0;
+}
+
+} /* namespace Reference_ecc */
+} /* namespace module */
+} /* namespace cryptofuzz */
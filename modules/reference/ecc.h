@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "bignum.h"
+
+namespace cryptofuzz {
+namespace module {
+namespace Reference_ecc {
+
+using Reference_bignum::Bignum;
+
+/* Prime field arithmetic in Montgomery form on a fixed amount of limbs */
+class Field {
+    public:
+        /* Enough for a 521 bit prime */
+        static constexpr size_t MaxLimbs = 9;
+        using Element = std::array<uint64_t, MaxLimbs>;
+    private:
+        const size_t n;
+        Element p;
+        uint64_t pInv; /* -p^-1 mod 2^64 */
+        Element rr;    /* R^2 mod p */
+        Element one;   /* R mod p */
+        Bignum pMinus2;
+    public:
+        Field(const Bignum& prime);
+
+        /* Requires v < p */
+        Element FromBignum(const Bignum& v) const;
+        Bignum ToBignum(const Element& v) const;
+
+        Element Add(const Element& a, const Element& b) const;
+        Element Sub(const Element& a, const Element& b) const;
+        Element Mul(const Element& a, const Element& b) const;
+        Element Sqr(const Element& a) const;
+        /* Fermat inversion; the inverse of 0 is 0 */
+        Element Inv(const Element& a) const;
+
+        bool IsZero(const Element& a) const;
+        const Element& One(void) const;
+};
+
+/* Short Weierstrass curve y^2 = x^3 + ax + b over a prime field */
+class Curve {
+    public:
+        /* Jacobian coordinates: (X / Z^2, Y / Z^3) */
+        struct Point {
+            Field::Element X, Y, Z;
+            bool infinity;
+        };
+    private:
+        const Field F;
+        const Bignum prime, order;
+        const Field::Element a, b;
+        Point G;
+        /* Odd multiples G, 3G, 5G, ... for w-NAF multiplication */
+        std::vector<Point> tableG;
+
+        Curve(const Bignum& prime, const Bignum& a, const Bignum& b, const Bignum& order);
+
+        Point negate(const Point& P) const;
+        std::vector<Point> oddMultiples(const Point& P, const size_t window) const;
+    public:
+        /* Returns nullptr if the repository has no parameters for the curve */
+        static const Curve* Get(const uint64_t curveID);
+
+        const Bignum& Prime(void) const;
+        const Bignum& Order(void) const;
+
+        /* Returns nullopt for coordinates that are out of range or not on the curve */
+        std::optional<Point> FromAffine(const Bignum& x, const Bignum& y) const;
+        /* Returns nullopt for the point at infinity */
+        std::optional<std::pair<Bignum, Bignum>> ToAffine(const Point& P) const;
+
+        Point Dbl(const Point& P) const;
+        Point Add(const Point& P, const Point& Q) const;
+
+        /* k * G */
+        Point MulG(const Bignum& k) const;
+        /* k1 * G + k2 * Q, interleaving both w-NAF expansions */
+        Point MulAdd(const Bignum& k1, const Bignum& k2, const Point& Q) const;
+};
+
+/* Returns (r, s). Without a nonce, k is derived as in RFC 6979 with HMAC-SHA256. */
+std::optional<std::pair<Bignum, Bignum>> ECDSA_Sign(
+        const Curve& curve,
+        const Bignum& priv,
+        const std::vector<uint8_t>& hash,
+        const std::optional<Bignum>& nonce);
+
+bool ECDSA_Verify(
+        const Curve& curve,
+        const Curve::Point& pub,
+        const Bignum& r,
+        const Bignum& s,
+        const std::vector<uint8_t>& hash);
+
+} /* namespace Reference_ecc */
+} /* namespace module */
+} /* namespace cryptofuzz */
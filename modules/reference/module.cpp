@@ -1,4 +1,7 @@
 #include "module.h"
+#include "bn_ops.h"
+#include "ecc.h"
+#include <cryptofuzz/crypto.h>
 #include <cryptofuzz/util.h>
 #include <fuzzing/datasource/id.hpp>
 
@@ -487,5 +490,394 @@ end:
     return ret;
 }
 
+std::optional<component::Bignum> Reference::OpBignumCalc(operation::BignumCalc& op) {
+    std::optional<component::Bignum> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    Reference_bignum::Bignum res;
+    std::vector<Reference_bignum::Bignum> bn;
+    std::unique_ptr<Reference_bignum::Operation> opRunner = nullptr;
+
+    /* Only non-negative decimal operands are supported */
+    for (const auto& cur : {op.bn0, op.bn1, op.bn2, op.bn3}) {
+        const auto b = Reference_bignum::Bignum::FromString(cur.ToTrimmedString());
+        CF_CHECK_NE(b, std::nullopt);
+        bn.push_back(*b);
+    }
+
+    switch ( op.calcOp.Get() ) {
+        case    CF_CALCOP("Add(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Add>();
+            break;
+        case    CF_CALCOP("Sub(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Sub>();
+            break;
+        case    CF_CALCOP("Mul(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Mul>();
+            break;
+        case    CF_CALCOP("Div(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Div>();
+            break;
+        case    CF_CALCOP("Mod(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Mod>();
+            break;
+        case    CF_CALCOP("ExpMod(A,B,C)"):
+            opRunner = std::make_unique<Reference_bignum::ExpMod>();
+            break;
+        case    CF_CALCOP("Sqr(A)"):
+            opRunner = std::make_unique<Reference_bignum::Sqr>();
+            break;
+        case    CF_CALCOP("GCD(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::GCD>();
+            break;
+        case    CF_CALCOP("SqrMod(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::SqrMod>();
+            break;
+        case    CF_CALCOP("InvMod(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::InvMod>();
+            break;
+        case    CF_CALCOP("Cmp(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Cmp>();
+            break;
+        case    CF_CALCOP("CmpAbs(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::CmpAbs>();
+            break;
+        case    CF_CALCOP("LCM(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::LCM>();
+            break;
+        case    CF_CALCOP("Abs(A)"):
+            opRunner = std::make_unique<Reference_bignum::Abs>();
+            break;
+        case    CF_CALCOP("Neg(A)"):
+            opRunner = std::make_unique<Reference_bignum::Neg>();
+            break;
+        case    CF_CALCOP("IsNeg(A)"):
+            opRunner = std::make_unique<Reference_bignum::IsNeg>();
+            break;
+        case    CF_CALCOP("IsEq(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::IsEq>();
+            break;
+        case    CF_CALCOP("IsEven(A)"):
+            opRunner = std::make_unique<Reference_bignum::IsEven>();
+            break;
+        case    CF_CALCOP("IsOdd(A)"):
+            opRunner = std::make_unique<Reference_bignum::IsOdd>();
+            break;
+        case    CF_CALCOP("IsZero(A)"):
+            opRunner = std::make_unique<Reference_bignum::IsZero>();
+            break;
+        case    CF_CALCOP("IsOne(A)"):
+            opRunner = std::make_unique<Reference_bignum::IsOne>();
+            break;
+        case    CF_CALCOP("Jacobi(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Jacobi>();
+            break;
+        case    CF_CALCOP("RShift(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::RShift>();
+            break;
+        case    CF_CALCOP("LShift1(A)"):
+            opRunner = std::make_unique<Reference_bignum::LShift1>();
+            break;
+        case    CF_CALCOP("Bit(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Bit>();
+            break;
+        case    CF_CALCOP("SetBit(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::SetBit>();
+            break;
+        case    CF_CALCOP("ClearBit(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::ClearBit>();
+            break;
+        case    CF_CALCOP("Mask(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Mask>();
+            break;
+        case    CF_CALCOP("NumBits(A)"):
+            opRunner = std::make_unique<Reference_bignum::NumBits>();
+            break;
+        case    CF_CALCOP("NumLSZeroBits(A)"):
+            opRunner = std::make_unique<Reference_bignum::NumLSZeroBits>();
+            break;
+        case    CF_CALCOP("Sqrt(A)"):
+            opRunner = std::make_unique<Reference_bignum::Sqrt>();
+            break;
+        case    CF_CALCOP("Exp(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Exp>();
+            break;
+        case    CF_CALCOP("Exp2(A)"):
+            opRunner = std::make_unique<Reference_bignum::Exp2>();
+            break;
+        case    CF_CALCOP("Min(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Min>();
+            break;
+        case    CF_CALCOP("Max(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Max>();
+            break;
+        case    CF_CALCOP("And(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::And>();
+            break;
+        case    CF_CALCOP("Or(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Or>();
+            break;
+        case    CF_CALCOP("Xor(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::Xor>();
+            break;
+        case    CF_CALCOP("IsPow2(A)"):
+            opRunner = std::make_unique<Reference_bignum::IsPow2>();
+            break;
+        case    CF_CALCOP("IsCoprime(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::IsCoprime>();
+            break;
+        case    CF_CALCOP("ModLShift(A,B,C)"):
+            opRunner = std::make_unique<Reference_bignum::ModLShift>();
+            break;
+        case    CF_CALCOP("AddMod(A,B,C)"):
+            opRunner = std::make_unique<Reference_bignum::AddMod>();
+            break;
+        case    CF_CALCOP("SubMod(A,B,C)"):
+            opRunner = std::make_unique<Reference_bignum::SubMod>();
+            break;
+        case    CF_CALCOP("MulMod(A,B,C)"):
+            opRunner = std::make_unique<Reference_bignum::MulMod>();
+            break;
+        case    CF_CALCOP("MulAdd(A,B,C)"):
+            opRunner = std::make_unique<Reference_bignum::MulAdd>();
+            break;
+        case    CF_CALCOP("Set(A)"):
+            opRunner = std::make_unique<Reference_bignum::Set>();
+            break;
+        case    CF_CALCOP("CondSet(A,B)"):
+            opRunner = std::make_unique<Reference_bignum::CondSet>();
+            break;
+        case    CF_CALCOP("Mod_NIST_192(A)"):
+            opRunner = std::make_unique<Reference_bignum::Mod_NIST_192>();
+            break;
+        case    CF_CALCOP("Mod_NIST_224(A)"):
+            opRunner = std::make_unique<Reference_bignum::Mod_NIST_224>();
+            break;
+        case    CF_CALCOP("Mod_NIST_256(A)"):
+            opRunner = std::make_unique<Reference_bignum::Mod_NIST_256>();
+            break;
+        case    CF_CALCOP("Mod_NIST_384(A)"):
+            opRunner = std::make_unique<Reference_bignum::Mod_NIST_384>();
+            break;
+        case    CF_CALCOP("Mod_NIST_521(A)"):
+            opRunner = std::make_unique<Reference_bignum::Mod_NIST_521>();
+            break;
+    }
+
+    CF_CHECK_NE(opRunner, nullptr);
+    CF_CHECK_EQ(opRunner->Run(ds, res, bn), true);
+
+    ret = { res.ToString() };
+
+end:
+    return ret;
+}
+
+
+namespace Reference_detail {
+    std::optional<std::vector<uint8_t>> ECDSA_Hash(const component::DigestType& digestType, const component::Cleartext& cleartext) {
+        if ( digestType.Get() == CF_DIGEST("NULL") ) {
+            return cleartext.Get();
+        } else if ( digestType.Get() == CF_DIGEST("SHA256") ) {
+            return crypto::sha256(cleartext.Get());
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<Reference_ecc::Curve::Point> ECC_Pubkey(const Reference_ecc::Curve& curve, const component::ECC_PublicKey& pub) {
+        const auto x = Reference_bignum::Bignum::FromString(pub.first.ToTrimmedString());
+        const auto y = Reference_bignum::Bignum::FromString(pub.second.ToTrimmedString());
+
+        if ( x == std::nullopt || y == std::nullopt ) {
+            return std::nullopt;
+        }
+
+        return curve.FromAffine(*x, *y);
+    }
+} /* namespace Reference_detail */
+
+std::optional<component::ECC_PublicKey> Reference::OpECC_PrivateToPublic(operation::ECC_PrivateToPublic& op) {
+    std::optional<component::ECC_PublicKey> ret = std::nullopt;
+
+    const Reference_ecc::Curve* curve = nullptr;
+    std::optional<Reference_bignum::Bignum> priv;
+    std::optional<std::pair<Reference_bignum::Bignum, Reference_bignum::Bignum>> pub;
+
+    CF_CHECK_NE(curve = Reference_ecc::Curve::Get(op.curveType.Get()), nullptr);
+    CF_CHECK_NE(priv = Reference_bignum::Bignum::FromString(op.priv.ToTrimmedString()), std::nullopt);
+
+    /* Libraries disagree on how to treat keys outside of [1, order) */
+    CF_CHECK_EQ(priv->IsZero(), false);
+    CF_CHECK_LT(Reference_bignum::Bignum::Cmp(*priv, curve->Order()), 0);
+
+    CF_CHECK_NE(pub = curve->ToAffine(curve->MulG(*priv)), std::nullopt);
+
+    ret = { pub->first.ToString(), pub->second.ToString() };
+
+end:
+    return ret;
+}
+
+std::optional<bool> Reference::OpECC_ValidatePubkey(operation::ECC_ValidatePubkey& op) {
+    std::optional<bool> ret = std::nullopt;
+
+    const Reference_ecc::Curve* curve = nullptr;
+
+    CF_CHECK_NE(curve = Reference_ecc::Curve::Get(op.curveType.Get()), nullptr);
+
+    /* Only checks that the point is on the curve, not that it is in the
+     * prime-order subgroup, like most libraries
+     */
+    ret = Reference_detail::ECC_Pubkey(*curve, op.pub) != std::nullopt;
+
+end:
+    return ret;
+}
+
+std::optional<component::ECDSA_Signature> Reference::OpECDSA_Sign(operation::ECDSA_Sign& op) {
+    std::optional<component::ECDSA_Signature> ret = std::nullopt;
+
+    const Reference_ecc::Curve* curve = nullptr;
+    std::optional<Reference_bignum::Bignum> priv, nonce;
+    std::optional<std::vector<uint8_t>> hash;
+    std::optional<std::pair<Reference_bignum::Bignum, Reference_bignum::Bignum>> sig, pub;
+
+    CF_CHECK_NE(curve = Reference_ecc::Curve::Get(op.curveType.Get()), nullptr);
+    CF_CHECK_NE(priv = Reference_bignum::Bignum::FromString(op.priv.ToTrimmedString()), std::nullopt);
+
+    if ( op.UseRFC6979Nonce() ) {
+        /* k is derived with HMAC-SHA256, which is only canonical for SHA256 digests */
+        CF_CHECK_EQ(op.digestType.Get(), CF_DIGEST("SHA256"));
+    } else if ( op.UseSpecifiedNonce() ) {
+        CF_CHECK_NE(nonce = Reference_bignum::Bignum::FromString(op.nonce.ToTrimmedString()), std::nullopt);
+    } else {
+        goto end;
+    }
+
+    CF_CHECK_NE(hash = Reference_detail::ECDSA_Hash(op.digestType, op.cleartext), std::nullopt);
+    CF_CHECK_NE(sig = Reference_ecc::ECDSA_Sign(*curve, *priv, *hash, nonce), std::nullopt);
+    CF_CHECK_NE(pub = curve->ToAffine(curve->MulG(*priv)), std::nullopt);
+
+    if ( op.curveType.Get() == CF_ECC_CURVE("secp256k1") || op.curveType.Get() == CF_ECC_CURVE("secp256r1") ) {
+        /* Low-S normalization, for compatibility with Botan, secp256k1 and trezor-firmware */
+        const auto& order = curve->Order();
+        if ( Reference_bignum::Bignum::Cmp(sig->second, Reference_bignum::Bignum::Shr(order, 1)) > 0 ) {
+            sig->second = Reference_bignum::Bignum::Sub(order, sig->second);
+        }
+    }
+
+    ret = component::ECDSA_Signature(
+            { sig->first.ToString(), sig->second.ToString() },
+            { pub->first.ToString(), pub->second.ToString() });
+
+end:
+    return ret;
+}
+
+std::optional<bool> Reference::OpECDSA_Verify(operation::ECDSA_Verify& op) {
+    std::optional<bool> ret = std::nullopt;
+
+    const Reference_ecc::Curve* curve = nullptr;
+    std::optional<Reference_ecc::Curve::Point> pub;
+    std::optional<Reference_bignum::Bignum> r, s;
+    std::optional<std::vector<uint8_t>> hash;
+
+    CF_CHECK_NE(curve = Reference_ecc::Curve::Get(op.curveType.Get()), nullptr);
+    CF_CHECK_NE(hash = Reference_detail::ECDSA_Hash(op.digestType, op.cleartext), std::nullopt);
+    CF_CHECK_NE(pub = Reference_detail::ECC_Pubkey(*curve, op.signature.pub), std::nullopt);
+    CF_CHECK_NE(r = Reference_bignum::Bignum::FromString(op.signature.signature.first.ToTrimmedString()), std::nullopt);
+    CF_CHECK_NE(s = Reference_bignum::Bignum::FromString(op.signature.signature.second.ToTrimmedString()), std::nullopt);
+
+    ret = Reference_ecc::ECDSA_Verify(*curve, *pub, *r, *s, *hash);
+
+end:
+    return ret;
+}
+
+std::optional<component::ECC_Point> Reference::OpECC_Point_Add(operation::ECC_Point_Add& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+
+    const Reference_ecc::Curve* curve = nullptr;
+    std::optional<Reference_ecc::Curve::Point> a, b;
+    std::optional<std::pair<Reference_bignum::Bignum, Reference_bignum::Bignum>> res;
+
+    CF_CHECK_NE(curve = Reference_ecc::Curve::Get(op.curveType.Get()), nullptr);
+    CF_CHECK_NE(a = Reference_detail::ECC_Pubkey(*curve, op.a), std::nullopt);
+    CF_CHECK_NE(b = Reference_detail::ECC_Pubkey(*curve, op.b), std::nullopt);
+
+    CF_CHECK_NE(res = curve->ToAffine(curve->Add(*a, *b)), std::nullopt);
+
+    ret = { res->first.ToString(), res->second.ToString() };
+
+end:
+    return ret;
+}
+
+std::optional<component::ECC_Point> Reference::OpECC_Point_Mul(operation::ECC_Point_Mul& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+
+    const Reference_ecc::Curve* curve = nullptr;
+    std::optional<Reference_ecc::Curve::Point> a;
+    std::optional<Reference_bignum::Bignum> b;
+    std::optional<std::pair<Reference_bignum::Bignum, Reference_bignum::Bignum>> res;
+
+    CF_CHECK_NE(curve = Reference_ecc::Curve::Get(op.curveType.Get()), nullptr);
+    CF_CHECK_NE(a = Reference_detail::ECC_Pubkey(*curve, op.a), std::nullopt);
+    CF_CHECK_NE(b = Reference_bignum::Bignum::FromString(op.b.ToTrimmedString()), std::nullopt);
+
+    CF_CHECK_NE(res = curve->ToAffine(curve->MulAdd(Reference_bignum::Bignum(0), *b, *a)), std::nullopt);
+
+    ret = { res->first.ToString(), res->second.ToString() };
+
+end:
+    return ret;
+}
+
+std::optional<component::ECC_Point> Reference::OpECC_Point_Dbl(operation::ECC_Point_Dbl& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+
+    const Reference_ecc::Curve* curve = nullptr;
+    std::optional<Reference_ecc::Curve::Point> a;
+    std::optional<std::pair<Reference_bignum::Bignum, Reference_bignum::Bignum>> res;
+
+    CF_CHECK_NE(curve = Reference_ecc::Curve::Get(op.curveType.Get()), nullptr);
+    CF_CHECK_NE(a = Reference_detail::ECC_Pubkey(*curve, op.a), std::nullopt);
+
+    CF_CHECK_NE(res = curve->ToAffine(curve->Dbl(*a)), std::nullopt);
+
+    ret = { res->first.ToString(), res->second.ToString() };
+
+end:
+    return ret;
+}
+
+std::optional<component::ECC_Point> Reference::OpECC_MultiScalarMul(operation::ECC_MultiScalarMul& op) {
+    std::optional<component::ECC_Point> ret = std::nullopt;
+
+    const Reference_ecc::Curve* curve = nullptr;
+    Reference_ecc::Curve::Point sum{{}, {}, {}, true};
+    std::optional<std::pair<Reference_bignum::Bignum, Reference_bignum::Bignum>> res;
+
+    CF_CHECK_NE(curve = Reference_ecc::Curve::Get(op.curveType.Get()), nullptr);
+
+    for (size_t i = 0; i < op.points.size(); i++) {
+        std::optional<Reference_ecc::Curve::Point> point;
+        std::optional<Reference_bignum::Bignum> scalar;
+
+        CF_CHECK_NE(point = Reference_detail::ECC_Pubkey(*curve, op.points[i]), std::nullopt);
+        CF_CHECK_NE(scalar = Reference_bignum::Bignum::FromString(op.scalars[i].ToTrimmedString()), std::nullopt);
+
+        sum = curve->Add(sum, curve->MulAdd(Reference_bignum::Bignum(0), *scalar, *point));
+    }
+
+    CF_CHECK_NE(res = curve->ToAffine(sum), std::nullopt);
+
+    ret = { res->first.ToString(), res->second.ToString() };
+
+end:
+    return ret;
+}
+
 } /* namespace module */
 } /* namespace cryptofuzz */
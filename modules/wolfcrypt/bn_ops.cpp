@@ -1,6 +1,8 @@
 #include <cryptofuzz/util.h>
 #include <cryptofuzz/repository.h>
+#include <cryptofuzz/lru.h>
 #include <fuzzing/datasource/id.hpp>
+#include <memory>
 
 #include "bn_ops.h"
 
@@ -19,6 +21,98 @@ namespace wolfCrypt_bignum_detail {
     static int compare(Bignum& A, Bignum& B) {
         return mp_cmp(A.GetPtr(), B.GetPtr());
     }
+
+#if !defined(WOLFSSL_SP_MATH)
+    /* Montgomery parameters of a modulus. These outlive the input that
+     * created them, so they cannot use the Datasource-bound Bignum.
+     */
+    class MontgomeryContext {
+        public:
+            mp_int m;
+            mp_int norm; /* R mod m */
+            mp_digit rho;
+
+            MontgomeryContext(void) {
+                if ( mp_init_multi(&m, &norm, nullptr, nullptr, nullptr, nullptr) != MP_OKAY ) {
+                    throw std::exception();
+                }
+            }
+
+            ~MontgomeryContext() {
+                /* noret */ mp_clear(&m);
+                /* noret */ mp_clear(&norm);
+            }
+
+            MontgomeryContext(const MontgomeryContext&) = delete;
+            MontgomeryContext& operator=(const MontgomeryContext&) = delete;
+    };
+
+    /* Returns the cached context for the modulus, or nullptr if the
+     * modulus is not odd and positive.
+     */
+    static MontgomeryContext* getMontgomeryContext(Bignum& mod) {
+        static LRUCache<std::vector<uint8_t>, std::unique_ptr<MontgomeryContext>, 16> cache;
+
+        MontgomeryContext* ret = nullptr;
+        mp_int* m = mod.GetPtr();
+        std::vector<uint8_t> key;
+
+        CF_CHECK_FALSE(mp_isneg(m));
+        CF_CHECK_FALSE(mp_iseven(m));
+        CF_CHECK_FALSE(mp_isone(m));
+
+        key.resize(mp_unsigned_bin_size(m));
+        CF_CHECK_EQ(mp_to_unsigned_bin_len(m, key.data(), key.size()), MP_OKAY);
+
+        {
+            auto cached = cache.Get(key);
+            if ( cached != nullptr ) {
+                return cached->get();
+            }
+        }
+
+        {
+            auto mont = std::make_unique<MontgomeryContext>();
+
+            CF_CHECK_EQ(mp_copy(m, &mont->m), MP_OKAY);
+            CF_CHECK_EQ(mp_montgomery_setup(&mont->m, &mont->rho), MP_OKAY);
+            CF_CHECK_EQ(mp_montgomery_calc_normalization(&mont->norm, &mont->m), MP_OKAY);
+
+            ret = cache.Put(key, std::move(mont)).get();
+        }
+
+end:
+        return ret;
+    }
+
+    /* res = A * B mod m, computed on the Montgomery forms of A and B */
+    static bool mulMontgomery(Datasource& ds, MontgomeryContext& mont, Bignum& A, Bignum& B, Bignum& res) {
+        bool ret = false;
+
+        Bignum aR(ds), bR(ds);
+
+        /* Montgomery multiplication requires non-negative inputs less than the modulus */
+        CF_CHECK_FALSE(mp_isneg(A.GetPtr()));
+        CF_CHECK_FALSE(mp_isneg(B.GetPtr()));
+        CF_CHECK_EQ(mp_cmp(A.GetPtr(), &mont.m), MP_LT);
+        CF_CHECK_EQ(mp_cmp(B.GetPtr(), &mont.m), MP_LT);
+
+        CF_CHECK_EQ(mp_mulmod(A.GetPtr(), &mont.norm, &mont.m, aR.GetPtr()), MP_OKAY);
+        CF_CHECK_EQ(mp_mulmod(B.GetPtr(), &mont.norm, &mont.m, bR.GetPtr()), MP_OKAY);
+
+        /* aR * bR / R = abR */
+        CF_CHECK_EQ(mp_mul(aR.GetPtr(), bR.GetPtr(), res.GetPtr()), MP_OKAY);
+        CF_CHECK_EQ(mp_montgomery_reduce(res.GetPtr(), &mont.m, mont.rho), MP_OKAY);
+
+        /* abR / R = ab */
+        CF_CHECK_EQ(mp_montgomery_reduce(res.GetPtr(), &mont.m, mont.rho), MP_OKAY);
+
+        ret = true;
+
+end:
+        return ret;
+    }
+#endif
 }
 
 bool Add::Run(Datasource& ds, Bignum& res, BignumCluster& bn) const {
@@ -427,11 +521,24 @@ end:
 }
 
 bool MulMod::Run(Datasource& ds, Bignum& res, BignumCluster& bn) const {
-    (void)ds;
-
     bool ret = false;
 
-    CF_CHECK_EQ(mp_mulmod(bn[0].GetPtr(), bn[1].GetPtr(), bn[2].GetPtr(), res.GetPtr()), MP_OKAY);
+    switch ( ds.Get<uint8_t>() ) {
+        case    0:
+            CF_CHECK_EQ(mp_mulmod(bn[0].GetPtr(), bn[1].GetPtr(), bn[2].GetPtr(), res.GetPtr()), MP_OKAY);
+            break;
+#if !defined(WOLFSSL_SP_MATH)
+        case    1:
+            {
+                auto mont = wolfCrypt_bignum_detail::getMontgomeryContext(bn[2]);
+                CF_CHECK_NE(mont, nullptr);
+                CF_CHECK_EQ(wolfCrypt_bignum_detail::mulMontgomery(ds, *mont, bn[0], bn[1], res), true);
+            }
+            break;
+#endif
+        default:
+            goto end;
+    }
 
     ret = true;
 
@@ -506,7 +613,20 @@ bool SqrMod::Run(Datasource& ds, Bignum& res, BignumCluster& bn) const {
     (void)res;
     (void)bn;
 #else
-    CF_CHECK_EQ(mp_sqrmod(bn[0].GetPtr(), bn[1].GetPtr(), res.GetPtr()), MP_OKAY);
+    switch ( ds.Get<uint8_t>() ) {
+        case    0:
+            CF_CHECK_EQ(mp_sqrmod(bn[0].GetPtr(), bn[1].GetPtr(), res.GetPtr()), MP_OKAY);
+            break;
+        case    1:
+            {
+                auto mont = wolfCrypt_bignum_detail::getMontgomeryContext(bn[1]);
+                CF_CHECK_NE(mont, nullptr);
+                CF_CHECK_EQ(wolfCrypt_bignum_detail::mulMontgomery(ds, *mont, bn[0], bn[0], res), true);
+            }
+            break;
+        default:
+            goto end;
+    }
 
     ret = true;
 
@@ -1,6 +1,7 @@
 #include "module.h"
 #include <cryptofuzz/util.h>
 #include <cryptofuzz/repository.h>
+#include <cryptofuzz/rng.h>
 #include <fuzzing/datasource/id.hpp>
 
 #if defined(CRYPTOFUZZ_WOLFCRYPT_MMAP_FIXED)
@@ -77,6 +78,10 @@ namespace wolfCrypt_detail {
         (void)ctx;
 
         if (info->algo_type == WC_ALGO_TYPE_RNG) {
+            if ( rng::Generate(info->rng.out, info->rng.sz) == true ) {
+                return 0;
+            }
+
             try {
                 if ( info->rng.sz ) {
                     const auto data = ds->GetData(0, info->rng.sz, info->rng.sz);
@@ -116,6 +121,11 @@ namespace wolfCrypt_detail {
 
     WC_RNG* GetRNG(void) {
 #if defined(WOLF_CRYPTO_CB)
+        /* Draw from the deterministic stream, via CryptoCB */
+        if ( rng::Active() == true ) {
+            return &rng_deterministic;
+        }
+
         if ( ds == nullptr ) {
             return &rng;
         }
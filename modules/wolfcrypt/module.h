@@ -10,6 +10,9 @@ namespace module {
 class wolfCrypt : public Module {
     public:
         wolfCrypt(void);
+        std::optional<std::string> DeterministicRNGScheme(void) const override {
+            return "wolfCrypt";
+        }
         std::optional<component::Digest> OpDigest(operation::Digest& op) override;
         std::optional<component::MAC> OpHMAC(operation::HMAC& op) override;
         std::optional<component::MAC> OpCMAC(operation::CMAC& op) override;
@@ -1,4 +1,6 @@
 #include <cstdint>
+#include <cstring>
+#include <algorithm>
 #include <array>
 #include <fuzzing/datasource/datasource.hpp>
 #include <fuzzing/datasource/id.hpp>
@@ -8,17 +10,15 @@
 #include <cryptofuzz/util.h>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/lexical_cast.hpp>
-#include "repository_tbl.h"
 #include "numbers.h"
 #include "mutatorpool.h"
-#include "third_party/json/json.hpp"
 
-uint32_t PRNG(void)
-{
-    static uint32_t nSeed = 5323;
-    nSeed = (8253729 * nSeed + 2396403);
-    return nSeed  % 32767;
-}
+using cryptofuzz::repository::ModuleLUT;
+using cryptofuzz::repository::OperationLUT;
+using cryptofuzz::repository::CipherLUT;
+using cryptofuzz::repository::DigestLUT;
+using cryptofuzz::repository::ECC_CurveLUT;
+using cryptofuzz::repository::CalcOpLUT;
 
 static std::vector<size_t> SplitLength(size_t left, const size_t numParts) {
     std::vector<size_t> lengths;
@@ -48,25 +48,7 @@ static size_t getDefaultSize(void) {
     return defaultSizes[PRNG() % defaultSizes.size()];
 }
 
-static std::string getBuffer(size_t size, const bool alternativeSize = false) {
-    static const std::array<std::string, 256> hex = {
-        "00", "01", "02", "03", "04", "05", "06", "07", "08", "09", "0a", "0b", "0c", "0d", "0e", "0f",
-        "10", "11", "12", "13", "14", "15", "16", "17", "18", "19", "1a", "1b", "1c", "1d", "1e", "1f",
-        "20", "21", "22", "23", "24", "25", "26", "27", "28", "29", "2a", "2b", "2c", "2d", "2e", "2f",
-        "30", "31", "32", "33", "34", "35", "36", "37", "38", "39", "3a", "3b", "3c", "3d", "3e", "3f",
-        "40", "41", "42", "43", "44", "45", "46", "47", "48", "49", "4a", "4b", "4c", "4d", "4e", "4f",
-        "50", "51", "52", "53", "54", "55", "56", "57", "58", "59", "5a", "5b", "5c", "5d", "5e", "5f",
-        "60", "61", "62", "63", "64", "65", "66", "67", "68", "69", "6a", "6b", "6c", "6d", "6e", "6f",
-        "70", "71", "72", "73", "74", "75", "76", "77", "78", "79", "7a", "7b", "7c", "7d", "7e", "7f",
-        "80", "81", "82", "83", "84", "85", "86", "87", "88", "89", "8a", "8b", "8c", "8d", "8e", "8f",
-        "90", "91", "92", "93", "94", "95", "96", "97", "98", "99", "9a", "9b", "9c", "9d", "9e", "9f",
-        "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "a8", "a9", "aa", "ab", "ac", "ad", "ae", "af",
-        "b0", "b1", "b2", "b3", "b4", "b5", "b6", "b7", "b8", "b9", "ba", "bb", "bc", "bd", "be", "bf",
-        "c0", "c1", "c2", "c3", "c4", "c5", "c6", "c7", "c8", "c9", "ca", "cb", "cc", "cd", "ce", "cf",
-        "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "d8", "d9", "da", "db", "dc", "dd", "de", "df",
-        "e0", "e1", "e2", "e3", "e4", "e5", "e6", "e7", "e8", "e9", "ea", "eb", "ec", "ed", "ee", "ef",
-        "f0", "f1", "f2", "f3", "f4", "f5", "f6", "f7", "f8", "f9", "fa", "fb", "fc", "fd", "fe", "ff"};
-
+static std::vector<uint8_t> getBuffer(size_t size, const bool alternativeSize = false) {
     if ( alternativeSize == true ) {
         if ( getBool() ) {
             const auto newSize = getDefaultSize();
@@ -76,31 +58,118 @@ static std::string getBuffer(size_t size, const bool alternativeSize = false) {
         }
     }
 
-    std::string ret;
+    std::vector<uint8_t> ret(size);
 
-    for (size_t i = 0; i < size; i++) {
-        ret += hex[PRNG() % 256];
+    for (size_t i = 0; i < size; i += sizeof(uint64_t)) {
+        const uint64_t r = PRNG64();
+        memcpy(ret.data() + i, &r, std::min<size_t>(sizeof(r), size - i));
     }
 
     return ret;
 }
 
 static std::string getBignum(const bool positive = false) {
-    if ( Pool_Bignum.Have() && getBool() ) {
+    if ( getBool() ) {
         const auto ret = Pool_Bignum.Get();
-        if ( positive && !ret.empty() && ret[0] == '-' ) {
+        if ( ret == std::nullopt ) {
+            goto end;
+        }
+        if ( positive && !ret->empty() && (*ret)[0] == '-' ) {
             goto end;
         }
-        return ret;
+        return *ret;
     }
 end:
     return numbers[PRNG() % (sizeof(numbers) / sizeof(numbers[0]))];
 }
 
+/* Bignums are serialized as their decimal string */
+static void putBignum(fuzzing::datasource::Datasource& ds, const std::string& bn) {
+    ds.PutData(std::vector<uint8_t>(bn.begin(), bn.end()));
+}
+
+/* A positive number as a big-endian buffer of at least 32 bytes, for use
+ * as a (pre-hashed) message
+ */
+static std::vector<uint8_t> getDigestBuffer(void) {
+    auto ret = *cryptofuzz::util::DecToBin(getBignum(true));
+
+    if ( ret.size() < 32 ) {
+        ret.insert(ret.begin(), 32 - ret.size(), 0);
+    }
+
+    return ret;
+}
+
 extern "C" size_t LLVMFuzzerMutate(uint8_t* data, size_t size, size_t maxSize);
 
 extern cryptofuzz::Options* cryptofuzz_options;
 
+static void putVirtualCleartext(fuzzing::datasource::Datasource& ds) {
+    uint64_t size;
+
+    switch ( PRNG() % 4 ) {
+        case    0:
+            size = PRNG() % 4096;
+            break;
+        case    1:
+            size = PRNG() % (1 << 20);
+            break;
+        case    2:
+            /* Around the 32 bit boundary */
+            size = (1ULL << 32) - 4096 + (PRNG() % 8192);
+            break;
+        default:
+            size = PRNG64() % (1ULL << 45);
+            break;
+    }
+
+    if ( cryptofuzz_options && size > cryptofuzz_options->maxStreamSize ) {
+        size %= cryptofuzz_options->maxStreamSize + 1;
+    }
+
+    /* seed */
+    ds.Put<uint64_t>(PRNG64());
+    /* size */
+    ds.Put<uint64_t>(size % (cryptofuzz::component::VirtualCleartext::MaxSize + 1));
+}
+
+/* Large operands with patterns that stress carry propagation and
+ * normalization in sub-quadratic multiplication and division
+ */
+static std::vector<uint8_t> getLargeBignum(size_t size) {
+    if ( cryptofuzz_options && size > cryptofuzz_options->maxLargeBignumBits / 8 ) {
+        size = cryptofuzz_options->maxLargeBignumBits / 8;
+    }
+
+    switch ( PRNG() % 4 ) {
+        case    0:
+            /* 2^n - 1 */
+            return std::vector<uint8_t>(size, 0xFF);
+        case    1:
+            /* 2^n */
+            {
+                std::vector<uint8_t> ret(size, 0x00);
+                if ( size ) {
+                    ret[0] = 0x01;
+                }
+                return ret;
+            }
+        case    2:
+            /* Long runs of all-ones and all-zeroes limbs */
+            {
+                std::vector<uint8_t> ret;
+                while ( ret.size() < size ) {
+                    const size_t run = std::min<size_t>(size - ret.size(), (1 + PRNG() % 64) * 8);
+                    ret.insert(ret.end(), run, getBool() ? 0xFF : 0x00);
+                }
+                return ret;
+            }
+        default:
+            return getBuffer(size);
+    }
+}
+
 uint64_t getRandomCipher(void) {
     if ( cryptofuzz_options && cryptofuzz_options->ciphers != std::nullopt ) {
         return (*cryptofuzz_options->ciphers)[PRNG() % cryptofuzz_options->ciphers->size()];
@@ -125,8 +194,39 @@ uint64_t getRandomCurve(void) {
     }
 }
 
+/* An entry of a curve pool on one of the curves enabled with --curves */
+template <class T>
+static std::optional<T> getPooled(const MutatorPool<T>& pool) {
+    if ( cryptofuzz_options && cryptofuzz_options->curves != std::nullopt ) {
+        return pool.Get(getRandomCurve());
+    }
+
+    return pool.Get();
+}
+
+/* A bignum, preferably one from the pool of about the size of the order of
+ * the curve
+ */
+static std::string getCurveBignum(const uint64_t curveID) {
+    if ( getBool() ) {
+        const auto order = cryptofuzz::repository::ECC_CurveToOrder(curveID);
+        if ( order != std::nullopt ) {
+            const auto ret = Pool_Bignum.Get(MutatorPoolKey(*order));
+            if ( ret != std::nullopt ) {
+                return *ret;
+            }
+        }
+    }
+
+    return getBignum();
+}
+
+/* Each operation is written directly in the layout of its Serialize()
+ * method, which is what the executor deserializes. Optional fields are
+ * preceded by a bool which is true if the field is absent.
+ */
 extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t maxSize, unsigned int seed) {
-    (void)seed;
+    PRNGSeed(seed);
 
     if ( maxSize < 64 || getBool() ) {
         goto end;
@@ -143,8 +243,6 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
         fuzzing::datasource::Datasource dsOut2(nullptr, 0);
 
-        nlohmann::json parameters;
-
         switch ( operation ) {
             case    CF_OPERATION("Digest"):
                 {
@@ -155,12 +253,10 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["cleartext"] = getBuffer(lengths[1]);
-                    parameters["digestType"] = getRandomDigest();
-
-                    cryptofuzz::operation::Digest op(parameters);
-                    op.Serialize(dsOut2);
+                    /* cleartext */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* digestType */
+                    dsOut2.Put<uint64_t>(getRandomDigest());
                 }
                 break;
             case    CF_OPERATION("HMAC"):
@@ -174,15 +270,14 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["cleartext"] = getBuffer(lengths[1]);
-                    parameters["cipher"]["iv"] = getBuffer(lengths[2], true);
-                    parameters["cipher"]["key"] = getBuffer(lengths[3], true);
-                    parameters["cipher"]["cipherType"] = getRandomCipher();
-                    parameters["digestType"] = getRandomDigest();
-
-                    cryptofuzz::operation::HMAC op(parameters);
-                    op.Serialize(dsOut2);
+                    /* cleartext */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* digestType */
+                    dsOut2.Put<uint64_t>(getRandomDigest());
+                    /* cipher */
+                    dsOut2.PutData(getBuffer(lengths[2], true));
+                    dsOut2.PutData(getBuffer(lengths[3], true));
+                    dsOut2.Put<uint64_t>(getRandomCipher());
                 }
                 break;
             case    CF_OPERATION("CMAC"):
@@ -196,14 +291,12 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["cleartext"] = getBuffer(lengths[1]);
-                    parameters["cipher"]["iv"] = getBuffer(lengths[2], true);
-                    parameters["cipher"]["key"] = getBuffer(lengths[3], true);
-                    parameters["cipher"]["cipherType"] = getRandomCipher();
-
-                    cryptofuzz::operation::CMAC op(parameters);
-                    op.Serialize(dsOut2);
+                    /* cleartext */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* cipher */
+                    dsOut2.PutData(getBuffer(lengths[2], true));
+                    dsOut2.PutData(getBuffer(lengths[3], true));
+                    dsOut2.Put<uint64_t>(getRandomCipher());
                 }
                 break;
             case    CF_OPERATION("SymmetricEncrypt"):
@@ -223,43 +316,45 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
                     auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
                     if ( getBool() ) {
                         if ( 16 < lengths[1] ) {
                             lengths[1] = 16;
                         }
                     }
-                    parameters["cleartext"] = getBuffer(lengths[1]);
 
-                    parameters["cipher"]["iv"] = getBuffer(lengths[2], true);
-                    parameters["cipher"]["key"] = getBuffer(lengths[3], true);
+                    /* cleartext */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+
+                    /* cipher */
+                    dsOut2.PutData(getBuffer(lengths[2], true));
+                    dsOut2.PutData(getBuffer(lengths[3], true));
+                    dsOut2.Put<uint64_t>(getRandomCipher());
 
+                    /* aad */
                     if ( aad_enabled ) {
-                        parameters["aad_enabled"] = true;
                         if ( getBool() ) {
                             lengths[4] = 0;
                         }
-                        parameters["aad"] = getBuffer(lengths[4]);
+                        dsOut2.Put<bool>(false);
+                        dsOut2.PutData(getBuffer(lengths[4]));
                     } else {
-                        parameters["aad_enabled"] = false;
+                        dsOut2.Put<bool>(true);
                     }
 
+                    /* ciphertextSize */
+                    dsOut2.Put<uint64_t>(PRNG() % (lengths[1] + 9));
+
+                    /* tagSize */
                     if ( tagSize_enabled ) {
-                        parameters["tagSize_enabled"] = true;
+                        dsOut2.Put<bool>(false);
                         if ( getBool() ) {
-                            parameters["tagSize"] = getDefaultSize();
+                            dsOut2.Put<uint64_t>(getDefaultSize());
                         } else {
-                            parameters["tagSize"] = PRNG() % 102400;
+                            dsOut2.Put<uint64_t>(PRNG() % 102400);
                         }
                     } else {
-                        parameters["tagSize_enabled"] = false;
+                        dsOut2.Put<bool>(true);
                     }
-
-                    parameters["cipher"]["cipherType"] = getRandomCipher();
-                    parameters["ciphertextSize"] = PRNG() % (lengths[1] + 9);
-
-                    cryptofuzz::operation::SymmetricEncrypt op(parameters);
-                    op.Serialize(dsOut2);
                 }
                 break;
             case    CF_OPERATION("SymmetricDecrypt"):
@@ -282,348 +377,485 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
                     auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
                     if ( getBool() ) {
                         if ( 16 < lengths[1] ) {
                             lengths[1] = 16;
                         }
                     }
-                    parameters["ciphertext"] = getBuffer(lengths[1]);
 
-                    parameters["cipher"]["iv"] = getBuffer(lengths[2], true);
-                    parameters["cipher"]["key"] = getBuffer(lengths[3], true);
+                    /* ciphertext */
+                    dsOut2.PutData(getBuffer(lengths[1]));
 
+                    /* cipher */
+                    dsOut2.PutData(getBuffer(lengths[2], true));
+                    dsOut2.PutData(getBuffer(lengths[3], true));
+                    dsOut2.Put<uint64_t>(getRandomCipher());
+
+                    /* tag */
+                    if ( tag_enabled ) {
+                        dsOut2.Put<bool>(false);
+                        dsOut2.PutData(getBuffer(lengths[aad_enabled ? 5 : 4], true));
+                    } else {
+                        dsOut2.Put<bool>(true);
+                    }
+
+                    /* aad */
                     if ( aad_enabled ) {
-                        parameters["aad_enabled"] = true;
                         if ( getBool() ) {
                             lengths[4] = 0;
                         }
-                        parameters["aad"] = getBuffer(lengths[4]);
+                        dsOut2.Put<bool>(false);
+                        dsOut2.PutData(getBuffer(lengths[4]));
                     } else {
-                        parameters["aad_enabled"] = false;
+                        dsOut2.Put<bool>(true);
                     }
 
-                    if ( tag_enabled ) {
-                        parameters["tag_enabled"] = true;
-                        parameters["tag"] = getBuffer(lengths[aad_enabled ? 5 : 4], true);
-                    } else {
-                        parameters["tag_enabled"] = false;
-                    }
+                    /* cleartextSize */
+                    dsOut2.Put<uint64_t>(PRNG() % (lengths[1] + 9));
+                }
+                break;
+            case    CF_OPERATION("BignumCalc"):
+                {
+                    dsOut2.Put<uint64_t>(CalcOpLUT[ PRNG() % (sizeof(CalcOpLUT) / sizeof(CalcOpLUT[0])) ].id);
+                    putBignum(dsOut2, getBignum());
+                    putBignum(dsOut2, getBignum());
+                    putBignum(dsOut2, getBignum());
+                    putBignum(dsOut2, "");
+                }
+                break;
+            case    CF_OPERATION("BignumCalcLarge"):
+                {
+                    static const std::array calcOps = {
+                        CF_CALCOP("Mul(A,B)"),
+                        CF_CALCOP("Sqr(A)"),
+                        CF_CALCOP("Div(A,B)"),
+                        CF_CALCOP("Mod(A,B)"),
+                        CF_CALCOP("GCD(A,B)"),
+                        CF_CALCOP("MulMod(A,B,C)"),
+                    };
 
-                    parameters["cipher"]["cipherType"] = getRandomCipher();
-                    parameters["cleartextSize"] = PRNG() % (lengths[1] + 9);
+                    size_t numParts = 0;
+
+                    numParts++; /* modifier */
+                    numParts++; /* bn0 */
+                    numParts++; /* bn1 */
+                    numParts++; /* bn2 */
 
-                    cryptofuzz::operation::SymmetricDecrypt op(parameters);
-                    op.Serialize(dsOut2);
+                    const auto lengths = SplitLength(maxSize - 64, numParts);
+
+                    dsOut2.Put<uint64_t>(calcOps[PRNG() % calcOps.size()]);
+                    dsOut2.PutData(getLargeBignum(lengths[1]));
+                    dsOut2.PutData(getLargeBignum(lengths[2]));
+                    dsOut2.PutData(getLargeBignum(lengths[3]));
                 }
                 break;
-            case    CF_OPERATION("BignumCalc"):
+            case    CF_OPERATION("BignumCalcSequence"):
                 {
-                    parameters["modifier"] = getBuffer(PRNG() % 1000);
-                    parameters["calcOp"] = CalcOpLUT[ PRNG() % (sizeof(CalcOpLUT) / sizeof(CalcOpLUT[0])) ].id;
-                    parameters["bn1"] = getBignum();
-                    parameters["bn2"] = getBignum();
-                    parameters["bn3"] = getBignum();
-                    parameters["bn4"] = "";
+                    constexpr size_t numRegisters = cryptofuzz::component::BignumInstruction::NumRegisters;
+
+                    /* registers */
+                    for (size_t i = 0; i < numRegisters; i++) {
+                        putBignum(dsOut2, getBignum());
+                    }
 
-                    cryptofuzz::operation::BignumCalc op(parameters);
-                    op.Serialize(dsOut2);
+                    /* program */
+                    const size_t numInstructions = PRNG() % (cryptofuzz::operation::BignumCalcSequence::MaxInstructions + 1);
+                    dsOut2.Put<uint8_t>(numInstructions);
+                    for (size_t i = 0; i < numInstructions; i++) {
+                        dsOut2.Put<uint64_t>(CalcOpLUT[ PRNG() % (sizeof(CalcOpLUT) / sizeof(CalcOpLUT[0])) ].id);
+                        /* dst, src[4] */
+                        for (size_t j = 0; j < 5; j++) {
+                            dsOut2.Put<uint8_t>(PRNG() % numRegisters);
+                        }
+                    }
                 }
                 break;
             case    CF_OPERATION("ECC_PrivateToPublic"):
                 {
-                    parameters["modifier"] = getBuffer(PRNG() % 1000);
+                    uint64_t curveID;
+                    std::string priv;
 
-                    if ( Pool_CurvePrivkey.Have() && getBool() == true ) {
-                        const auto P1 = Pool_CurvePrivkey.Get();
+                    const auto P1 = getBool() ? getPooled(Pool_CurvePrivkey) : std::nullopt;
 
-                        parameters["curveType"] = P1.curveID;
-                        parameters["priv"] = P1.priv;
+                    if ( P1 != std::nullopt ) {
+                        curveID = P1->curveID;
+                        priv = P1->priv;
                     } else {
-                        const auto curveID = getRandomCurve();
-                        parameters["curveType"] = curveID;
+                        curveID = getRandomCurve();
 
                         if ( getBool() ) {
                             const auto order = cryptofuzz::repository::ECC_CurveToOrder(curveID);
                             if ( order != std::nullopt ) {
                                 const auto o = boost::multiprecision::cpp_int(*order);
-                                parameters["priv"] = boost::lexical_cast<std::string>(o-1);
+                                priv = boost::lexical_cast<std::string>(o-1);
                             } else {
-                                parameters["priv"] = getBignum();
+                                priv = getCurveBignum(curveID);
                             }
                         } else {
-                            parameters["priv"] = getBignum();
+                            priv = getCurveBignum(curveID);
                         }
 
                     }
 
-                    cryptofuzz::operation::ECC_PrivateToPublic op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(curveID);
+                    putBignum(dsOut2, priv);
                 }
                 break;
             case    CF_OPERATION("ECC_ValidatePubkey"):
                 {
-                    parameters["modifier"] = getBuffer(PRNG() % 1000);
+                    const auto P = getPooled(Pool_CurveKeypair);
 
-                    if ( Pool_CurveKeypair.Have() ) {
-                        const auto P = Pool_CurveKeypair.Get();
+                    if ( P != std::nullopt ) {
+                        dsOut2.Put<uint64_t>(P->curveID);
 
-                        parameters["curveType"] = P.curveID;
-
-                        parameters["pub_x"] = getBool() ? getBignum() : P.pub_x;
-                        parameters["pub_y"] = getBool() ? getBignum() : P.pub_y;
+                        putBignum(dsOut2, getBool() ? getCurveBignum(P->curveID) : P->pub_x);
+                        putBignum(dsOut2, getBool() ? getCurveBignum(P->curveID) : P->pub_y);
                     } else {
-                        parameters["curveType"] = getRandomCurve();
-                        parameters["pub_x"] = getBignum();
-                        parameters["pub_y"] = getBignum();
-                    }
+                        const auto curveID = getRandomCurve();
 
-                    cryptofuzz::operation::ECC_ValidatePubkey op(parameters);
-                    op.Serialize(dsOut2);
+                        dsOut2.Put<uint64_t>(curveID);
+                        putBignum(dsOut2, getCurveBignum(curveID));
+                        putBignum(dsOut2, getCurveBignum(curveID));
+                    }
                 }
                 break;
             case    CF_OPERATION("ECDH_Derive"):
                 {
-                    parameters["modifier"] = getBuffer(PRNG() % 1000);
-
-                    if ( Pool_CurvePrivkey.Have() && getBool() == true ) {
-                        const auto P1 = Pool_CurveKeypair.Get();
-                        const auto P2 = Pool_CurveKeypair.Get();
+                    const auto P1 = getBool() ? getPooled(Pool_CurveKeypair) : std::nullopt;
 
-                        CF_CHECK_EQ(P1.curveID, P2.curveID);
+                    if ( P1 != std::nullopt ) {
+                        /* A second key on the same curve, or the same key */
+                        const auto P2 = Pool_CurveKeypair.Get(P1->curveID).value_or(*P1);
 
-                        parameters["curveType"] = P1.curveID;
+                        dsOut2.Put<uint64_t>(P1->curveID);
 
-                        parameters["pub1_x"] = P1.pub_x;
-                        parameters["pub1_y"] = P1.pub_y;
+                        putBignum(dsOut2, P1->pub_x);
+                        putBignum(dsOut2, P1->pub_y);
 
-                        parameters["pub2_x"] = P2.pub_x;
-                        parameters["pub2_y"] = P2.pub_y;
+                        putBignum(dsOut2, P2.pub_x);
+                        putBignum(dsOut2, P2.pub_y);
                     } else {
-                        parameters["curveType"] = getRandomCurve();
+                        const auto curveID = getRandomCurve();
 
-                        parameters["pub1_x"] = getBignum();
-                        parameters["pub1_y"] = getBignum();
+                        dsOut2.Put<uint64_t>(curveID);
 
-                        parameters["pub2_x"] = getBignum();
-                        parameters["pub2_y"] = getBignum();
-                    }
+                        putBignum(dsOut2, getCurveBignum(curveID));
+                        putBignum(dsOut2, getCurveBignum(curveID));
 
-                    cryptofuzz::operation::ECDH_Derive op(parameters);
-                    op.Serialize(dsOut2);
+                        putBignum(dsOut2, getCurveBignum(curveID));
+                        putBignum(dsOut2, getCurveBignum(curveID));
+                    }
                 }
                 break;
             case    CF_OPERATION("ECDSA_Sign"):
                 {
-                    parameters["modifier"] = getBuffer(PRNG() % 1000);
+                    uint64_t curveID;
+                    std::string priv;
 
-                    const auto P1 = Pool_CurvePrivkey.Get();
+                    const auto P1 = getPooled(Pool_CurvePrivkey);
 
-                    parameters["curveType"] = P1.curveID;
-                    parameters["priv"] = P1.priv;
-                    parameters["nonce"] = getBignum();
-
-                    parameters["cleartext"] = cryptofuzz::util::DecToHex(getBignum(true), 64);
-                    parameters["nonceSource"] = PRNG() % 3;
-                    parameters["digestType"] = getRandomDigest();
+                    if ( P1 != std::nullopt ) {
+                        curveID = P1->curveID;
+                        priv = P1->priv;
+                    } else {
+                        curveID = getRandomCurve();
+                        priv = getCurveBignum(curveID);
+                    }
 
-                    cryptofuzz::operation::ECDSA_Sign op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(curveID);
+                    putBignum(dsOut2, priv);
+                    /* nonce */
+                    putBignum(dsOut2, getCurveBignum(curveID));
+                    /* cleartext */
+                    dsOut2.PutData(getDigestBuffer());
+                    /* nonceSource */
+                    dsOut2.Put<uint8_t>(PRNG() % 3);
+                    dsOut2.Put<uint64_t>(getRandomDigest());
                 }
                 break;
             case    CF_OPERATION("ECDSA_Verify"):
                 {
-                    parameters["modifier"] = getBuffer(PRNG() % 1024);
+                    uint64_t curveID;
+                    std::string pub_x, pub_y, sig_r, sig_s;
 
-                    if ( Pool_CurveECDSASignature.Have() == true ) {
-                        const auto P = Pool_CurveECDSASignature.Get();
-                        parameters["curveType"] = P.curveID;
+                    const auto P = getPooled(Pool_CurveECDSASignature);
 
-                        parameters["signature"]["pub"][0] = getBool() ? getBignum() : P.pub_x;
-                        parameters["signature"]["pub"][1] = getBool() ? getBignum() : P.pub_y;
+                    if ( P != std::nullopt ) {
+                        curveID = P->curveID;
 
-                        parameters["signature"]["signature"][0] = getBool() ? getBignum() : P.sig_r;
-                        auto sigS = getBool() ? getBignum() : P.sig_y;
+                        pub_x = getBool() ? getCurveBignum(curveID) : P->pub_x;
+                        pub_y = getBool() ? getCurveBignum(curveID) : P->pub_y;
+
+                        sig_r = getBool() ? getCurveBignum(curveID) : P->sig_r;
+                        sig_s = getBool() ? getCurveBignum(curveID) : P->sig_y;
 
                         if ( getBool() ) {
                             /* Test ECDSA signature malleability */
 
-                            const auto order = cryptofuzz::repository::ECC_CurveToOrder(P.curveID);
+                            const auto order = cryptofuzz::repository::ECC_CurveToOrder(curveID);
                             if ( order != std::nullopt ) {
                                 const auto o = boost::multiprecision::cpp_int(*order);
-                                const auto s = boost::multiprecision::cpp_int(sigS);
+                                const auto s = boost::multiprecision::cpp_int(sig_s);
                                 if ( o > s ) {
-                                    sigS = boost::lexical_cast<std::string>(o - s);
+                                    sig_s = boost::lexical_cast<std::string>(o - s);
                                 }
                             }
                         }
-
-                        parameters["signature"]["signature"][1] = sigS;
                     } else {
-                        parameters["curveType"] = getRandomCurve();
+                        curveID = getRandomCurve();
 
-                        parameters["signature"]["pub"][0] = getBignum();
-                        parameters["signature"]["pub"][1] = getBignum();
+                        /* A valid public key with a random signature */
+                        const auto K = getBool() ? Pool_CurveKeypair.Get(curveID) : std::nullopt;
+                        if ( K != std::nullopt ) {
+                            pub_x = K->pub_x;
+                            pub_y = K->pub_y;
+                        } else {
+                            pub_x = getCurveBignum(curveID);
+                            pub_y = getCurveBignum(curveID);
+                        }
 
-                        parameters["signature"]["signature"][0] = getBignum();
-                        parameters["signature"]["signature"][1] = getBignum();
+                        sig_r = getCurveBignum(curveID);
+                        sig_s = getCurveBignum(curveID);
                     }
 
-                    parameters["cleartext"] = cryptofuzz::util::DecToHex(getBignum(true), 64);
-                    parameters["digestType"] = getRandomDigest();
-
-                    cryptofuzz::operation::ECDSA_Verify op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(curveID);
+                    /* cleartext */
+                    dsOut2.PutData(getDigestBuffer());
+                    /* signature */
+                    putBignum(dsOut2, sig_r);
+                    putBignum(dsOut2, sig_s);
+                    putBignum(dsOut2, pub_x);
+                    putBignum(dsOut2, pub_y);
+                    dsOut2.Put<uint64_t>(getRandomDigest());
                 }
                 break;
             case    CF_OPERATION("ECC_GenerateKeyPair"):
                 {
-                    parameters["modifier"] = getBuffer(PRNG() % 128);
-                    parameters["curveType"] = getRandomCurve();
-
-                    cryptofuzz::operation::ECC_GenerateKeyPair op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(getRandomCurve());
                 }
                 break;
             case    CF_OPERATION("ECIES_Encrypt"):
                 {
-                    parameters["modifier"] = getBuffer(PRNG() % 128);
-                    parameters["cleartext"] = getBuffer(PRNG() % 1024);
-                    //parameters["cipherType"] = getRandomCipher();
-                    parameters["cipherType"] = CF_CIPHER("AES_128_CBC");
-                    parameters["iv_enabled"] = false;
+                    uint64_t curveID;
+                    std::string priv, pub_x, pub_y;
 
-                    parameters["priv"] = getBignum();
+                    const auto P = getBool() ? getPooled(Pool_CurveKeypair) : std::nullopt;
 
-                    if ( Pool_CurveKeypair.Have() && getBool() == true ) {
-                        const auto P = Pool_CurveKeypair.Get();
+                    if ( P != std::nullopt ) {
+                        curveID = P->curveID;
+                        pub_x = P->pub_x;
+                        pub_y = P->pub_y;
+                    } else {
+                        curveID = getRandomCurve();
+                        pub_x = getCurveBignum(curveID);
+                        pub_y = getCurveBignum(curveID);
+                    }
 
-                        parameters["curveType"] = P.curveID;
-                        parameters["pub_x"] = P.pub_x;
-                        parameters["pub_y"] = P.pub_y;
+                    const auto P2 = getBool() ? Pool_CurvePrivkey.Get(curveID) : std::nullopt;
+                    priv = P2 != std::nullopt ? P2->priv : getCurveBignum(curveID);
+
+                    /* cleartext */
+                    dsOut2.PutData(getBuffer(PRNG() % 1024));
+                    dsOut2.Put<uint64_t>(curveID);
+                    putBignum(dsOut2, priv);
+                    putBignum(dsOut2, pub_x);
+                    putBignum(dsOut2, pub_y);
+                    //dsOut2.Put<uint64_t>(getRandomCipher());
+                    dsOut2.Put<uint64_t>(CF_CIPHER("AES_128_CBC"));
+                    /* iv */
+                    dsOut2.Put<bool>(true);
+                }
+                break;
+            case    CF_OPERATION("ECC_Point_Add"):
+                {
+                    uint64_t curveID;
+                    std::string a_x, a_y, b_x, b_y;
 
-                        if ( Pool_CurvePrivkey.Have() && getBool() == true ) {
-                            const auto P2 = Pool_CurvePrivkey.Get();
-                            if ( P2.curveID == P.curveID ) {
-                                parameters["priv"] = P2.priv;
-                            }
-                        }
+                    const auto A = getBool() ? getPooled(Pool_CurveKeypair) : std::nullopt;
+
+                    if ( A != std::nullopt ) {
+                        curveID = A->curveID;
+                        a_x = A->pub_x;
+                        a_y = A->pub_y;
+                    } else {
+                        curveID = getRandomCurve();
+                        a_x = getCurveBignum(curveID);
+                        a_y = getCurveBignum(curveID);
+                    }
+
+                    /* Prefer a second point on the same curve */
+                    const auto B = getBool() ? Pool_CurveKeypair.Get(curveID) : std::nullopt;
+
+                    if ( B != std::nullopt ) {
+                        b_x = B->pub_x;
+                        b_y = B->pub_y;
+                    } else if ( getBool() == true ) {
+                        /* P + P */
+                        b_x = a_x;
+                        b_y = a_y;
                     } else {
-                        parameters["curveType"] = getRandomCurve();
-                        parameters["pub_x"] = getBignum();
-                        parameters["pub_y"] = getBignum();
+                        b_x = getCurveBignum(curveID);
+                        b_y = getCurveBignum(curveID);
                     }
 
-                    cryptofuzz::operation::ECIES_Encrypt op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(curveID);
+                    putBignum(dsOut2, a_x);
+                    putBignum(dsOut2, a_y);
+                    putBignum(dsOut2, b_x);
+                    putBignum(dsOut2, b_y);
                 }
                 break;
-            case    CF_OPERATION("KDF_SCRYPT"):
+            case    CF_OPERATION("ECC_Point_Mul"):
                 {
-                    size_t numParts = 0;
+                    uint64_t curveID;
+                    std::string a_x, a_y, b;
 
-                    numParts++; /* modifier */
-                    numParts++; /* password */
-                    numParts++; /* salt */
+                    const auto A = getBool() ? getPooled(Pool_CurveKeypair) : std::nullopt;
 
-                    const auto lengths = SplitLength(maxSize - 64, numParts);
+                    if ( A != std::nullopt ) {
+                        curveID = A->curveID;
+                        a_x = A->pub_x;
+                        a_y = A->pub_y;
+                    } else {
+                        curveID = getRandomCurve();
+                        a_x = getCurveBignum(curveID);
+                        a_y = getCurveBignum(curveID);
+                    }
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["password"] = getBuffer(lengths[1]);
-                    parameters["salt"] = getBuffer(lengths[2]);
-                    parameters["N"] = PRNG() % 5;
-                    parameters["r"] = PRNG() % 9;
-                    parameters["p"] = PRNG() % 5;
-                    parameters["keySize"] = PRNG() % 1024;
+                    if ( getBool() == true ) {
+                        const auto order = cryptofuzz::repository::ECC_CurveToOrder(curveID);
+                        if ( order != std::nullopt ) {
+                            const auto o = boost::multiprecision::cpp_int(*order);
+                            b = boost::lexical_cast<std::string>(o + (PRNG() % 3) - 1);
+                        } else {
+                            b = getCurveBignum(curveID);
+                        }
+                    } else {
+                        b = getCurveBignum(curveID);
+                    }
 
-                    cryptofuzz::operation::KDF_SCRYPT op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(curveID);
+                    putBignum(dsOut2, a_x);
+                    putBignum(dsOut2, a_y);
+                    putBignum(dsOut2, b);
                 }
                 break;
-            case    CF_OPERATION("KDF_HKDF"):
+            case    CF_OPERATION("ECC_Point_Dbl"):
                 {
-                    size_t numParts = 0;
+                    const auto A = getBool() ? getPooled(Pool_CurveKeypair) : std::nullopt;
 
-                    numParts++; /* modifier */
-                    numParts++; /* password */
-                    numParts++; /* salt */
-                    numParts++; /* info */
+                    if ( A != std::nullopt ) {
+                        dsOut2.Put<uint64_t>(A->curveID);
+                        putBignum(dsOut2, A->pub_x);
+                        putBignum(dsOut2, A->pub_y);
+                    } else {
+                        const auto curveID = getRandomCurve();
 
-                    const auto lengths = SplitLength(maxSize - 64, numParts);
+                        dsOut2.Put<uint64_t>(curveID);
+                        putBignum(dsOut2, getCurveBignum(curveID));
+                        putBignum(dsOut2, getCurveBignum(curveID));
+                    }
+                }
+                break;
+            case    CF_OPERATION("ECC_MultiScalarMul"):
+                {
+                    /* Use the curve of a pooled point, so that the other
+                     * terms can be pooled points on that curve as well
+                     */
+                    const auto P0 = getBool() ? getPooled(Pool_CurveKeypair) : std::nullopt;
+                    const uint64_t curveID = P0 != std::nullopt ? P0->curveID : getRandomCurve();
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["password"] = getBuffer(lengths[1]);
-                    parameters["salt"] = getBuffer(lengths[2]);
-                    parameters["info"] = getBuffer(lengths[3]);
-                    parameters["keySize"] = PRNG() % 17000;
-                    parameters["digestType"] = getRandomDigest();
+                    const size_t numTerms = PRNG() % (cryptofuzz::operation::ECC_MultiScalarMul::MaxTerms + 1);
 
-                    cryptofuzz::operation::KDF_HKDF op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(curveID);
+                    dsOut2.Put<uint8_t>(numTerms);
+
+                    /* points */
+                    for (size_t i = 0; i < numTerms; i++) {
+                        const auto P = getBool() ? Pool_CurveKeypair.Get(curveID) : std::nullopt;
+
+                        if ( P != std::nullopt ) {
+                            putBignum(dsOut2, P->pub_x);
+                            putBignum(dsOut2, P->pub_y);
+                        } else {
+                            putBignum(dsOut2, getCurveBignum(curveID));
+                            putBignum(dsOut2, getCurveBignum(curveID));
+                        }
+                    }
+
+                    /* scalars */
+                    for (size_t i = 0; i < numTerms; i++) {
+                        putBignum(dsOut2, getCurveBignum(curveID));
+                    }
                 }
                 break;
-            case    CF_OPERATION("KDF_TLS1_PRF"):
+            case    CF_OPERATION("KDF_SCRYPT"):
                 {
                     size_t numParts = 0;
 
                     numParts++; /* modifier */
-                    numParts++; /* secret */
-                    numParts++; /* seed */
+                    numParts++; /* password */
+                    numParts++; /* salt */
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["secret"] = getBuffer(lengths[1]);
-                    parameters["seed"] = getBuffer(lengths[2]);
-                    parameters["keySize"] = PRNG() % 1024;
-                    parameters["digestType"] = getRandomDigest();
-
-                    cryptofuzz::operation::KDF_TLS1_PRF op(parameters);
-                    op.Serialize(dsOut2);
+                    /* password */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* salt */
+                    dsOut2.PutData(getBuffer(lengths[2]));
+                    /* N */
+                    dsOut2.Put<uint64_t>(PRNG() % 5);
+                    /* r */
+                    dsOut2.Put<uint64_t>(PRNG() % 9);
+                    /* p */
+                    dsOut2.Put<uint64_t>(PRNG() % 5);
+                    /* keySize */
+                    dsOut2.Put<uint64_t>(PRNG() % 1024);
                 }
                 break;
-            case    CF_OPERATION("KDF_PBKDF"):
+            case    CF_OPERATION("KDF_HKDF"):
                 {
                     size_t numParts = 0;
 
                     numParts++; /* modifier */
                     numParts++; /* password */
                     numParts++; /* salt */
+                    numParts++; /* info */
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["password"] = getBuffer(lengths[1]);
-                    parameters["salt"] = getBuffer(lengths[2]);
-                    parameters["iterations"] = PRNG() % 5;
-                    parameters["keySize"] = PRNG() % 1024;
-                    parameters["digestType"] = getRandomDigest();
-
-                    cryptofuzz::operation::KDF_PBKDF op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(getRandomDigest());
+                    /* password */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* salt */
+                    dsOut2.PutData(getBuffer(lengths[2]));
+                    /* info */
+                    dsOut2.PutData(getBuffer(lengths[3]));
+                    /* keySize */
+                    dsOut2.Put<uint64_t>(PRNG() % 17000);
                 }
                 break;
-            case    CF_OPERATION("KDF_PBKDF1"):
+            case    CF_OPERATION("KDF_TLS1_PRF"):
                 {
                     size_t numParts = 0;
 
                     numParts++; /* modifier */
-                    numParts++; /* password */
-                    numParts++; /* salt */
+                    numParts++; /* secret */
+                    numParts++; /* seed */
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["password"] = getBuffer(lengths[1]);
-                    parameters["salt"] = getBuffer(lengths[2]);
-                    parameters["iterations"] = PRNG() % 5;
-                    parameters["keySize"] = PRNG() % 1024;
-                    parameters["digestType"] = getRandomDigest();
-
-                    cryptofuzz::operation::KDF_PBKDF op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(getRandomDigest());
+                    /* secret */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* seed */
+                    dsOut2.PutData(getBuffer(lengths[2]));
+                    /* keySize */
+                    dsOut2.Put<uint64_t>(PRNG() % 1024);
                 }
                 break;
+            case    CF_OPERATION("KDF_PBKDF"):
+            case    CF_OPERATION("KDF_PBKDF1"):
             case    CF_OPERATION("KDF_PBKDF2"):
                 {
                     size_t numParts = 0;
@@ -634,15 +866,15 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["password"] = getBuffer(lengths[1]);
-                    parameters["salt"] = getBuffer(lengths[2]);
-                    parameters["iterations"] = PRNG() % 5;
-                    parameters["keySize"] = PRNG() % 1024;
-                    parameters["digestType"] = getRandomDigest();
-
-                    cryptofuzz::operation::KDF_PBKDF2 op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(getRandomDigest());
+                    /* password */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* salt */
+                    dsOut2.PutData(getBuffer(lengths[2]));
+                    /* iterations */
+                    dsOut2.Put<uint64_t>(PRNG() % 5);
+                    /* keySize */
+                    dsOut2.Put<uint64_t>(PRNG() % 1024);
                 }
                 break;
             case    CF_OPERATION("KDF_ARGON2"):
@@ -655,17 +887,20 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["password"] = getBuffer(lengths[1]);
-                    parameters["salt"] = getBuffer(lengths[2]);
-                    parameters["type"] = PRNG() % 3;
-                    parameters["threads"] = PRNG() % 256;
-                    parameters["memory"] = PRNG() % (64*1024);
-                    parameters["iterations"] = PRNG() % 3;
-                    parameters["keySize"] = PRNG() % 1024;
-
-                    cryptofuzz::operation::KDF_ARGON2 op(parameters);
-                    op.Serialize(dsOut2);
+                    /* password */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* salt */
+                    dsOut2.PutData(getBuffer(lengths[2]));
+                    /* type */
+                    dsOut2.Put<uint8_t>(PRNG() % 3);
+                    /* threads */
+                    dsOut2.Put<uint8_t>(PRNG() % 256);
+                    /* memory */
+                    dsOut2.Put<uint32_t>(PRNG() % (64*1024));
+                    /* iterations */
+                    dsOut2.Put<uint32_t>(PRNG() % 3);
+                    /* keySize */
+                    dsOut2.Put<uint32_t>(PRNG() % 1024);
                 }
                 break;
             case    CF_OPERATION("KDF_SSH"):
@@ -679,16 +914,17 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["key"] = getBuffer(lengths[1]);
-                    parameters["xcghash"] = getBuffer(lengths[2]);
-                    parameters["session_id"] = getBuffer(lengths[3]);
-                    parameters["type"] = getBuffer(1);
-                    parameters["keySize"] = PRNG() % 1024;
-                    parameters["digestType"] = getRandomDigest();
-
-                    cryptofuzz::operation::KDF_SSH op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(getRandomDigest());
+                    /* key */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* xcghash */
+                    dsOut2.PutData(getBuffer(lengths[2]));
+                    /* session_id */
+                    dsOut2.PutData(getBuffer(lengths[3]));
+                    /* type */
+                    dsOut2.PutData(getBuffer(1));
+                    /* keySize */
+                    dsOut2.Put<uint64_t>(PRNG() % 1024);
                 }
                 break;
             case    CF_OPERATION("KDF_X963"):
@@ -701,14 +937,13 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["secret"] = getBuffer(lengths[1]);
-                    parameters["info"] = getBuffer(lengths[2]);
-                    parameters["keySize"] = PRNG() % 1024;
-                    parameters["digestType"] = getRandomDigest();
-
-                    cryptofuzz::operation::KDF_X963 op(parameters);
-                    op.Serialize(dsOut2);
+                    dsOut2.Put<uint64_t>(getRandomDigest());
+                    /* secret */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* info */
+                    dsOut2.PutData(getBuffer(lengths[2]));
+                    /* keySize */
+                    dsOut2.Put<uint64_t>(PRNG() % 1024);
                 }
                 break;
             case    CF_OPERATION("KDF_SP_800_108"):
@@ -722,56 +957,100 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
 
                     const auto lengths = SplitLength(maxSize - 64, numParts);
 
+                    /* mech */
                     if ( getBool() == true ) {
                         /* MAC = HMAC */
-                        parameters["mech"]["mode"] = true;
-                        parameters["mech"]["type"] = getRandomDigest();
+                        dsOut2.Put<bool>(true);
+                        dsOut2.Put<uint64_t>(getRandomDigest());
                     } else {
                         /* MAC = CMAC */
-                        parameters["mech"]["mode"] = false;
-                        parameters["mech"]["type"] = getRandomCipher();
+                        dsOut2.Put<bool>(false);
+                        dsOut2.Put<uint64_t>(getRandomCipher());
                     }
 
-                    parameters["modifier"] = getBuffer(lengths[0]);
-                    parameters["secret"] = getBuffer(lengths[1]);
-                    parameters["salt"] = getBuffer(lengths[2]);
-                    parameters["label"] = getBuffer(lengths[3]);
-                    parameters["mode"] = PRNG() % 3;
-                    parameters["keySize"] = PRNG() % 17000;
-
-                    cryptofuzz::operation::KDF_SP_800_108 op(parameters);
-                    op.Serialize(dsOut2);
+                    /* secret */
+                    dsOut2.PutData(getBuffer(lengths[1]));
+                    /* salt */
+                    dsOut2.PutData(getBuffer(lengths[2]));
+                    /* label */
+                    dsOut2.PutData(getBuffer(lengths[3]));
+                    /* mode */
+                    dsOut2.Put<uint8_t>(PRNG() % 3);
+                    /* keySize */
+                    dsOut2.Put<uint64_t>(PRNG() % 17000);
                 }
                 break;
             case    CF_OPERATION("DH_GenerateKeyPair"):
                 {
-                    parameters["modifier"] = getBuffer(PRNG() % 1000);
-                    parameters["prime"] = getBignum();
-                    parameters["base"] = getBignum();
-
-                    cryptofuzz::operation::DH_GenerateKeyPair op(parameters);
-                    op.Serialize(dsOut2);
+                    /* prime */
+                    putBignum(dsOut2, getBignum());
+                    /* base */
+                    putBignum(dsOut2, getBignum());
                 }
                 break;
             case    CF_OPERATION("DH_Derive"):
                 {
-                    parameters["modifier"] = getBuffer(PRNG() % 1000);
-                    parameters["prime"] = getBignum();
-                    parameters["base"] = getBignum();
-                    if ( Pool_DH_PublicKey.Have() && getBool() == true ) {
-                        parameters["pub"] = Pool_DH_PublicKey.Get();
-                    } else {
-                        parameters["pub"] = getBignum();
+                    /* prime */
+                    putBignum(dsOut2, getBignum());
+                    /* base */
+                    putBignum(dsOut2, getBignum());
+
+                    /* pub */
+                    {
+                        const auto pooled = getBool() == true ? Pool_DH_PublicKey.Get() : std::nullopt;
+                        putBignum(dsOut2, pooled != std::nullopt ? *pooled : getBignum());
                     }
 
-                    if ( Pool_DH_PrivateKey.Have() && getBool() == true ) {
-                        parameters["priv"] = Pool_DH_PrivateKey.Get();
+                    /* priv */
+                    {
+                        const auto pooled = getBool() == true ? Pool_DH_PrivateKey.Get() : std::nullopt;
+                        putBignum(dsOut2, pooled != std::nullopt ? *pooled : getBignum());
+                    }
+                }
+                break;
+            case    CF_OPERATION("DigestStream"):
+                {
+                    putVirtualCleartext(dsOut2);
+                    dsOut2.Put<uint64_t>(getRandomDigest());
+                }
+                break;
+            case    CF_OPERATION("HMACStream"):
+                {
+                    putVirtualCleartext(dsOut2);
+                    dsOut2.Put<uint64_t>(getRandomDigest());
+                    /* cipher */
+                    dsOut2.PutData(getBuffer(getDefaultSize()));
+                    dsOut2.PutData(getBuffer(getDefaultSize()));
+                    dsOut2.Put<uint64_t>(getRandomCipher());
+                }
+                break;
+            case    CF_OPERATION("SymmetricEncryptStream"):
+                {
+                    const bool aad_enabled = PRNG() % 2;
+                    const bool tagSize_enabled = PRNG() % 2;
+
+                    putVirtualCleartext(dsOut2);
+
+                    /* cipher */
+                    dsOut2.PutData(getBuffer(getDefaultSize()));
+                    dsOut2.PutData(getBuffer(getDefaultSize()));
+                    dsOut2.Put<uint64_t>(getRandomCipher());
+
+                    /* aad */
+                    if ( aad_enabled ) {
+                        dsOut2.Put<bool>(false);
+                        dsOut2.PutData(getBuffer(PRNG() % 100));
                     } else {
-                        parameters["priv"] = getBignum();
+                        dsOut2.Put<bool>(true);
                     }
 
-                    cryptofuzz::operation::DH_Derive op(parameters);
-                    op.Serialize(dsOut2);
+                    /* tagSize */
+                    if ( tagSize_enabled ) {
+                        dsOut2.Put<bool>(false);
+                        dsOut2.Put<uint64_t>(getDefaultSize());
+                    } else {
+                        dsOut2.Put<bool>(true);
+                    }
                 }
                 break;
             default:
@@ -797,6 +1076,7 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
         const auto insertSize = dsOut.GetOut().size();
         if ( insertSize <= maxSize ) {
             memcpy(data, dsOut.GetOut().data(), insertSize);
+            size = insertSize;
 
             /* Fall through to LLVMFuzzerMutate */
         }
@@ -1,31 +1,485 @@
 #include "mutatorpool.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-uint32_t PRNG(void);
+/* SplitMix64. LLVMFuzzerCustomMutator reseeds it from libFuzzer's seed,
+ * so that a mutation does not depend on how many numbers were drawn
+ * before it.
+ */
+static thread_local uint64_t prngState = 0x853C49E6748FEA9BULL;
 
-template <class T, size_t Size>
-void MutatorPool<T, Size>::Set(const T& v) {
-    pool[PRNG() % Size] = v;
-    set = true;
+void PRNGSeed(const uint64_t seed) {
+    prngState = seed;
 }
 
-template <class T, size_t Size>
-bool MutatorPool<T, Size>::Have(void) const {
-	return set;
+uint64_t PRNG64(void) {
+    uint64_t z = (prngState += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
 }
 
-template <class T, size_t Size>
-T MutatorPool<T, Size>::Get(void) const {
-    return pool[PRNG() % Size];
+uint32_t PRNG(void)
+{
+    return PRNG64() >> 32;
 }
 
-MutatorPool<CurvePrivkey_Pair, 64> Pool_CurvePrivkey;
-MutatorPool<CurveKeypair_Pair, 64> Pool_CurveKeypair;
-MutatorPool<CurveECDSASignature_Pair, 64> Pool_CurveECDSASignature;
-MutatorPool<std::string, 64> Pool_Bignum;
-MutatorPool<std::string, 64> Pool_DH_PrivateKey;
-MutatorPool<std::string, 64> Pool_DH_PublicKey;
+/* Shared pools
+ *
+ * The file is a header followed by one MutatorPoolShared per pool, with
+ * the same rings as MutatorPool. Each slot holds an encoded entry and is
+ * guarded by a sequence number: a writer makes it odd, copies the entry
+ * and makes it even again, and a reader discards the copy it took if the
+ * number was odd or has changed. Writers skip a slot that is being written
+ * rather than wait, so neither side ever blocks. A slot left odd by a
+ * process that died while writing it is never used again.
+ */
 
-template class MutatorPool<CurvePrivkey_Pair, 64>;
-template class MutatorPool<CurveKeypair_Pair, 64>;
-template class MutatorPool<CurveECDSASignature_Pair, 64>;
-template class MutatorPool<std::string, 64>;
+static const uint8_t magic[8] = {'C', 'F', 'M', 'P', 'O', 'O', 'L', '3'};
+
+struct MutatorPoolShared {
+    static constexpr size_t NumRings = MutatorPool<std::string>::NumRings;
+    static constexpr size_t RingSize = MutatorPool<std::string>::RingSize;
+    /* Fits the largest bignum the executors store (1000 digits) */
+    static constexpr size_t SlotSize = 1008;
+
+    struct Ring {
+        /* Number of entries ever written; the next one goes to slot
+         * written % RingSize
+         */
+        uint64_t written;
+
+        struct Slot {
+            /* 0 if the slot was never written, odd while it is being written */
+            uint64_t sequence;
+            uint64_t key;
+            uint64_t size;
+            uint8_t data[SlotSize];
+        } slots[RingSize];
+    } rings[NumRings];
+};
+
+namespace {
+
+struct Header {
+    uint8_t magic[8];
+    uint64_t numPools;
+    uint64_t poolSize;
+};
+
+constexpr size_t NumPools = 6;
+
+/* Entries are encoded as their curve ID, if any, followed by their strings,
+ * each prefixed with its length
+ */
+class Encoder {
+    private:
+        uint8_t* out;
+        const size_t max;
+        size_t size = 0;
+    public:
+        bool ok = true;
+
+        Encoder(uint8_t* out, const size_t max) :
+            out(out), max(max)
+        { }
+
+        size_t Size(void) const {
+            return size;
+        }
+
+        void Put(const void* data, const size_t n) {
+            if ( n > max - size ) {
+                ok = false;
+            }
+            if ( ok == true ) {
+                memcpy(out + size, data, n);
+                size += n;
+            }
+        }
+
+        void Put(const uint64_t v) {
+            Put(&v, sizeof(v));
+        }
+
+        void Put(const std::string& s) {
+            Put(static_cast<uint64_t>(s.size()));
+            Put(s.data(), s.size());
+        }
+};
+
+class Decoder {
+    private:
+        const uint8_t* in;
+        size_t left;
+    public:
+        bool ok = true;
+
+        Decoder(const uint8_t* in, const size_t size) :
+            in(in), left(size)
+        { }
+
+        void Get(void* data, const size_t size) {
+            if ( size > left ) {
+                ok = false;
+            }
+            if ( ok == true ) {
+                memcpy(data, in, size);
+                in += size;
+                left -= size;
+            }
+        }
+
+        void Get(uint64_t& v) {
+            Get(&v, sizeof(v));
+        }
+
+        void Get(std::string& s) {
+            uint64_t size = 0;
+            Get(size);
+            if ( ok == false || size > left ) {
+                ok = false;
+                return;
+            }
+            s.assign(reinterpret_cast<const char*>(in), size);
+            in += size;
+            left -= size;
+        }
+};
+
+void encode(Encoder& e, const std::string& v) {
+    e.Put(v);
+}
+
+void decode(Decoder& d, std::string& v) {
+    d.Get(v);
+}
+
+void encode(Encoder& e, const CurvePrivkey_Pair& v) {
+    e.Put(v.curveID);
+    e.Put(v.priv);
+}
+
+void decode(Decoder& d, CurvePrivkey_Pair& v) {
+    d.Get(v.curveID);
+    d.Get(v.priv);
+}
+
+void encode(Encoder& e, const CurveKeypair_Pair& v) {
+    e.Put(v.curveID);
+    e.Put(v.privkey);
+    e.Put(v.pub_x);
+    e.Put(v.pub_y);
+}
+
+void decode(Decoder& d, CurveKeypair_Pair& v) {
+    d.Get(v.curveID);
+    d.Get(v.privkey);
+    d.Get(v.pub_x);
+    d.Get(v.pub_y);
+}
+
+void encode(Encoder& e, const CurveECDSASignature_Pair& v) {
+    e.Put(v.curveID);
+    e.Put(v.pub_x);
+    e.Put(v.pub_y);
+    e.Put(v.sig_r);
+    e.Put(v.sig_y);
+}
+
+void decode(Decoder& d, CurveECDSASignature_Pair& v) {
+    d.Get(v.curveID);
+    d.Get(v.pub_x);
+    d.Get(v.pub_y);
+    d.Get(v.sig_r);
+    d.Get(v.sig_y);
+}
+
+template <class T>
+void sharedSet(MutatorPoolShared* shared, const uint64_t key, const T& v) {
+    uint8_t data[MutatorPoolShared::SlotSize];
+    Encoder e(data, sizeof(data));
+    encode(e, v);
+    if ( e.ok == false ) {
+        /* Does not fit in a slot */
+        return;
+    }
+    const size_t size = e.Size();
+
+    auto& ring = shared->rings[key % MutatorPoolShared::NumRings];
+    auto& slot = ring.slots[__atomic_fetch_add(&ring.written, 1, __ATOMIC_RELAXED) % MutatorPoolShared::RingSize];
+
+    uint64_t sequence = __atomic_load_n(&slot.sequence, __ATOMIC_RELAXED);
+    if ( sequence % 2 == 1 ) {
+        return;
+    }
+    if ( __atomic_compare_exchange_n(&slot.sequence, &sequence, sequence + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED) == false ) {
+        return;
+    }
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memcpy(slot.data, data, size);
+    slot.key = key;
+    slot.size = size;
+
+    __atomic_store_n(&slot.sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+/* Number of slots of the ring that have been written */
+size_t sharedUsed(const MutatorPoolShared::Ring& ring) {
+    return std::min<uint64_t>(__atomic_load_n(&ring.written, __ATOMIC_RELAXED), MutatorPoolShared::RingSize);
+}
+
+template <class T>
+bool sharedGet(const MutatorPoolShared::Ring::Slot& slot, const std::optional<uint64_t> key, T& v) {
+    uint8_t data[MutatorPoolShared::SlotSize];
+
+    const uint64_t sequence = __atomic_load_n(&slot.sequence, __ATOMIC_ACQUIRE);
+    if ( sequence == 0 || sequence % 2 == 1 ) {
+        return false;
+    }
+
+    if ( key != std::nullopt && slot.key != *key ) {
+        return false;
+    }
+
+    const size_t size = slot.size;
+    if ( size > sizeof(data) ) {
+        return false;
+    }
+    memcpy(data, slot.data, size);
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if ( __atomic_load_n(&slot.sequence, __ATOMIC_RELAXED) != sequence ) {
+        return false;
+    }
+
+    Decoder d(data, size);
+    decode(d, v);
+
+    return d.ok;
+}
+
+Header expectedHeader(void) {
+    Header ret;
+
+    memcpy(ret.magic, magic, sizeof(magic));
+    ret.numPools = NumPools;
+    ret.poolSize = sizeof(MutatorPoolShared);
+
+    return ret;
+}
+
+/* Creates the file under a temporary name and links it into place once
+ * the header is written, so that other processes never see it without one
+ */
+bool create(const std::string& path, const size_t size) {
+    bool ret = false;
+    const std::string tmpPath = path + ".tmp." + std::to_string(getpid());
+    int fd = -1;
+    const Header header = expectedHeader();
+
+    fd = open(tmpPath.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if ( fd == -1 ) {
+        goto end;
+    }
+
+    /* Slots are zero-initialized, which marks them as never written */
+    if ( ftruncate(fd, size) != 0 ) {
+        goto end;
+    }
+
+    if ( pwrite(fd, &header, sizeof(header), 0) != sizeof(header) ) {
+        goto end;
+    }
+
+    /* Unlike rename(), fails rather than replace a file created concurrently */
+    if ( link(tmpPath.c_str(), path.c_str()) != 0 && errno != EEXIST ) {
+        goto end;
+    }
+
+    ret = true;
+
+end:
+    if ( fd != -1 ) {
+        close(fd);
+        unlink(tmpPath.c_str());
+    }
+
+    return ret;
+}
+
+} /* namespace */
+
+uint64_t MutatorPoolKey(const CurvePrivkey_Pair& v) {
+    return v.curveID;
+}
+
+uint64_t MutatorPoolKey(const CurveKeypair_Pair& v) {
+    return v.curveID;
+}
+
+uint64_t MutatorPoolKey(const CurveECDSASignature_Pair& v) {
+    return v.curveID;
+}
+
+uint64_t MutatorPoolKey(const std::string& bignum) {
+    const size_t numDigits = bignum.size() - (!bignum.empty() && bignum[0] == '-' ? 1 : 0);
+    return numDigits / 10;
+}
+
+template <class T>
+void MutatorPool<T>::Set(const T& v) {
+    const uint64_t key = MutatorPoolKey(v);
+    const size_t ring = key % NumRings;
+    const size_t slot = written[ring]++ % RingSize;
+
+    pool[ring][slot] = v;
+    keys[ring][slot] = key;
+
+    if ( shared != nullptr ) {
+        sharedSet(shared, key, v);
+    }
+}
+
+template <class T>
+std::optional<T> MutatorPool<T>::Get(void) const {
+    const size_t start = PRNG() % NumRings;
+
+    if ( shared != nullptr ) {
+        for (size_t i = 0; i < NumRings; i++) {
+            const auto& ring = shared->rings[(start + i) % NumRings];
+            const size_t used = sharedUsed(ring);
+            if ( used == 0 ) {
+                continue;
+            }
+
+            T ret;
+            if ( sharedGet(ring.slots[PRNG() % used], std::nullopt, ret) == true ) {
+                return ret;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < NumRings; i++) {
+        const size_t ring = (start + i) % NumRings;
+        if ( written[ring] != 0 ) {
+            return pool[ring][PRNG() % std::min<uint64_t>(written[ring], RingSize)];
+        }
+    }
+
+    return std::nullopt;
+}
+
+template <class T>
+std::optional<T> MutatorPool<T>::Get(const uint64_t key) const {
+    const size_t ring = key % NumRings;
+
+    if ( shared != nullptr ) {
+        const auto& sharedRing = shared->rings[ring];
+        const size_t used = sharedUsed(sharedRing);
+        const size_t start = used ? PRNG() % used : 0;
+
+        for (size_t i = 0; i < used; i++) {
+            T ret;
+            if ( sharedGet(sharedRing.slots[(start + i) % used], key, ret) == true ) {
+                return ret;
+            }
+        }
+    }
+
+    const size_t used = std::min<uint64_t>(written[ring], RingSize);
+    const size_t start = used ? PRNG() % used : 0;
+
+    for (size_t i = 0; i < used; i++) {
+        const size_t slot = (start + i) % used;
+        if ( keys[ring][slot] == key ) {
+            return pool[ring][slot];
+        }
+    }
+
+    return std::nullopt;
+}
+
+template <class T>
+void MutatorPool<T>::Share(MutatorPoolShared* shared) {
+    this->shared = shared;
+}
+
+MutatorPool<CurvePrivkey_Pair> Pool_CurvePrivkey;
+MutatorPool<CurveKeypair_Pair> Pool_CurveKeypair;
+MutatorPool<CurveECDSASignature_Pair> Pool_CurveECDSASignature;
+MutatorPool<std::string> Pool_Bignum;
+MutatorPool<std::string> Pool_DH_PrivateKey;
+MutatorPool<std::string> Pool_DH_PublicKey;
+
+template class MutatorPool<CurvePrivkey_Pair>;
+template class MutatorPool<CurveKeypair_Pair>;
+template class MutatorPool<CurveECDSASignature_Pair>;
+template class MutatorPool<std::string>;
+
+bool MutatorPoolShare(const std::string& path) {
+    bool ret = false;
+    const size_t mapSize = sizeof(Header) + NumPools * sizeof(MutatorPoolShared);
+    int fd = -1;
+    struct stat st;
+    void* map = MAP_FAILED;
+    MutatorPoolShared* pools = nullptr;
+
+    if ( access(path.c_str(), F_OK) != 0 ) {
+        if ( create(path, mapSize) == false ) {
+            goto end;
+        }
+    }
+
+    fd = open(path.c_str(), O_RDWR);
+    if ( fd == -1 ) {
+        goto end;
+    }
+
+    if ( fstat(fd, &st) != 0 ) {
+        goto end;
+    }
+
+    if ( static_cast<size_t>(st.st_size) != mapSize ) {
+        goto end;
+    }
+
+    map = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if ( map == MAP_FAILED ) {
+        goto end;
+    }
+
+    {
+        const Header expected = expectedHeader();
+
+        if ( memcmp(map, &expected, sizeof(expected)) != 0 ) {
+            munmap(map, mapSize);
+            goto end;
+        }
+    }
+
+    /* The mapping stays in place until the process exits */
+    pools = reinterpret_cast<MutatorPoolShared*>(static_cast<uint8_t*>(map) + sizeof(Header));
+
+    Pool_CurvePrivkey.Share(&pools[0]);
+    Pool_CurveKeypair.Share(&pools[1]);
+    Pool_CurveECDSASignature.Share(&pools[2]);
+    Pool_Bignum.Share(&pools[3]);
+    Pool_DH_PrivateKey.Share(&pools[4]);
+    Pool_DH_PublicKey.Share(&pools[5]);
+
+    ret = true;
+
+end:
+    if ( fd != -1 ) {
+        close(fd);
+    }
+
+    return ret;
+}
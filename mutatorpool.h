@@ -1,25 +1,54 @@
 #pragma once
 
 #include <array>
+#include <optional>
 #include <string>
 #include <cstdint>
 
-template <class T, size_t Size>
+/* The mutator's random number generator. The state is per thread. */
+void PRNGSeed(const uint64_t seed);
+uint64_t PRNG64(void);
+uint32_t PRNG(void);
+
+/* A pool in the file shared by MutatorPoolShare() */
+struct MutatorPoolShared;
+
+/* Entries are indexed by a key (see MutatorPoolKey()): each key maps to
+ * one of NumRings rings of RingSize entries, which are overwritten in
+ * order. Keys that map to the same ring share it.
+ */
+template <class T>
 class MutatorPool {
+	public:
+		static constexpr size_t NumRings = 32;
+		static constexpr size_t RingSize = 16;
 	private:
-		std::array<T, Size> pool = {};
-		bool set = false;
+		std::array<std::array<T, RingSize>, NumRings> pool = {};
+		std::array<std::array<uint64_t, RingSize>, NumRings> keys = {};
+		/* Number of entries ever written to each ring */
+		std::array<uint64_t, NumRings> written = {};
+		MutatorPoolShared* shared = nullptr;
 	public:
 		void Set(const T& v);
-		bool Have(void) const;
-		T Get(void) const;
+		/* An entry with any key, if there is one */
+		std::optional<T> Get(void) const;
+		/* An entry with the given key, if there is one */
+		std::optional<T> Get(const uint64_t key) const;
+		void Share(MutatorPoolShared* shared);
 };
 
+/* Maps the file at path, creating it if it does not exist, and backs all
+ * pools by it in addition to their process-local slots. Entries set by any
+ * process that maps the file are visible to all others, and persist in the
+ * file. Returns false on failure, in which case the pools remain local.
+ */
+bool MutatorPoolShare(const std::string& path);
+
 typedef struct {
     uint64_t curveID;
     std::string priv;
 } CurvePrivkey_Pair;
-extern MutatorPool<CurvePrivkey_Pair, 64> Pool_CurvePrivkey;
+extern MutatorPool<CurvePrivkey_Pair> Pool_CurvePrivkey;
 
 typedef struct {
     uint64_t curveID;
@@ -27,7 +56,7 @@ typedef struct {
     std::string pub_x;
     std::string pub_y;
 } CurveKeypair_Pair;
-extern MutatorPool<CurveKeypair_Pair, 64> Pool_CurveKeypair;
+extern MutatorPool<CurveKeypair_Pair> Pool_CurveKeypair;
 
 typedef struct {
     uint64_t curveID;
@@ -36,9 +65,18 @@ typedef struct {
     std::string sig_r;
     std::string sig_y;
 } CurveECDSASignature_Pair;
-extern MutatorPool<CurveECDSASignature_Pair, 64> Pool_CurveECDSASignature;
+extern MutatorPool<CurveECDSASignature_Pair> Pool_CurveECDSASignature;
+
+extern MutatorPool<std::string> Pool_Bignum;
 
-extern MutatorPool<std::string, 64> Pool_Bignum;
+extern MutatorPool<std::string> Pool_DH_PrivateKey;
+extern MutatorPool<std::string> Pool_DH_PublicKey;
 
-extern MutatorPool<std::string, 64> Pool_DH_PrivateKey;
-extern MutatorPool<std::string, 64> Pool_DH_PublicKey;
+/* Curve entries are keyed by their curve ID, and bignums (decimal strings)
+ * by their size: numbers with the same number of decimal digits, divided
+ * by 10, have the same key
+ */
+uint64_t MutatorPoolKey(const CurvePrivkey_Pair& v);
+uint64_t MutatorPoolKey(const CurveKeypair_Pair& v);
+uint64_t MutatorPoolKey(const CurveECDSASignature_Pair& v);
+uint64_t MutatorPoolKey(const std::string& bignum);
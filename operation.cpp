@@ -661,6 +661,153 @@ nlohmann::json ECIES_Encrypt::ToJSON(void) const {
     return j;
 }
 
+std::string ECC_Point_Add::Name(void) const { return "ECC_Point_Add"; }
+std::string ECC_Point_Add::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: ECC_Point_Add" << std::endl;
+    ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
+    ss << "A X: " << a.first.ToString() << std::endl;
+    ss << "A Y: " << a.second.ToString() << std::endl;
+    ss << "B X: " << b.first.ToString() << std::endl;
+    ss << "B Y: " << b.second.ToString() << std::endl;
+
+    return ss.str();
+}
+
+nlohmann::json ECC_Point_Add::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "ECC_Point_Add";
+    j["curveType"] = curveType.ToJSON();
+    j["a_x"] = a.first.ToJSON();
+    j["a_y"] = a.second.ToJSON();
+    j["b_x"] = b.first.ToJSON();
+    j["b_y"] = b.second.ToJSON();
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
+std::string ECC_Point_Mul::Name(void) const { return "ECC_Point_Mul"; }
+std::string ECC_Point_Mul::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: ECC_Point_Mul" << std::endl;
+    ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
+    ss << "A X: " << a.first.ToString() << std::endl;
+    ss << "A Y: " << a.second.ToString() << std::endl;
+    ss << "B: " << b.ToString() << std::endl;
+
+    return ss.str();
+}
+
+nlohmann::json ECC_Point_Mul::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "ECC_Point_Mul";
+    j["curveType"] = curveType.ToJSON();
+    j["a_x"] = a.first.ToJSON();
+    j["a_y"] = a.second.ToJSON();
+    j["b"] = b.ToJSON();
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
+std::string ECC_Point_Dbl::Name(void) const { return "ECC_Point_Dbl"; }
+std::string ECC_Point_Dbl::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: ECC_Point_Dbl" << std::endl;
+    ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
+    ss << "A X: " << a.first.ToString() << std::endl;
+    ss << "A Y: " << a.second.ToString() << std::endl;
+
+    return ss.str();
+}
+
+nlohmann::json ECC_Point_Dbl::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "ECC_Point_Dbl";
+    j["curveType"] = curveType.ToJSON();
+    j["a_x"] = a.first.ToJSON();
+    j["a_y"] = a.second.ToJSON();
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
+std::vector<component::ECC_Point> ECC_MultiScalarMul::getPoints(Datasource& ds, const size_t numTerms) {
+    std::vector<component::ECC_Point> ret;
+
+    for (size_t i = 0; i < numTerms; i++) {
+        ret.push_back(component::ECC_Point(ds));
+    }
+
+    return ret;
+}
+
+std::vector<component::ECC_Point> ECC_MultiScalarMul::getPoints(nlohmann::json json) {
+    std::vector<component::ECC_Point> ret;
+
+    for (size_t i = 0; i < json.size() && i < MaxTerms; i++) {
+        ret.push_back(component::ECC_Point(json[i]));
+    }
+
+    return ret;
+}
+
+std::vector<component::Bignum> ECC_MultiScalarMul::getScalars(Datasource& ds, const size_t numTerms) {
+    std::vector<component::Bignum> ret;
+
+    for (size_t i = 0; i < numTerms; i++) {
+        ret.push_back(component::Bignum(ds));
+    }
+
+    return ret;
+}
+
+std::vector<component::Bignum> ECC_MultiScalarMul::getScalars(nlohmann::json json, const size_t numTerms) {
+    std::vector<component::Bignum> ret;
+
+    for (size_t i = 0; i < numTerms; i++) {
+        if ( i < json.size() ) {
+            ret.push_back(component::Bignum(json[i]));
+        } else {
+            ret.push_back(component::Bignum(std::string("0")));
+        }
+    }
+
+    return ret;
+}
+
+std::string ECC_MultiScalarMul::Name(void) const { return "ECC_MultiScalarMul"; }
+std::string ECC_MultiScalarMul::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: ECC_MultiScalarMul" << std::endl;
+    ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
+    for (size_t i = 0; i < points.size(); i++) {
+        ss << "point " << std::to_string(i) << " X: " << points[i].first.ToString() << std::endl;
+        ss << "point " << std::to_string(i) << " Y: " << points[i].second.ToString() << std::endl;
+        ss << "scalar " << std::to_string(i) << ": " << scalars[i].ToString() << std::endl;
+    }
+
+    return ss.str();
+}
+
+nlohmann::json ECC_MultiScalarMul::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "ECC_MultiScalarMul";
+    j["curveType"] = curveType.ToJSON();
+    j["points"] = nlohmann::json::array();
+    for (const auto& point : points) {
+        j["points"].push_back(point.ToJSON());
+    }
+    j["scalars"] = nlohmann::json::array();
+    for (const auto& scalar : scalars) {
+        j["scalars"].push_back(scalar.ToJSON());
+    }
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
 std::string DH_GenerateKeyPair::Name(void) const { return "DH_GenerateKeyPair"; }
 std::string DH_GenerateKeyPair::ToString(void) const {
     std::stringstream ss;
@@ -731,5 +878,181 @@ nlohmann::json BignumCalc::ToJSON(void) const {
     return j;
 }
 
+std::string BignumCalcLarge::Name(void) const { return "BignumCalcLarge"; }
+std::string BignumCalcLarge::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: BignumCalcLarge" << std::endl;
+    ss << "calc operation: " << repository::CalcOpToString(calcOp.Get()) << std::endl;
+    ss << "bignum 1: " << util::HexDump(bn0.Get()) << std::endl;
+    ss << "bignum 2: " << util::HexDump(bn1.Get()) << std::endl;
+    ss << "bignum 3: " << util::HexDump(bn2.Get()) << std::endl;
+
+    return ss.str();
+}
+
+nlohmann::json BignumCalcLarge::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "BignumCalcLarge";
+    j["calcOp"] = calcOp.ToJSON();
+    j["bn0"] = bn0.ToJSON();
+    j["bn1"] = bn1.ToJSON();
+    j["bn2"] = bn2.ToJSON();
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
+std::vector<component::Bignum> BignumCalcSequence::getRegisters(Datasource& ds) {
+    std::vector<component::Bignum> ret;
+
+    for (size_t i = 0; i < component::BignumInstruction::NumRegisters; i++) {
+        ret.push_back(component::Bignum(ds));
+    }
+
+    return ret;
+}
+
+std::vector<component::Bignum> BignumCalcSequence::getRegisters(nlohmann::json json) {
+    std::vector<component::Bignum> ret;
+
+    for (size_t i = 0; i < component::BignumInstruction::NumRegisters; i++) {
+        if ( i < json.size() ) {
+            ret.push_back(component::Bignum(json[i]));
+        } else {
+            ret.push_back(component::Bignum(std::string("0")));
+        }
+    }
+
+    return ret;
+}
+
+std::vector<component::BignumInstruction> BignumCalcSequence::getProgram(Datasource& ds) {
+    std::vector<component::BignumInstruction> ret;
+
+    const size_t numInstructions = ds.Get<uint8_t>() % (MaxInstructions + 1);
+    for (size_t i = 0; i < numInstructions; i++) {
+        ret.push_back(component::BignumInstruction(ds));
+    }
+
+    return ret;
+}
+
+std::vector<component::BignumInstruction> BignumCalcSequence::getProgram(nlohmann::json json) {
+    std::vector<component::BignumInstruction> ret;
+
+    for (size_t i = 0; i < json.size() && i < MaxInstructions; i++) {
+        ret.push_back(component::BignumInstruction(json[i]));
+    }
+
+    return ret;
+}
+
+std::string BignumCalcSequence::Name(void) const { return "BignumCalcSequence"; }
+std::string BignumCalcSequence::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: BignumCalcSequence" << std::endl;
+    for (size_t i = 0; i < registers.size(); i++) {
+        ss << "register " << std::to_string(i) << ": " << registers[i].ToString() << std::endl;
+    }
+    for (const auto& instr : program) {
+        ss << "r" << std::to_string(instr.dst) << " = " << repository::CalcOpToString(instr.calcOp.Get());
+        ss << " with A..D = r" << std::to_string(instr.src[0]);
+        ss << ", r" << std::to_string(instr.src[1]);
+        ss << ", r" << std::to_string(instr.src[2]);
+        ss << ", r" << std::to_string(instr.src[3]) << std::endl;
+    }
+
+    return ss.str();
+}
+
+nlohmann::json BignumCalcSequence::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "BignumCalcSequence";
+    j["registers"] = nlohmann::json::array();
+    for (const auto& r : registers) {
+        j["registers"].push_back(r.ToJSON());
+    }
+    j["program"] = nlohmann::json::array();
+    for (const auto& instr : program) {
+        j["program"].push_back(instr.ToJSON());
+    }
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
+std::string DigestStream::Name(void) const { return "DigestStream"; }
+std::string DigestStream::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: DigestStream" << std::endl;
+    ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
+    ss << "cleartext seed: " << std::to_string(cleartext.GetSeed()) << std::endl;
+    ss << "cleartext size: " << std::to_string(cleartext.GetSize()) << std::endl;
+
+    return ss.str();
+}
+
+nlohmann::json DigestStream::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "DigestStream";
+    j["cleartext"] = cleartext.ToJSON();
+    j["digestType"] = digestType.ToJSON();
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
+std::string HMACStream::Name(void) const { return "HMACStream"; }
+std::string HMACStream::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: HMACStream" << std::endl;
+    ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
+    ss << "key: " << util::HexDump(cipher.key.Get()) << std::endl;
+    ss << "cleartext seed: " << std::to_string(cleartext.GetSeed()) << std::endl;
+    ss << "cleartext size: " << std::to_string(cleartext.GetSize()) << std::endl;
+
+    return ss.str();
+}
+
+nlohmann::json HMACStream::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "HMACStream";
+    j["cleartext"] = cleartext.ToJSON();
+    j["digestType"] = digestType.ToJSON();
+    j["cipher"] = cipher.ToJSON();
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
+std::string SymmetricEncryptStream::Name(void) const { return "SymmetricEncryptStream"; }
+std::string SymmetricEncryptStream::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: SymmetricEncryptStream" << std::endl;
+    ss << "cleartext seed: " << std::to_string(cleartext.GetSeed()) << std::endl;
+    ss << "cleartext size: " << std::to_string(cleartext.GetSize()) << std::endl;
+    ss << "aad: " << (aad ? util::HexDump(aad->Get()) : "nullopt") << std::endl;
+    ss << "cipher iv: " << util::HexDump(cipher.iv.Get()) << std::endl;
+    ss << "cipher key: " << util::HexDump(cipher.key.Get()) << std::endl;
+    ss << "cipher: " << repository::CipherToString(cipher.cipherType.Get()) << std::endl;
+    ss << "tagSize: " << (tagSize ? std::to_string(*tagSize) : "nullopt") << std::endl;
+
+    return ss.str();
+}
+
+nlohmann::json SymmetricEncryptStream::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "SymmetricEncryptStream";
+    j["cleartext"] = cleartext.ToJSON();
+    j["cipher"] = cipher.ToJSON();
+    j["aad_enabled"] = (bool)(aad != std::nullopt);
+    j["aad"] = aad != std::nullopt ? aad->ToJSON() : "";
+    j["tagSize_enabled"] = (bool)(tagSize != std::nullopt);
+    j["tagSize"] = tagSize != std::nullopt ? *tagSize : 0;
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
 } /* namespace operation */
 } /* namespace cryptofuzz */
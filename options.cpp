@@ -4,7 +4,10 @@
 #include <iostream>
 #include <stdlib.h>
 #include <cryptofuzz/repository.h>
+#include <cryptofuzz/components.h>
+#include <cryptofuzz/resultdb.h>
 #include <cryptofuzz/wycheproof.h>
+#include "mutatorpool.h"
 
 namespace cryptofuzz {
 
@@ -238,6 +241,42 @@ Options::Options(const int argc, char** argv, const std::vector<std::string> ext
             }
 
             this->minModules = static_cast<size_t>(minModules);
+        } else if ( !parts.empty() && parts[0] == "--max-stream-size" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --max-stream-size=" << std::endl;
+                exit(1);
+            }
+
+            const auto& sizeStr = parts[1];
+            const uint64_t maxStreamSize = stoull(sizeStr);
+            if ( maxStreamSize > component::VirtualCleartext::MaxSize ) {
+                std::cout << "max-stream-size must be <= " << std::to_string(component::VirtualCleartext::MaxSize) << std::endl;
+                exit(1);
+            }
+
+            this->maxStreamSize = maxStreamSize;
+        } else if ( !parts.empty() && parts[0] == "--max-large-bignum-bits" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --max-large-bignum-bits=" << std::endl;
+                exit(1);
+            }
+
+            const auto& bitsStr = parts[1];
+            const int maxLargeBignumBits = stoi(bitsStr);
+            if ( maxLargeBignumBits < 8 ) {
+                std::cout << "max-large-bignum-bits must be >= 8" << std::endl;
+                exit(1);
+            }
+
+            this->maxLargeBignumBits = static_cast<size_t>(maxLargeBignumBits);
+        } else if ( !parts.empty() && parts[0] == "--max-large-bignum-cost" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --max-large-bignum-cost=" << std::endl;
+                exit(1);
+            }
+
+            const auto& costStr = parts[1];
+            this->maxLargeBignumCost = stoull(costStr);
         } else if ( !parts.empty() && parts[0] == "--disable-tests" ) {
             if ( parts.size() != 1 ) {
                 std::cout << "Expected no argument after --disable-tests=" << std::endl;
@@ -256,6 +295,61 @@ Options::Options(const int argc, char** argv, const std::vector<std::string> ext
                 exit(1);
             }
             this->noCompare = true;
+        } else if ( !parts.empty() && parts[0] == "--deterministic-rng" ) {
+            if ( parts.size() != 1 ) {
+                std::cout << "Expected no argument after --deterministic-rng=" << std::endl;
+                exit(1);
+            }
+            this->deterministicRNG = true;
+        } else if ( !parts.empty() && parts[0] == "--result-cache" ) {
+            if ( parts.size() != 1 ) {
+                std::cout << "Expected no argument after --result-cache=" << std::endl;
+                exit(1);
+            }
+            this->resultCache = true;
+        } else if ( !parts.empty() && parts[0] == "--result-cache-check" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --result-cache-check=" << std::endl;
+                exit(1);
+            }
+
+            const auto resultCacheCheck = stoull(parts[1]);
+            if ( resultCacheCheck == 0 ) {
+                std::cout << "result-cache-check must be at least 1" << std::endl;
+                exit(1);
+            }
+
+            this->resultCacheCheck = resultCacheCheck;
+        } else if ( !parts.empty() && parts[0] == "--remote-modules" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --remote-modules=" << std::endl;
+                exit(1);
+            }
+
+            std::vector<std::string> paths;
+            boost::split(paths, parts[1], boost::is_any_of(","));
+
+            this->remoteModules = paths;
+        } else if ( !parts.empty() && parts[0] == "--load-module" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --load-module=" << std::endl;
+                exit(1);
+            }
+
+            std::vector<std::string> paths;
+            boost::split(paths, parts[1], boost::is_any_of(","));
+
+            if ( this->loadModules == std::nullopt ) {
+                this->loadModules = std::vector<std::string>{};
+            }
+            this->loadModules->insert(this->loadModules->end(), paths.begin(), paths.end());
+        } else if ( !parts.empty() && parts[0] == "--host-fd" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --host-fd=" << std::endl;
+                exit(1);
+            }
+
+            this->hostFD = stoi(parts[1]);
         } else if ( !parts.empty() && parts[0] == "--dump-json" ) {
             if ( parts.size() != 2 ) {
                 std::cout << "Expected argument after --dump-json=" << std::endl;
@@ -270,6 +364,40 @@ Options::Options(const int argc, char** argv, const std::vector<std::string> ext
                 exit(1);
             }
             this->jsonDumpFP = fp;
+        } else if ( !parts.empty() && parts[0] == "--record-results" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --record-results=" << std::endl;
+                exit(1);
+            }
+
+            ResultDB* db = ResultDB::Open(parts[1], true);
+            if ( db == nullptr ) {
+                std::cout << "Cannot open result database " << parts[1] << std::endl;
+                exit(1);
+            }
+            this->recordResults = db;
+        } else if ( !parts.empty() && parts[0] == "--replay-results" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --replay-results=" << std::endl;
+                exit(1);
+            }
+
+            ResultDB* db = ResultDB::Open(parts[1], false);
+            if ( db == nullptr ) {
+                std::cout << "Cannot open result database " << parts[1] << std::endl;
+                exit(1);
+            }
+            this->replayResults = db;
+        } else if ( !parts.empty() && parts[0] == "--mutator-pool" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --mutator-pool=" << std::endl;
+                exit(1);
+            }
+
+            if ( MutatorPoolShare(parts[1]) == false ) {
+                std::cout << "Cannot open mutator pool " << parts[1] << std::endl;
+                exit(1);
+            }
         } else if ( !parts.empty() && parts[0] == "--from-wycheproof" ) {
             if ( parts.size() != 2 ) {
                 std::cout << "Expected argument after --from-wycheproof=" << std::endl;
@@ -284,8 +412,11 @@ Options::Options(const int argc, char** argv, const std::vector<std::string> ext
                 exit(1);
             }
 
-            Wycheproof wp(wycheproofArgs[0], wycheproofArgs[1]);
-            wp.Run();
+            {
+                /* Destroyed before exit() so that a packed corpus is completed */
+                Wycheproof wp(wycheproofArgs[0], wycheproofArgs[1]);
+                wp.Run();
+            }
 
             exit(0);
         }
@@ -0,0 +1,143 @@
+#include <cryptofuzz/plugin.h>
+#include <cryptofuzz/remote.h>
+#include <cstdio>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <fuzzing/datasource/id.hpp>
+
+/* Defined by libFuzzer, if it is linked in */
+extern "C" {
+    __attribute__((weak)) void __sanitizer_cov_8bit_counters_init(uint8_t* start, uint8_t* stop);
+    __attribute__((weak)) void __sanitizer_cov_pcs_init(const uintptr_t* start, const uintptr_t* stop);
+}
+
+namespace cryptofuzz {
+namespace plugin {
+
+namespace {
+
+class Plugin : public remote::Channel {
+    private:
+        const std::string path;
+        cryptofuzz_plugin_call_t call = nullptr;
+        cryptofuzz_plugin_free_t free = nullptr;
+    public:
+        Plugin(const std::string path, cryptofuzz_plugin_call_t call, cryptofuzz_plugin_free_t free) :
+            path(path), call(call), free(free)
+        { }
+
+        std::optional<std::vector<uint8_t>> Call(const std::vector<uint8_t>& request) override {
+            uint8_t* out = nullptr;
+            size_t outSize = 0;
+
+            if ( call(request.data(), request.size(), &out, &outSize) != 1 ) {
+                return std::nullopt;
+            }
+
+            std::vector<uint8_t> ret(out, out + outSize);
+            free(out);
+
+            return ret;
+        }
+
+        const std::string& GetPath(void) const override {
+            return path;
+        }
+};
+
+[[noreturn]] void fail(const std::string& path, const char* reason) {
+    printf("Cannot load module plugin %s: %s\n", path.c_str(), reason);
+    exit(1);
+}
+
+} /* namespace */
+
+std::vector<std::shared_ptr<Module>> Load(
+        const std::string& path,
+        const std::map<uint64_t, std::shared_ptr<Module> >& loaded) {
+    std::vector<std::shared_ptr<Module>> ret;
+
+    /* The plugin and its dependencies get their own copies of every
+     * library, so that e.g. two versions of OpenSSL can coexist. The
+     * handle is never closed.
+     */
+    void* handle = dlmopen(LM_ID_NEWLM, path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if ( handle == nullptr ) {
+        fail(path, dlerror());
+    }
+
+    const auto abi = reinterpret_cast<cryptofuzz_plugin_abi_t>(dlsym(handle, "cryptofuzz_plugin_abi"));
+    const auto describe = reinterpret_cast<cryptofuzz_plugin_describe_t>(dlsym(handle, "cryptofuzz_plugin_describe"));
+    const auto call = reinterpret_cast<cryptofuzz_plugin_call_t>(dlsym(handle, "cryptofuzz_plugin_call"));
+    const auto free = reinterpret_cast<cryptofuzz_plugin_free_t>(dlsym(handle, "cryptofuzz_plugin_free"));
+    const auto init = reinterpret_cast<cryptofuzz_plugin_init_t>(dlsym(handle, "cryptofuzz_plugin_init"));
+
+    if ( abi == nullptr || describe == nullptr || call == nullptr || free == nullptr ) {
+        fail(path, "not a module plugin");
+    }
+
+    if ( abi() != CF_PLUGIN_ABI_VERSION || init == nullptr ) {
+        fail(path, "ABI version mismatch");
+    }
+
+    /* Let libFuzzer collect the plugin's coverage */
+    init(__sanitizer_cov_8bit_counters_init, __sanitizer_cov_pcs_init);
+
+    std::optional<std::vector<remote::ModuleInfo>> modules = std::nullopt;
+    {
+        uint8_t* out = nullptr;
+        size_t outSize = 0;
+
+        if ( describe(&out, &outSize) != 1 ) {
+            fail(path, "no modules");
+        }
+
+        modules = remote::ParseDescription(std::vector<uint8_t>(out, out + outSize));
+        free(out);
+    }
+
+    if ( modules == std::nullopt ) {
+        fail(path, "malformed module description");
+    }
+
+    auto channel = std::make_shared<Plugin>(path, call, free);
+
+    const auto file = path.substr(path.find_last_of('/') + 1);
+
+    const auto taken = [&](const std::string& name) {
+        const auto ID = fuzzing::datasource::ID(("Cryptofuzz/Module/" + name).c_str());
+
+        if ( loaded.find(ID) != loaded.end() ) {
+            return true;
+        }
+
+        for (const auto& module : ret) {
+            if ( module->ID == ID ) {
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    for (const auto& info : *modules) {
+        auto name = info.name;
+
+        if ( taken(name) ) {
+            name = info.name + "@" + file;
+        }
+        if ( taken(name) ) {
+            name = info.name + "@" + path;
+        }
+        if ( taken(name) ) {
+            fail(path, ("module name " + info.name + " is already in use").c_str());
+        }
+
+        ret.push_back(std::make_shared<remote::RemoteModule>(info, channel, name));
+    }
+
+    return ret;
+}
+
+} /* namespace plugin */
+} /* namespace cryptofuzz */
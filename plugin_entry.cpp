@@ -0,0 +1,99 @@
+/* Exports a module as a plugin for --load-module. Built as a shared object
+ * together with the module and the parts of Cryptofuzz it uses; see the
+ * plugin target in the Makefile.
+ *
+ * CRYPTOFUZZ_PLUGIN_HEADER is the module's header and
+ * CRYPTOFUZZ_PLUGIN_CLASS its class in cryptofuzz::module.
+ */
+
+#include <cryptofuzz/plugin.h>
+#include <cryptofuzz/remote.h>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include CRYPTOFUZZ_PLUGIN_HEADER
+
+namespace {
+
+const std::map<uint64_t, std::shared_ptr<cryptofuzz::Module> >& getModules(void) {
+    static std::map<uint64_t, std::shared_ptr<cryptofuzz::Module> > modules;
+
+    if ( modules.empty() ) {
+        auto module = std::make_shared<cryptofuzz::module::CRYPTOFUZZ_PLUGIN_CLASS>();
+        modules[module->ID] = module;
+    }
+
+    return modules;
+}
+
+/* The plugin is built with -fsanitize-coverage=inline-8bit-counters,pc-table
+ * (see the plugin target in the Makefile). libFuzzer lives in the fuzzer's
+ * link map namespace, out of the plugin's reach, so the instrumentation's
+ * callbacks are defined here instead, and the tables they are given are
+ * passed on by cryptofuzz_plugin_init()
+ */
+std::vector<std::pair<uint8_t*, uint8_t*>>& getCounters(void) {
+    static std::vector<std::pair<uint8_t*, uint8_t*>> counters;
+    return counters;
+}
+
+std::vector<std::pair<const uintptr_t*, const uintptr_t*>>& getPCs(void) {
+    static std::vector<std::pair<const uintptr_t*, const uintptr_t*>> pcs;
+    return pcs;
+}
+
+int output(const std::optional<std::vector<uint8_t>>& data, uint8_t** out, size_t* outSize) {
+    if ( data == std::nullopt ) {
+        return 0;
+    }
+
+    /* At least 1 byte, so that malloc() does not return nullptr */
+    *out = static_cast<uint8_t*>(malloc(data->size() + 1));
+    if ( *out == nullptr ) {
+        abort();
+    }
+    memcpy(*out, data->data(), data->size());
+    *outSize = data->size();
+
+    return 1;
+}
+
+} /* namespace */
+
+extern "C" __attribute__((visibility("default"))) uint32_t cryptofuzz_plugin_abi(void) {
+    return CF_PLUGIN_ABI_VERSION;
+}
+
+/* Called by the constructors of the instrumented code, as the plugin is loaded */
+extern "C" __attribute__((visibility("default"))) void __sanitizer_cov_8bit_counters_init(uint8_t* start, uint8_t* stop) {
+    getCounters().push_back({start, stop});
+}
+
+extern "C" __attribute__((visibility("default"))) void __sanitizer_cov_pcs_init(const uintptr_t* start, const uintptr_t* stop) {
+    getPCs().push_back({start, stop});
+}
+
+extern "C" __attribute__((visibility("default"))) void cryptofuzz_plugin_init(cryptofuzz_plugin_counters_init_t countersInit, cryptofuzz_plugin_pcs_init_t pcsInit) {
+    /* libFuzzer matches each PC table to the counters registered before it */
+    for (size_t i = 0; i < getCounters().size(); i++) {
+        if ( countersInit != nullptr ) {
+            countersInit(getCounters()[i].first, getCounters()[i].second);
+        }
+        if ( pcsInit != nullptr && i < getPCs().size() ) {
+            pcsInit(getPCs()[i].first, getPCs()[i].second);
+        }
+    }
+}
+
+extern "C" __attribute__((visibility("default"))) int cryptofuzz_plugin_describe(uint8_t** out, size_t* outSize) {
+    return output(cryptofuzz::remote::Describe(getModules()), out, outSize);
+}
+
+extern "C" __attribute__((visibility("default"))) int cryptofuzz_plugin_call(const uint8_t* request, const size_t requestSize, uint8_t** out, size_t* outSize) {
+    return output(cryptofuzz::remote::Execute(getModules(), request, requestSize), out, outSize);
+}
+
+extern "C" __attribute__((visibility("default"))) void cryptofuzz_plugin_free(uint8_t* p) {
+    free(p);
+}
@@ -0,0 +1,152 @@
+/* Differential fuzzer for the radix conversions in util.cpp
+ *
+ * Compares HexToDec, DecToHex, DecToBin and BinToDec against the
+ * boost::multiprecision::cpp_int implementations they replaced.
+ */
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <fuzzing/datasource/datasource.hpp>
+#include <cryptofuzz/util.h>
+
+using boost::multiprecision::cpp_int;
+
+static void Abort(const std::string& func, const std::string& input, const std::string& expected, const std::string& result) {
+    printf("%s mismatch\n", func.c_str());
+    printf("Input: %s\n", input.c_str());
+    printf("Expected: %s\n", expected.c_str());
+    printf("Result: %s\n", result.c_str());
+    abort();
+}
+
+/* cpp_int reads a leading zero as an octal prefix */
+static cpp_int FromDec(const std::string& digits) {
+    const auto pos = digits.find_first_not_of('0');
+
+    return pos == std::string::npos ? cpp_int(0) : cpp_int(digits.substr(pos));
+}
+
+static std::string ToDec(const cpp_int& i) {
+    std::stringstream ss;
+    ss << i;
+    return ss.str();
+}
+
+static std::string RefDecToHex(const std::string& digits, const bool negative) {
+    const auto i = FromDec(digits);
+
+    std::stringstream ss;
+    ss << std::hex << i;
+    auto ret = ss.str();
+
+    if ( i == 0 ) {
+        return "00";
+    } else if ( negative == true ) {
+        return "-" + ret;
+    } else if ( ret.size() % 2 != 0 ) {
+        ret = "0" + ret;
+    }
+
+    return ret;
+}
+
+static std::vector<uint8_t> RefDecToBin(const std::string& digits) {
+    std::vector<uint8_t> ret;
+    boost::multiprecision::export_bits(FromDec(digits), std::back_inserter(ret), 8);
+    return ret;
+}
+
+static std::string RefBinToDec(const std::vector<uint8_t>& data) {
+    if ( data.empty() ) {
+        return "0";
+    }
+
+    cpp_int i;
+    boost::multiprecision::import_bits(i, data.data(), data.data() + data.size());
+    return ToDec(i);
+}
+
+static std::string RefHexToDec(const std::string& nibbles, const bool negative) {
+    cpp_int i;
+    for (const auto c : nibbles) {
+        i <<= 4;
+        i += std::stoi(std::string(1, c), nullptr, 16);
+    }
+
+    return (negative ? "-" : "") + ToDec(i);
+}
+
+static std::string ToString(const std::vector<uint8_t>& v) {
+    return cryptofuzz::util::BinToHex(v);
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    fuzzing::datasource::Datasource ds(data, size);
+
+    try {
+        const bool negative = ds.Get<bool>();
+        const auto raw = ds.GetData(0);
+
+        /* Decimal */
+        {
+            std::string digits;
+            for (const auto c : raw) {
+                digits += '0' + (c % 10);
+            }
+            if ( digits.empty() ) {
+                digits = "0";
+            }
+            const std::string input = (negative ? "-" : "") + digits;
+
+            {
+                const auto expected = RefDecToHex(digits, negative);
+                const auto result = cryptofuzz::util::DecToHex(input);
+                if ( result != expected ) {
+                    Abort("DecToHex", input, expected, result);
+                }
+            }
+
+            {
+                const auto expected = RefDecToBin(digits);
+                const auto result = cryptofuzz::util::DecToBin(input);
+                if ( result == std::nullopt || *result != expected ) {
+                    Abort("DecToBin", input, ToString(expected), result == std::nullopt ? "(none)" : ToString(*result));
+                }
+            }
+        }
+
+        /* Hexadecimal */
+        {
+            static const char hexChars[] = "0123456789abcdefABCDEF";
+            std::string nibbles;
+            for (const auto c : raw) {
+                nibbles += hexChars[c % (sizeof(hexChars) - 1)];
+            }
+            if ( !nibbles.empty() ) {
+                const std::string input = (negative ? "-" : "") + nibbles;
+                const auto expected = RefHexToDec(nibbles, negative);
+                const auto result = cryptofuzz::util::HexToDec(input);
+                if ( result != expected ) {
+                    Abort("HexToDec", input, expected, result);
+                }
+            }
+        }
+
+        /* Binary */
+        {
+            const auto expected = RefBinToDec(raw);
+            const auto result = cryptofuzz::util::BinToDec(raw);
+            if ( result != expected ) {
+                Abort("BinToDec", ToString(raw), expected, result);
+            }
+        }
+    } catch ( const fuzzing::datasource::Datasource::OutOfData& ) { }
+
+    return 0;
+}
@@ -0,0 +1,595 @@
+#include <cryptofuzz/remote.h>
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <linux/futex.h>
+#include <new>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace cryptofuzz {
+namespace remote {
+
+/* Messages are a 32-bit length followed by the payload, and may wrap
+ * around the end of the buffer. head and tail count bytes and never wrap.
+ */
+struct Ring {
+    static constexpr size_t Capacity = 16 * 1024 * 1024;
+
+    /* Advanced by the producer */
+    alignas(64) std::atomic<uint64_t> head{0};
+    /* Advanced by the consumer */
+    alignas(64) std::atomic<uint64_t> tail{0};
+    /* Bumped whenever head or tail moves; used as a futex */
+    alignas(64) std::atomic<uint32_t> sequence{0};
+    std::atomic<uint32_t> waiters{0};
+    alignas(64) uint8_t data[Capacity];
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free);
+    static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+    static bool Fits(const size_t size) {
+        return size <= Capacity - sizeof(uint32_t);
+    }
+
+    void write(const uint64_t pos, const uint8_t* p, const size_t n) {
+        const size_t offset = pos % Capacity;
+        const size_t first = std::min(n, Capacity - offset);
+        memcpy(data + offset, p, first);
+        memcpy(data, p + first, n - first);
+    }
+
+    void read(const uint64_t pos, uint8_t* p, const size_t n) const {
+        const size_t offset = pos % Capacity;
+        const size_t first = std::min(n, Capacity - offset);
+        memcpy(p, data + offset, first);
+        memcpy(p + first, data, n - first);
+    }
+
+    void notify(void) {
+        sequence.fetch_add(1);
+        if ( waiters.load() != 0 ) {
+            syscall(SYS_futex, &sequence, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+        }
+    }
+
+    /* Requires Fits(msg.size()) */
+    bool TryPush(const std::vector<uint8_t>& msg) {
+        const uint32_t size = msg.size();
+        const uint64_t h = head.load(std::memory_order_relaxed);
+        const uint64_t t = tail.load(std::memory_order_acquire);
+
+        if ( Capacity - (h - t) < sizeof(size) + size ) {
+            return false;
+        }
+
+        write(h, reinterpret_cast<const uint8_t*>(&size), sizeof(size));
+        write(h + sizeof(size), msg.data(), size);
+        head.store(h + sizeof(size) + size, std::memory_order_release);
+        notify();
+
+        return true;
+    }
+
+    bool TryPop(std::vector<uint8_t>& msg) {
+        const uint64_t t = tail.load(std::memory_order_relaxed);
+        const uint64_t h = head.load(std::memory_order_acquire);
+
+        if ( h == t ) {
+            return false;
+        }
+
+        uint32_t size;
+        read(t, reinterpret_cast<uint8_t*>(&size), sizeof(size));
+        msg.resize(size);
+        read(t + sizeof(size), msg.data(), size);
+        tail.store(t + sizeof(size) + size, std::memory_order_release);
+        notify();
+
+        return true;
+    }
+
+    /* Sleeps until head or tail moves after seen was read, or for at most 100ms */
+    void Wait(const uint32_t seen) {
+        const struct timespec timeout = {0, 100 * 1000 * 1000};
+
+        waiters.fetch_add(1);
+        if ( sequence.load() == seen ) {
+            syscall(SYS_futex, &sequence, FUTEX_WAIT, seen, &timeout, nullptr, 0);
+        }
+        waiters.fetch_sub(1);
+    }
+};
+
+/* Spin briefly before sleeping, since most requests complete quickly */
+static constexpr size_t SpinCount = 256;
+
+namespace {
+    /* Result (de)serialization */
+
+    template <class T>
+    void encodeResult(Datasource& ds, const T& result) {
+        result.Serialize(ds);
+    }
+
+    template <>
+    void encodeResult(Datasource& ds, const bool& result) {
+        ds.Put<bool>(result);
+    }
+
+    template <>
+    void encodeResult(Datasource& ds, const component::BignumTrace& result) {
+        ds.Put<uint64_t>(result.size());
+        for (const auto& bn : result) {
+            bn.Serialize(ds);
+        }
+    }
+
+    template <class T>
+    T decodeResult(Datasource& ds) {
+        return T(ds);
+    }
+
+    template <>
+    bool decodeResult(Datasource& ds) {
+        return ds.Get<bool>();
+    }
+
+    template <>
+    component::BignumTrace decodeResult(Datasource& ds) {
+        component::BignumTrace ret;
+
+        const auto size = ds.Get<uint64_t>();
+        for (uint64_t i = 0; i < size; i++) {
+            ret.push_back(component::Bignum(ds));
+        }
+
+        return ret;
+    }
+
+    std::vector<std::shared_ptr<Host>> hosts;
+}
+
+/* Host */
+
+Host::Host(const std::string path) :
+    path(path)
+{ }
+
+Host::~Host() {
+    if ( pid != -1 ) {
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+    }
+
+    if ( requests != nullptr ) {
+        munmap(requests, 2 * sizeof(Ring));
+    }
+}
+
+const std::string& Host::GetPath(void) const {
+    return path;
+}
+
+void Host::checkAlive(void) const {
+    int status;
+
+    if ( waitpid(pid, &status, WNOHANG) != pid ) {
+        return;
+    }
+
+    /* Most likely a crash in one of the host's modules; abort so that
+     * the input which caused it is reported
+     */
+    if ( WIFSIGNALED(status) ) {
+        printf("Remote module host %s terminated by signal %d\n", path.c_str(), WTERMSIG(status));
+    } else {
+        printf("Remote module host %s exited with status %d\n", path.c_str(), WEXITSTATUS(status));
+    }
+    fflush(stdout);
+
+    abort();
+}
+
+std::optional<std::vector<ModuleInfo>> Host::Start(void) {
+    std::optional<std::vector<ModuleInfo>> ret = std::nullopt;
+    void* map = MAP_FAILED;
+    std::string fdArg;
+
+    /* Not close-on-exec, so that the host inherits it */
+    const int fd = memfd_create("cryptofuzz-host", 0);
+    if ( fd == -1 ) {
+        goto end;
+    }
+
+    if ( ftruncate(fd, 2 * sizeof(Ring)) != 0 ) {
+        goto end;
+    }
+
+    map = mmap(nullptr, 2 * sizeof(Ring), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if ( map == MAP_FAILED ) {
+        goto end;
+    }
+
+    requests = new (map) Ring;
+    responses = new (static_cast<uint8_t*>(map) + sizeof(Ring)) Ring;
+
+    fdArg = "--host-fd=" + std::to_string(fd);
+
+    {
+        char* const argv[] = {
+            const_cast<char*>(path.c_str()),
+            const_cast<char*>(fdArg.c_str()),
+            nullptr };
+
+        if ( posix_spawn(&pid, path.c_str(), nullptr, nullptr, argv, environ) != 0 ) {
+            pid = -1;
+            goto end;
+        }
+    }
+
+    ret = ParseDescription(receive());
+
+end:
+    if ( fd != -1 ) {
+        close(fd);
+    }
+
+    return ret;
+}
+
+std::optional<uint64_t> Host::send(const std::vector<uint8_t>& request) {
+    if ( !Ring::Fits(request.size() + sizeof(uint64_t) + sizeof(uint32_t)) ) {
+        return std::nullopt;
+    }
+
+    const uint64_t seq = sent++;
+
+    fuzzing::datasource::Datasource ds(nullptr, 0);
+    ds.Put<uint64_t>(seq);
+    ds.PutData(request);
+    const auto& msg = ds.GetOut();
+
+    for (size_t spins = 0; ; spins++) {
+        const auto seen = requests->sequence.load();
+
+        if ( requests->TryPush(msg) == true ) {
+            break;
+        }
+
+        /* The host may be waiting for room in the response ring */
+        std::vector<uint8_t> response;
+        while ( responses->TryPop(response) == true ) {
+            Datasource dsResponse(response.data(), response.size());
+            const auto responseSeq = dsResponse.Get<uint64_t>();
+            unclaimed[responseSeq] = dsResponse.Get<bool>() ?
+                std::optional<std::vector<uint8_t>>(dsResponse.GetData(0)) :
+                std::nullopt;
+            received++;
+        }
+
+        if ( spins < SpinCount ) {
+            std::this_thread::yield();
+        } else {
+            requests->Wait(seen);
+            checkAlive();
+        }
+    }
+
+    return seq;
+}
+
+std::vector<uint8_t> Host::receive(void) {
+    std::vector<uint8_t> ret;
+
+    for (size_t spins = 0; ; spins++) {
+        const auto seen = responses->sequence.load();
+
+        if ( responses->TryPop(ret) == true ) {
+            return ret;
+        }
+
+        if ( spins < SpinCount ) {
+            std::this_thread::yield();
+        } else {
+            responses->Wait(seen);
+            checkAlive();
+        }
+    }
+}
+
+void Host::Submit(const std::vector<uint8_t>& request) {
+    if ( pending.find(request) != pending.end() ) {
+        return;
+    }
+
+    const auto seq = send(request);
+    if ( seq != std::nullopt ) {
+        pending[request] = *seq;
+    }
+}
+
+std::optional<std::vector<uint8_t>> Host::Call(const std::vector<uint8_t>& request) {
+    std::optional<uint64_t> seq = std::nullopt;
+
+    {
+        const auto it = pending.find(request);
+        if ( it != pending.end() ) {
+            seq = it->second;
+            pending.erase(it);
+        } else {
+            seq = send(request);
+        }
+    }
+
+    if ( seq == std::nullopt ) {
+        /* Too large for the ring */
+        return std::nullopt;
+    }
+
+    while ( unclaimed.find(*seq) == unclaimed.end() ) {
+        const auto response = receive();
+
+        Datasource ds(response.data(), response.size());
+        const auto responseSeq = ds.Get<uint64_t>();
+        unclaimed[responseSeq] = ds.Get<bool>() ?
+            std::optional<std::vector<uint8_t>>(ds.GetData(0)) :
+            std::nullopt;
+        received++;
+    }
+
+    const auto it = unclaimed.find(*seq);
+    const auto ret = std::move(it->second);
+    unclaimed.erase(it);
+
+    return ret;
+}
+
+void Host::Flush(void) {
+    while ( received < sent ) {
+        /* noret */ receive();
+        received++;
+    }
+
+    pending.clear();
+    unclaimed.clear();
+}
+
+/* RemoteModule */
+
+RemoteModule::RemoteModule(const ModuleInfo& info, std::shared_ptr<Channel> channel, const std::string name) :
+    Module(name),
+    channel(channel),
+    deterministic(info.deterministic),
+    remoteID(fuzzing::datasource::ID(("Cryptofuzz/Module/" + info.name).c_str()))
+{ }
+
+bool RemoteModule::IsDeterministic(void) const {
+    return deterministic;
+}
+
+template <class ResultType>
+std::optional<ResultType> RemoteModule::call(const std::vector<uint8_t>& request) {
+    const auto response = channel->Call(request);
+    if ( response == std::nullopt ) {
+        return std::nullopt;
+    }
+
+    try {
+        Datasource ds(response->data(), response->size());
+        return decodeResult<ResultType>(ds);
+    } catch ( fuzzing::datasource::Datasource::OutOfData ) {
+        printf("Malformed response from remote module %s\n", channel->GetPath().c_str());
+        fflush(stdout);
+        abort();
+    }
+}
+
+#define CF_REMOTE_DEFINE(ResultType, Name) \
+    std::optional<ResultType> RemoteModule::Op##Name(operation::Name& op) { \
+        return call<ResultType>(encode(fuzzing::datasource::ID("Cryptofuzz/Operation/" #Name), op)); \
+    }
+CF_REMOTE_OPERATIONS(CF_REMOTE_DEFINE)
+#undef CF_REMOTE_DEFINE
+
+std::vector<std::shared_ptr<Module>> Spawn(const std::string& path) {
+    std::vector<std::shared_ptr<Module>> ret;
+
+    auto host = std::make_shared<Host>(path);
+
+    const auto modules = host->Start();
+    if ( modules == std::nullopt ) {
+        printf("Cannot start remote module host %s\n", path.c_str());
+        exit(1);
+    }
+
+    for (const auto& info : *modules) {
+        ret.push_back(std::make_shared<RemoteModule>(info, host, info.name));
+    }
+
+    hosts.push_back(host);
+
+    return ret;
+}
+
+void Flush(void) {
+    for (auto& host : hosts) {
+        host->Flush();
+    }
+}
+
+/* Executing requests */
+
+namespace {
+    template <class ResultType, class OperationType>
+    std::optional<std::vector<uint8_t>> execute(
+            Datasource& ds,
+            component::Modifier modifier,
+            Module& module,
+            std::optional<ResultType> (Module::*method)(OperationType&)) {
+        OperationType op(ds, std::move(modifier));
+
+        const auto result = (module.*method)(op);
+        if ( result == std::nullopt ) {
+            return std::nullopt;
+        }
+
+        fuzzing::datasource::Datasource dsOut(nullptr, 0);
+        encodeResult(dsOut, *result);
+
+        return dsOut.GetOut();
+    }
+}
+
+std::vector<uint8_t> Describe(const std::map<uint64_t, std::shared_ptr<Module> >& modules) {
+    fuzzing::datasource::Datasource ds(nullptr, 0);
+
+    ds.Put<uint64_t>(modules.size());
+    for (const auto& module : modules) {
+        /* The other side derives the module ID from the name */
+        ds.PutData(std::vector<uint8_t>(module.second->name.begin(), module.second->name.end()));
+        ds.Put<bool>(module.second->IsDeterministic());
+    }
+
+    return ds.GetOut();
+}
+
+std::optional<std::vector<ModuleInfo>> ParseDescription(const std::vector<uint8_t>& description) {
+    try {
+        Datasource ds(description.data(), description.size());
+        std::vector<ModuleInfo> ret;
+
+        const auto count = ds.Get<uint64_t>();
+        for (uint64_t i = 0; i < count; i++) {
+            const auto name = ds.Get<std::string>();
+            const auto deterministic = ds.Get<bool>();
+            ret.push_back({name, deterministic});
+        }
+
+        return ret;
+    } catch ( fuzzing::datasource::Datasource::OutOfData ) {
+        return std::nullopt;
+    }
+}
+
+std::optional<std::vector<uint8_t>> Execute(
+        const std::map<uint64_t, std::shared_ptr<Module> >& modules,
+        const uint8_t* request,
+        const size_t size) {
+    try {
+        Datasource ds(request, size);
+        const auto moduleID = ds.Get<uint64_t>();
+        const auto operationID = ds.Get<uint64_t>();
+        component::Modifier modifier(ds);
+
+        const auto it = modules.find(moduleID);
+        if ( it == modules.end() ) {
+            return std::nullopt;
+        }
+
+        auto& module = *(it->second);
+
+        switch ( operationID ) {
+#define CF_REMOTE_EXECUTE(ResultType, Name) \
+            case fuzzing::datasource::ID("Cryptofuzz/Operation/" #Name): \
+                return execute<ResultType, operation::Name>(ds, std::move(modifier), module, &Module::Op##Name);
+            CF_REMOTE_OPERATIONS(CF_REMOTE_EXECUTE)
+#undef CF_REMOTE_EXECUTE
+        }
+    } catch ( fuzzing::datasource::Datasource::OutOfData ) { }
+
+    return std::nullopt;
+}
+
+/* Host process */
+
+void Serve(const int fd, const std::map<uint64_t, std::shared_ptr<Module> >& modules) {
+    /* Do not outlive the parent */
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+
+    void* map = mmap(nullptr, 2 * sizeof(Ring), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if ( map == MAP_FAILED ) {
+        printf("Cannot map the shared memory region of the parent\n");
+        exit(1);
+    }
+    close(fd);
+
+    Ring* requests = static_cast<Ring*>(map);
+    Ring* responses = reinterpret_cast<Ring*>(static_cast<uint8_t*>(map) + sizeof(Ring));
+
+    const auto push = [&](const std::vector<uint8_t>& msg) {
+        for (size_t spins = 0; ; spins++) {
+            const auto seen = responses->sequence.load();
+
+            if ( responses->TryPush(msg) == true ) {
+                return;
+            }
+
+            if ( spins < SpinCount ) {
+                std::this_thread::yield();
+            } else {
+                responses->Wait(seen);
+            }
+        }
+    };
+
+    push(Describe(modules));
+
+    std::vector<uint8_t> request;
+
+    while ( true ) {
+        for (size_t spins = 0; ; spins++) {
+            const auto seen = requests->sequence.load();
+
+            if ( requests->TryPop(request) == true ) {
+                break;
+            }
+
+            if ( spins < SpinCount ) {
+                std::this_thread::yield();
+            } else {
+                requests->Wait(seen);
+            }
+        }
+
+        std::optional<std::vector<uint8_t>> result = std::nullopt;
+        uint64_t seq = 0;
+
+        try {
+            Datasource dsRequest(request.data(), request.size());
+            seq = dsRequest.Get<uint64_t>();
+            const auto body = dsRequest.GetData(0);
+
+            result = Execute(modules, body.data(), body.size());
+        } catch ( fuzzing::datasource::Datasource::OutOfData ) { }
+
+        if ( result != std::nullopt && !Ring::Fits(result->size() + 64) ) {
+            /* Too large for the ring */
+            result = std::nullopt;
+        }
+
+        fuzzing::datasource::Datasource ds(nullptr, 0);
+        ds.Put<uint64_t>(seq);
+        ds.Put<bool>(result != std::nullopt);
+        if ( result != std::nullopt ) {
+            ds.PutData(*result);
+        }
+
+        push(ds.GetOut());
+    }
+}
+
+} /* namespace remote */
+} /* namespace cryptofuzz */
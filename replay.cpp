@@ -0,0 +1,373 @@
+/* Runs inputs through the harness without libFuzzer, spread over
+ * multiple worker processes:
+ *
+ *   cryptofuzz-replay [-j<N>] [--timeout=<s>] [--reproducers=<dir>] [options] <path>...
+ *
+ * Each path is a file or a directory which is searched recursively. A
+ * packed corpus (see cryptofuzz-corpus) contributes all of its inputs.
+ * Inputs that crash, abort or time out are reported and copied to the
+ * reproducer directory, and the worker is replaced so that the run
+ * continues. Other options are passed on to the harness.
+ */
+
+#include <cryptofuzz/corpus.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <new>
+#include <signal.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+extern "C" int LLVMFuzzerInitialize(int *argc, char ***argv);
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+namespace {
+
+/* Shared between the parent and the workers */
+struct WorkerState {
+    /* Index of the input being executed, or -1 */
+    std::atomic<int64_t> current;
+    /* When the current input was started */
+    std::atomic<uint64_t> started;
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> totalNs;
+    std::atomic<uint64_t> maxNs;
+    std::atomic<int64_t> slowest;
+};
+
+struct SharedState {
+    /* Index of the next input to execute */
+    std::atomic<uint64_t> next;
+};
+
+struct Input {
+    std::string path;
+    /* Index within a packed corpus, or -1 */
+    int64_t index;
+
+    std::string Name(void) const {
+        return index == -1 ? path : path + "#" + std::to_string(index);
+    }
+};
+
+/* Mapped before the workers are forked, so that they share the mappings */
+std::map<std::string, std::unique_ptr<cryptofuzz::PackedCorpus>> packedCorpora;
+
+struct Failure {
+    std::string path;
+    std::string reason;
+};
+
+uint64_t now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+bool hasPackSuffix(const std::string& path) {
+    return path.size() > 5 && path.compare(path.size() - 5, 5, ".pack") == 0;
+}
+
+/* Only files named on the command line, and files ending in .pack, are
+ * checked for being packed corpora, so that no other file found in a
+ * directory is opened before the workers start
+ */
+void addInput(const std::string& path, const bool named, std::vector<Input>& inputs) {
+    if ( (named == false && hasPackSuffix(path) == false) || cryptofuzz::PackedCorpus::Is(path) == false ) {
+        inputs.push_back({path, -1});
+        return;
+    }
+
+    auto corpus = cryptofuzz::PackedCorpus::Open(path);
+    if ( corpus == nullptr ) {
+        printf("Cannot open packed corpus %s\n", path.c_str());
+        exit(1);
+    }
+
+    for (size_t i = 0; i < corpus->Size(); i++) {
+        inputs.push_back({path, static_cast<int64_t>(i)});
+    }
+
+    packedCorpora[path].reset(corpus);
+}
+
+std::vector<Input> collectInputs(const std::vector<std::string>& paths) {
+    /* Paths, and whether they were named on the command line */
+    std::vector<std::pair<std::string, bool>> files;
+
+    for (const auto& path : paths) {
+        if ( std::filesystem::is_directory(path) ) {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(path)) {
+                if ( entry.is_regular_file() ) {
+                    files.push_back({entry.path().string(), false});
+                }
+            }
+        } else if ( std::filesystem::is_regular_file(path) ) {
+            files.push_back({path, true});
+        } else {
+            printf("Cannot open %s\n", path.c_str());
+            exit(1);
+        }
+    }
+
+    std::sort(files.begin(), files.end());
+
+    std::vector<Input> ret;
+    for (const auto& file : files) {
+        addInput(file.first, file.second, ret);
+    }
+
+    return ret;
+}
+
+std::vector<uint8_t> readInput(const Input& input) {
+    if ( input.index != -1 ) {
+        const auto data = packedCorpora.at(input.path)->Get(input.index);
+        return std::vector<uint8_t>(data.first, data.first + data.second);
+    }
+
+    std::ifstream file(input.path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+[[noreturn]] void runWorker(
+        SharedState* shared,
+        WorkerState& state,
+        const std::vector<Input>& inputs,
+        int argc,
+        char** argv) {
+    LLVMFuzzerInitialize(&argc, &argv);
+
+    while ( true ) {
+        const uint64_t index = shared->next.fetch_add(1);
+        if ( index >= inputs.size() ) {
+            break;
+        }
+
+        const auto data = readInput(inputs[index]);
+
+        state.started = now();
+        state.current = index;
+
+        LLVMFuzzerTestOneInput(data.data(), data.size());
+
+        const uint64_t elapsed = now() - state.started;
+        state.current = -1;
+
+        state.count++;
+        state.totalNs += elapsed;
+        if ( elapsed > state.maxNs ) {
+            state.maxNs = elapsed;
+            state.slowest = index;
+        }
+    }
+
+    fflush(stdout);
+    _exit(0);
+}
+
+} /* namespace */
+
+int main(int argc, char** argv) {
+    size_t numWorkers = std::max<long>(1, sysconf(_SC_NPROCESSORS_ONLN));
+    uint64_t timeout = 0;
+    std::string reproducers;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg(argv[i]);
+
+        if ( arg.rfind("-j", 0) == 0 && arg.size() > 2 ) {
+            numWorkers = std::max(1, atoi(arg.c_str() + 2));
+        } else if ( arg.rfind("--jobs=", 0) == 0 ) {
+            numWorkers = std::max(1, atoi(arg.c_str() + 7));
+        } else if ( arg.rfind("--timeout=", 0) == 0 ) {
+            timeout = strtoull(arg.c_str() + 10, nullptr, 10) * 1000000000ULL;
+        } else if ( arg.rfind("--reproducers=", 0) == 0 ) {
+            reproducers = arg.substr(14);
+            std::filesystem::create_directories(reproducers);
+        } else if ( arg.rfind("-", 0) != 0 ) {
+            paths.push_back(arg);
+        }
+    }
+
+    if ( paths.empty() ) {
+        printf("Usage: %s [-j<N>] [--timeout=<s>] [--reproducers=<dir>] [options] <path>...\n", argv[0]);
+        return 1;
+    }
+
+    const auto inputs = collectInputs(paths);
+
+    numWorkers = std::max<size_t>(1, std::min(numWorkers, inputs.size()));
+
+    const size_t sharedSize = sizeof(SharedState) + numWorkers * sizeof(WorkerState);
+    void* map = mmap(nullptr, sharedSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if ( map == MAP_FAILED ) {
+        printf("Cannot allocate shared memory\n");
+        return 1;
+    }
+
+    auto shared = new (map) SharedState{};
+    auto workers = new (static_cast<uint8_t*>(map) + sizeof(SharedState)) WorkerState[numWorkers]{};
+    for (size_t i = 0; i < numWorkers; i++) {
+        workers[i].current = -1;
+        workers[i].slowest = -1;
+    }
+
+    /* Output of the workers must not be duplicated by buffers inherited through fork() */
+    fflush(stdout);
+
+    std::vector<pid_t> pids(numWorkers, -1);
+    std::vector<bool> timedOut(numWorkers, false);
+
+    const auto spawn = [&](const size_t slot) {
+        const pid_t pid = fork();
+        if ( pid == 0 ) {
+            runWorker(shared, workers[slot], inputs, argc, argv);
+        }
+        if ( pid == -1 ) {
+            printf("Cannot fork\n");
+            exit(1);
+        }
+        pids[slot] = pid;
+        timedOut[slot] = false;
+    };
+
+    const uint64_t start = now();
+
+    for (size_t i = 0; i < numWorkers; i++) {
+        spawn(i);
+    }
+
+    std::vector<Failure> failures;
+    size_t alive = numWorkers;
+
+    while ( alive > 0 ) {
+        int status;
+        const pid_t pid = waitpid(-1, &status, WNOHANG);
+
+        if ( pid <= 0 ) {
+            if ( timeout != 0 ) {
+                const uint64_t t = now();
+
+                for (size_t i = 0; i < numWorkers; i++) {
+                    auto& state = workers[i];
+                    if ( pids[i] != -1 && state.current != -1 && t - state.started > timeout && timedOut[i] == false ) {
+                        timedOut[i] = true;
+                        kill(pids[i], SIGKILL);
+                    }
+                }
+            }
+
+            usleep(10000);
+            continue;
+        }
+
+        const auto it = std::find(pids.begin(), pids.end(), pid);
+        if ( it == pids.end() ) {
+            continue;
+        }
+
+        const size_t slot = it - pids.begin();
+        auto& state = workers[slot];
+        pids[slot] = -1;
+
+        if ( WIFEXITED(status) && WEXITSTATUS(status) == 0 ) {
+            alive--;
+            continue;
+        }
+
+        const int64_t index = state.current;
+        state.current = -1;
+
+        std::string reason;
+        if ( timedOut[slot] == true ) {
+            reason = "timeout";
+        } else if ( WIFSIGNALED(status) ) {
+            reason = std::string("signal ") + strsignal(WTERMSIG(status));
+        } else {
+            reason = "exit status " + std::to_string(WEXITSTATUS(status));
+        }
+
+        if ( index == -1 ) {
+            /* Not caused by an input; a replacement would fail the same way */
+            printf("Worker %zu failed outside of an input (%s)\n", slot, reason.c_str());
+            alive--;
+            continue;
+        }
+
+        const auto& input = inputs[index];
+        printf("FAILURE: %s (%s)\n", input.Name().c_str(), reason.c_str());
+        fflush(stdout);
+
+        failures.push_back({input.Name(), reason});
+
+        if ( !reproducers.empty() ) {
+            const auto dest = std::filesystem::path(reproducers) / std::filesystem::path(input.Name()).filename();
+            if ( input.index == -1 ) {
+                std::error_code ec;
+                std::filesystem::copy_file(input.path, dest, std::filesystem::copy_options::overwrite_existing, ec);
+            } else {
+                const auto data = readInput(input);
+                std::ofstream file(dest, std::ios::binary);
+                file.write(reinterpret_cast<const char*>(data.data()), data.size());
+            }
+        }
+
+        spawn(slot);
+    }
+
+    const double elapsed = (now() - start) / 1e9;
+
+    uint64_t count = 0, totalNs = 0, maxNs = 0;
+    int64_t slowest = -1;
+    for (size_t i = 0; i < numWorkers; i++) {
+        const auto& state = workers[i];
+        count += state.count;
+        totalNs += state.totalNs;
+        if ( state.maxNs > maxNs ) {
+            maxNs = state.maxNs;
+            slowest = state.slowest;
+        }
+    }
+
+    printf("\nReplayed %zu of %zu inputs in %.2f s with %zu workers (%.0f inputs/s)\n",
+            static_cast<size_t>(count), inputs.size(), elapsed, numWorkers, count / std::max(elapsed, 1e-9));
+    if ( count > 0 ) {
+        printf("Average time per input: %.3f ms\n", totalNs / 1e6 / count);
+    }
+    if ( slowest != -1 ) {
+        printf("Slowest input: %s (%.3f s)\n", inputs[slowest].Name().c_str(), maxNs / 1e9);
+    }
+
+    if ( !failures.empty() ) {
+        printf("\n%zu failures:\n", failures.size());
+        for (const auto& failure : failures) {
+            printf("  %s (%s)\n", failure.path.c_str(), failure.reason.c_str());
+        }
+        if ( !reproducers.empty() ) {
+            printf("Reproducers were copied to %s\n", reproducers.c_str());
+        }
+        printf("Reproduce a failure with: ./cryptofuzz <path>\n");
+        if ( !packedCorpora.empty() && reproducers.empty() ) {
+            printf("Use --reproducers=<dir> to extract failing inputs of packed corpora\n");
+        }
+        return 1;
+    }
+
+    return 0;
+}
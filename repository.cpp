@@ -1,175 +1,89 @@
 #include <fuzzing/datasource/id.hpp>
 #include <cryptofuzz/repository.h>
-#include <map>
 #include <cstdint>
 #include <string>
-#include "repository_map.h"
 
 namespace cryptofuzz {
 namespace repository {
 
-bool IsCBC(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).CBC;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
-}
-
-bool IsCCM(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).CCM;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
-}
+namespace {
 
-bool IsCFB(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).CFB;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
-}
-
-bool IsCTR(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).CTR;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
-}
+/* Looks up a name by computing its ID; the name is compared as well, in
+ * case another string hashes to the same ID.
+ */
+template <typename LUT, size_t N>
+long indexOfName(const std::string& prefix, const std::string& s, const LUT (&lut)[N], long (*index)(const uint64_t) noexcept) {
+    const std::string str = "Cryptofuzz/" + prefix + "/" + s;
+    const long ret = index(fuzzing::datasource::hash_64_fnv1a(str.data(), str.size()));
 
-bool IsECB(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).ECB;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
+    return ret != -1 && s == lut[ret].name ? ret : -1;
 }
 
-bool IsGCM(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).GCM;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
-}
+} /* namespace */
 
-bool IsOCB(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).OCB;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
+std::string DigestToString(const uint64_t id) {
+    const long index = DigestLUTIndex(id);
+    return index == -1 ? "(unknown)" : DigestLUT[index].name;
 }
 
-bool IsOFB(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).OFB;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
+std::optional<uint64_t> DigestFromString(const std::string& s) {
+    const long index = indexOfName("Digest", s, DigestLUT, DigestLUTIndex);
+    return index == -1 ? std::nullopt : std::optional<uint64_t>(DigestLUT[index].id);
 }
 
-bool IsXTS(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).XTS;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
+std::string CipherToString(const uint64_t id) {
+    const long index = CipherLUTIndex(id);
+    return index == -1 ? "(unknown)" : CipherLUT[index].name;
 }
 
-bool IsAEAD(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).AEAD;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
+std::optional<uint64_t> CipherFromString(const std::string& s) {
+    const long index = indexOfName("Cipher", s, CipherLUT, CipherLUTIndex);
+    return index == -1 ? std::nullopt : std::optional<uint64_t>(CipherLUT[index].id);
 }
 
-bool IsWRAP(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).WRAP;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
+std::string ECC_CurveToString(const uint64_t id) {
+    const long index = ECC_CurveLUTIndex(id);
+    return index == -1 ? "(unknown)" : ECC_CurveLUT[index].name;
 }
 
-bool IsAES(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).AES;
-    } catch ( std::out_of_range ) {
-        return false;
-    }
+std::optional<uint64_t> ECC_CurveFromString(const std::string& s) {
+    const long index = indexOfName("ECC_Curve", s, ECC_CurveLUT, ECC_CurveLUTIndex);
+    return index == -1 ? std::nullopt : std::optional<uint64_t>(ECC_CurveLUT[index].id);
 }
 
-std::string DigestToString(const uint64_t id) {
-    try {
-        return DigestLUTMap.at(id).name;
-    } catch ( std::out_of_range ) {
-        return "(unknown)";
-    }
+std::optional<std::string> ECC_CurveToOrder(const uint64_t id) {
+    const long index = ECC_CurveLUTIndex(id);
+    return index == -1 ? std::nullopt : ECC_CurveLUT[index].order;
 }
 
-std::optional<uint64_t> DigestFromString(const std::string& s) {
-    for (const auto& curve : DigestLUTMap) {
-        if ( s == curve.second.name ) {
-            return curve.first;
-        }
-    }
-
-    return std::nullopt;
+std::optional<std::string> ECC_CurveToPrime(const uint64_t id) {
+    const long index = ECC_CurveLUTIndex(id);
+    return index == -1 ? std::nullopt : ECC_CurveLUT[index].prime;
 }
 
-std::string CipherToString(const uint64_t id) {
-    try {
-        return CipherLUTMap.at(id).name;
-    } catch ( std::out_of_range ) {
-        return "(unknown)";
-    }
+std::optional<std::string> ECC_CurveToA(const uint64_t id) {
+    const long index = ECC_CurveLUTIndex(id);
+    return index == -1 ? std::nullopt : ECC_CurveLUT[index].a;
 }
 
-std::string ECC_CurveToString(const uint64_t id) {
-    try {
-        return ECC_CurveLUTMap.at(id).name;
-    } catch ( std::out_of_range ) {
-        return "(unknown)";
-    }
+std::optional<std::string> ECC_CurveToB(const uint64_t id) {
+    const long index = ECC_CurveLUTIndex(id);
+    return index == -1 ? std::nullopt : ECC_CurveLUT[index].b;
 }
 
-std::optional<uint64_t> ECC_CurveFromString(const std::string& s) {
-    for (const auto& curve : ECC_CurveLUTMap) {
-        if ( s == curve.second.name ) {
-            return curve.first;
-        }
-    }
-
-    return std::nullopt;
+std::optional<std::string> ECC_CurveToX(const uint64_t id) {
+    const long index = ECC_CurveLUTIndex(id);
+    return index == -1 ? std::nullopt : ECC_CurveLUT[index].x;
 }
 
-std::optional<std::string> ECC_CurveToOrder(const uint64_t id) {
-    try {
-        return ECC_CurveLUTMap.at(id).order;
-    } catch ( std::out_of_range ) {
-        return std::nullopt;
-    }
+std::optional<std::string> ECC_CurveToY(const uint64_t id) {
+    const long index = ECC_CurveLUTIndex(id);
+    return index == -1 ? std::nullopt : ECC_CurveLUT[index].y;
 }
 
 std::string CalcOpToString(const uint64_t id) {
-    try {
-        return CalcOpLUTMap.at(id).name;
-    } catch ( std::out_of_range ) {
-        return "(unknown)";
-    }
-}
-
-std::optional<size_t> DigestSize(const uint64_t id) {
-    try {
-        return DigestLUTMap.at(id).size;
-    } catch ( std::out_of_range ) {
-        return std::nullopt;
-    }
+    const long index = CalcOpLUTIndex(id);
+    return index == -1 ? "(unknown)" : CalcOpLUT[index].name;
 }
 
 } /* namespace repository */
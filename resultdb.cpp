@@ -0,0 +1,179 @@
+#include <cryptofuzz/resultdb.h>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cryptofuzz {
+
+static const uint8_t magic[8] = {'C', 'F', 'R', 'E', 'S', 'D', 'B', '1'};
+
+ResultDB::ResultDB(const bool writable) :
+    writable(writable)
+{ }
+
+ResultDB::~ResultDB() {
+    if ( map != nullptr ) {
+        munmap(map, mapSize);
+    }
+}
+
+uint64_t ResultDB::tagOf(const Key& key) {
+    uint64_t ret;
+    memcpy(&ret, key.data(), sizeof(ret));
+
+    /* 0 marks an unused slot */
+    return ret == 0 ? 1 : ret;
+}
+
+/* Creates the database at path, unless it exists. The database is set up
+ * under a temporary name and then linked to path, so that another process
+ * opening path never sees it without a header.
+ */
+bool ResultDB::create(const std::string& path, const uint64_t numSlots) {
+    bool ret = false;
+    const std::string tmpPath = path + ".tmp." + std::to_string(getpid());
+    int fd = -1;
+    Header header;
+
+    fd = open(tmpPath.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if ( fd == -1 ) {
+        goto end;
+    }
+
+    /* Slots are zero-initialized; the file is sparse until they are used */
+    if ( ftruncate(fd, sizeof(Header) + numSlots * sizeof(Slot)) != 0 ) {
+        goto end;
+    }
+
+    memcpy(header.magic, magic, sizeof(magic));
+    header.numSlots = numSlots;
+    if ( pwrite(fd, &header, sizeof(header), 0) != sizeof(header) ) {
+        goto end;
+    }
+
+    /* Unlike rename(), fails rather than replace a database created concurrently */
+    if ( link(tmpPath.c_str(), path.c_str()) != 0 && errno != EEXIST ) {
+        goto end;
+    }
+
+    ret = true;
+
+end:
+    if ( fd != -1 ) {
+        close(fd);
+        unlink(tmpPath.c_str());
+    }
+
+    return ret;
+}
+
+ResultDB* ResultDB::Open(const std::string& path, const bool writable, const uint64_t numSlots) {
+    ResultDB* ret = nullptr;
+    int fd = -1;
+    struct stat st;
+
+    if ( writable == true && numSlots != 0 && access(path.c_str(), F_OK) != 0 ) {
+        if ( create(path, numSlots) == false ) {
+            goto end;
+        }
+    }
+
+    fd = open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+    if ( fd == -1 ) {
+        goto end;
+    }
+
+    if ( fstat(fd, &st) != 0 ) {
+        goto end;
+    }
+
+    if ( static_cast<size_t>(st.st_size) < sizeof(Header) ) {
+        goto end;
+    }
+
+    ret = new ResultDB(writable);
+    ret->mapSize = st.st_size;
+    ret->map = mmap(nullptr, ret->mapSize, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+    if ( ret->map == MAP_FAILED ) {
+        ret->map = nullptr;
+        delete ret;
+        ret = nullptr;
+        goto end;
+    }
+
+    ret->header = static_cast<Header*>(ret->map);
+    ret->slots = reinterpret_cast<Slot*>(static_cast<uint8_t*>(ret->map) + sizeof(Header));
+
+    if (
+            memcmp(ret->header->magic, magic, sizeof(magic)) != 0 ||
+            ret->header->numSlots == 0 ||
+            /* Checked before multiplying, which could overflow */
+            ret->header->numSlots > (ret->mapSize - sizeof(Header)) / sizeof(Slot) ||
+            sizeof(Header) + ret->header->numSlots * sizeof(Slot) != ret->mapSize ) {
+        delete ret;
+        ret = nullptr;
+        goto end;
+    }
+
+end:
+    if ( fd != -1 ) {
+        close(fd);
+    }
+
+    return ret;
+}
+
+bool ResultDB::Put(const Key& key, const Fingerprint& fingerprint) {
+    if ( writable == false ) {
+        return false;
+    }
+
+    const uint64_t tag = tagOf(key);
+    const uint64_t numSlots = header->numSlots;
+
+    for (uint64_t i = 0; i < numSlots; i++) {
+        Slot& slot = slots[(tag + i) % numSlots];
+
+        uint64_t expected = 0;
+        if ( __atomic_compare_exchange_n(&slot.tag, &expected, tag, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) == true ) {
+            memcpy(slot.key, key.data() + 8, sizeof(slot.key));
+            memcpy(slot.fingerprint, fingerprint.data(), sizeof(slot.fingerprint));
+            return true;
+        }
+
+        if ( expected == tag && memcmp(slot.key, key.data() + 8, sizeof(slot.key)) == 0 ) {
+            /* Keep the first recorded result */
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::optional<ResultDB::Fingerprint> ResultDB::Get(const Key& key) const {
+    const uint64_t tag = tagOf(key);
+    const uint64_t numSlots = header->numSlots;
+
+    for (uint64_t i = 0; i < numSlots; i++) {
+        const Slot& slot = slots[(tag + i) % numSlots];
+
+        const uint64_t slotTag = __atomic_load_n(&slot.tag, __ATOMIC_ACQUIRE);
+        if ( slotTag == 0 ) {
+            break;
+        }
+
+        if ( slotTag == tag && memcmp(slot.key, key.data() + 8, sizeof(slot.key)) == 0 ) {
+            Fingerprint ret;
+            memcpy(ret.data(), slot.fingerprint, ret.size());
+            return ret;
+        }
+    }
+
+    return std::nullopt;
+}
+
+} /* namespace cryptofuzz */
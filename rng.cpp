@@ -0,0 +1,86 @@
+#include <cryptofuzz/rng.h>
+#include <cryptofuzz/crypto.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace cryptofuzz {
+namespace rng {
+
+namespace {
+    struct State {
+        bool active = false;
+        std::vector<uint8_t> seed;
+        uint64_t counter = 0;
+        std::vector<uint8_t> block;
+        size_t blockPos = 0;
+        uint64_t consumed = 0;
+    };
+
+    State state;
+
+    /* SHA-256(seed || counter) */
+    void nextBlock(void) {
+        std::vector<uint8_t> input(state.seed);
+
+        for (size_t i = 0; i < 8; i++) {
+            input.push_back(static_cast<uint8_t>(state.counter >> (i * 8)));
+        }
+
+        state.block = crypto::sha256(input);
+        state.blockPos = 0;
+        state.counter++;
+    }
+}
+
+Scope::Scope(const std::vector<uint8_t>& seed) {
+    if ( state.active == true ) {
+        /* Scopes cannot be nested */
+        abort();
+    }
+
+    state.active = true;
+    state.seed = seed;
+    state.counter = 0;
+    state.block.clear();
+    state.blockPos = 0;
+    state.consumed = 0;
+}
+
+Scope::~Scope() {
+    state.active = false;
+}
+
+uint64_t Scope::Consumed(void) const {
+    return state.consumed;
+}
+
+bool Active(void) {
+    return state.active;
+}
+
+bool Generate(uint8_t* out, const size_t size) {
+    if ( state.active == false ) {
+        return false;
+    }
+
+    size_t i = 0;
+    while ( i < size ) {
+        if ( state.blockPos == state.block.size() ) {
+            nextBlock();
+        }
+
+        const size_t n = std::min(size - i, state.block.size() - state.blockPos);
+        memcpy(out + i, state.block.data() + state.blockPos, n);
+
+        state.blockPos += n;
+        i += n;
+    }
+
+    state.consumed += size;
+
+    return true;
+}
+
+} /* namespace rng */
+} /* namespace cryptofuzz */
@@ -3,7 +3,9 @@
 #include <cryptofuzz/repository.h>
 #include <cryptofuzz/util.h>
 #include <boost/multiprecision/cpp_int.hpp>
+#include <array>
 #include <iostream>
+#include <random>
 
 namespace cryptofuzz {
 namespace tests {
@@ -324,6 +326,38 @@ void test(const operation::ECIES_Encrypt& op, const std::optional<component::Cip
     (void)result;
 }
 
+void test(const operation::ECC_Point_Add& op, const std::optional<component::ECC_Point>& result) {
+    (void)op;
+    (void)result;
+}
+
+void test(const operation::ECC_Point_Mul& op, const std::optional<component::ECC_Point>& result) {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    /* 0 * P is the point at infinity, which has no affine coordinates */
+    if ( op.b.ToTrimmedString() == "0" ) {
+        util::abort({op.Name(), "multiplication by zero yields affine point"});
+    }
+}
+
+void test(const operation::ECC_Point_Dbl& op, const std::optional<component::ECC_Point>& result) {
+    (void)op;
+    (void)result;
+}
+
+void test(const operation::ECC_MultiScalarMul& op, const std::optional<component::ECC_Point>& result) {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    /* The empty sum is the point at infinity */
+    if ( op.points.empty() ) {
+        util::abort({op.Name(), "empty sum yields affine point"});
+    }
+}
+
 void test(const operation::DH_GenerateKeyPair& op, const std::optional<component::DH_KeyPair>& result) {
     (void)op;
     (void)result;
@@ -378,6 +412,336 @@ namespace BignumCalc {
             Abort("Result is larger than the input", opStr);
         }
     }
+
+    /* Exact comparison of non-negative numbers */
+    static bool LessThan(const component::Bignum& A, const component::Bignum& B) {
+        const auto& a = A.ToTrimmedString();
+        const auto& b = B.ToTrimmedString();
+
+        if ( a.size() != b.size() ) {
+            return a.size() < b.size();
+        }
+
+        return a < b;
+    }
+
+    static boost::multiprecision::cpp_int ToCppInt(const component::Bignum& A) {
+        /* Trimmed, so a leading zero is not interpreted as octal */
+        return boost::multiprecision::cpp_int(A.ToTrimmedString());
+    }
+
+    /* A number reduced modulo a few random 61-bit primes.
+     *
+     * Ring identities (Add, Sub, Mul, ...) that hold over the integers also
+     * hold modulo every prime, so comparing residues verifies a result in
+     * linear time without recomputing it. The primes are chosen at startup
+     * so that a wrong result cannot systematically collide.
+     */
+    class Residue {
+        private:
+            static constexpr size_t NumPrimes = 3;
+            std::array<uint64_t, NumPrimes> v;
+
+            static uint64_t mulmod(const uint64_t a, const uint64_t b, const uint64_t p) {
+                return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) % p);
+            }
+
+            static uint64_t powmod(uint64_t b, uint64_t e, const uint64_t p) {
+                uint64_t r = 1;
+                while ( e ) {
+                    if ( e & 1 ) {
+                        r = mulmod(r, b, p);
+                    }
+                    b = mulmod(b, b, p);
+                    e >>= 1;
+                }
+                return r;
+            }
+
+            /* Miller-Rabin; these bases are deterministic for 64-bit numbers */
+            static bool isPrime(const uint64_t n) {
+                static const uint64_t bases[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+
+                uint64_t d = n - 1;
+                size_t s = 0;
+                while ( (d & 1) == 0 ) {
+                    d >>= 1;
+                    s++;
+                }
+
+                for (const auto a : bases) {
+                    uint64_t x = powmod(a, d, n);
+                    if ( x == 1 || x == n - 1 ) {
+                        continue;
+                    }
+
+                    bool composite = true;
+                    for (size_t i = 1; i < s; i++) {
+                        x = mulmod(x, x, n);
+                        if ( x == n - 1 ) {
+                            composite = false;
+                            break;
+                        }
+                    }
+
+                    if ( composite ) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            static const std::array<uint64_t, NumPrimes>& primes(void) {
+                static const std::array<uint64_t, NumPrimes> ret = [] {
+                    std::array<uint64_t, NumPrimes> ret;
+                    std::mt19937_64 rng(std::random_device{}());
+
+                    for (size_t i = 0; i < NumPrimes; i++) {
+                        uint64_t p;
+                        do {
+                            p = (rng() >> 3) | (1ULL << 60) | 1;
+                        } while ( !isPrime(p) );
+                        ret[i] = p;
+                    }
+
+                    return ret;
+                }();
+
+                return ret;
+            }
+
+            Residue(void) = default;
+        public:
+            /* A must be a decimal string (see AllDecimal()) */
+            Residue(const component::Bignum& A) :
+                Residue(*A.ToBin()) {
+                const auto& p = primes();
+
+                for (size_t i = 0; i < NumPrimes; i++) {
+                    if ( A.IsNegative() && v[i] != 0 ) {
+                        v[i] = p[i] - v[i];
+                    }
+                }
+            }
+
+            /* Unsigned big-endian */
+            Residue(const std::vector<uint8_t>& bin) {
+                const auto& p = primes();
+
+                for (size_t i = 0; i < NumPrimes; i++) {
+                    /* Horner's method over 32-bit words */
+                    unsigned __int128 r = 0;
+                    size_t pos = 0;
+                    const size_t head = bin.size() % 4;
+
+                    for (size_t j = 0; j < head; j++) {
+                        r = (r << 8) | bin[pos++];
+                    }
+                    while ( pos < bin.size() ) {
+                        uint32_t w = 0;
+                        for (size_t j = 0; j < 4; j++) {
+                            w = (w << 8) | bin[pos++];
+                        }
+                        r = ((r << 32) | w) % p[i];
+                    }
+
+                    v[i] = static_cast<uint64_t>(r % p[i]);
+                }
+            }
+
+            Residue operator+(const Residue& other) const {
+                const auto& p = primes();
+                Residue ret;
+                for (size_t i = 0; i < NumPrimes; i++) {
+                    ret.v[i] = (v[i] + other.v[i]) % p[i];
+                }
+                return ret;
+            }
+
+            Residue operator-(const Residue& other) const {
+                const auto& p = primes();
+                Residue ret;
+                for (size_t i = 0; i < NumPrimes; i++) {
+                    ret.v[i] = (v[i] + p[i] - other.v[i]) % p[i];
+                }
+                return ret;
+            }
+
+            Residue operator*(const Residue& other) const {
+                const auto& p = primes();
+                Residue ret;
+                for (size_t i = 0; i < NumPrimes; i++) {
+                    ret.v[i] = mulmod(v[i], other.v[i], p[i]);
+                }
+                return ret;
+            }
+
+            bool operator==(const Residue& other) const {
+                return v == other.v;
+            }
+
+            bool operator!=(const Residue& other) const {
+                return !(*this == other);
+            }
+    };
+
+    static void AssertResidue(const Residue& result, const Residue& expected, const std::string& opStr) {
+        if ( result != expected ) {
+            Abort("Residue check failed", opStr);
+        }
+    }
+
+    /* The residue checks assume integer semantics, which are only
+     * unambiguous across libraries for non-negative operands.
+     */
+    static bool AllNonNegative(const operation::BignumCalc& op) {
+        return !op.bn0.IsNegative() && !op.bn1.IsNegative() && !op.bn2.IsNegative();
+    }
+
+    static bool AllDecimal(const operation::BignumCalc& op, const component::Bignum& result) {
+        return
+            op.bn0.ToBin() != std::nullopt &&
+            op.bn1.ToBin() != std::nullopt &&
+            op.bn2.ToBin() != std::nullopt &&
+            result.ToBin() != std::nullopt;
+    }
+
+    static void TestResidues(const operation::BignumCalc& op, const component::Bignum& result) {
+        if ( !AllNonNegative(op) || !AllDecimal(op, result) ) {
+            return;
+        }
+
+        const auto calcOp = op.calcOp.Get();
+        const auto opStr = repository::CalcOpToString(calcOp);
+
+        switch ( calcOp ) {
+            case    CF_CALCOP("Add(A,B)"):
+                AssertResidue(result, Residue(op.bn0) + Residue(op.bn1), opStr);
+                break;
+            case    CF_CALCOP("Sub(A,B)"):
+                AssertResidue(result, Residue(op.bn0) - Residue(op.bn1), opStr);
+                break;
+            case    CF_CALCOP("Mul(A,B)"):
+                AssertResidue(result, Residue(op.bn0) * Residue(op.bn1), opStr);
+                break;
+            case    CF_CALCOP("Sqr(A)"):
+                AssertResidue(result, Residue(op.bn0) * Residue(op.bn0), opStr);
+                break;
+            case    CF_CALCOP("MulAdd(A,B,C)"):
+                AssertResidue(result, Residue(op.bn0) * Residue(op.bn1) + Residue(op.bn2), opStr);
+                break;
+            case    CF_CALCOP("LShift1(A)"):
+                AssertResidue(result, Residue(op.bn0) + Residue(op.bn0), opStr);
+                break;
+            case    CF_CALCOP("Neg(A)"):
+                AssertResidue(result, Residue(component::Bignum(std::string("0"))) - Residue(op.bn0), opStr);
+                break;
+            case    CF_CALCOP("Set(A)"):
+                if ( !IsEqual(result, op.bn0) ) {
+                    Abort("Result is not equal to the input", opStr);
+                }
+                break;
+            case    CF_CALCOP("AddMod(A,B,C)"):
+                /* If A, B < C, then A + B - R is either 0 or C */
+                if ( !IsZero(op.bn2) && LessThan(op.bn0, op.bn2) && LessThan(op.bn1, op.bn2) ) {
+                    const Residue sum = Residue(op.bn0) + Residue(op.bn1);
+                    const Residue r(result);
+                    if ( r != sum && r != sum - Residue(op.bn2) ) {
+                        Abort("Residue check failed", opStr);
+                    }
+                }
+                break;
+            case    CF_CALCOP("SubMod(A,B,C)"):
+                /* If A, B < C, then A - B - R is either 0 or -C */
+                if ( !IsZero(op.bn2) && LessThan(op.bn0, op.bn2) && LessThan(op.bn1, op.bn2) ) {
+                    const Residue diff = Residue(op.bn0) - Residue(op.bn1);
+                    const Residue r(result);
+                    if ( r != diff && r != diff + Residue(op.bn2) ) {
+                        Abort("Residue check failed", opStr);
+                    }
+                }
+                break;
+            case    CF_CALCOP("Div(A,B)"):
+                /* Q * B + R == A with 0 <= R < B */
+                if ( !IsZero(op.bn1) && !result.IsNegative() ) {
+                    const auto a = ToCppInt(op.bn0);
+                    const auto b = ToCppInt(op.bn1);
+                    const auto r = a - ToCppInt(result) * b;
+                    if ( r < 0 || r >= b ) {
+                        Abort("Quotient is incorrect", opStr);
+                    }
+                }
+                break;
+            case    CF_CALCOP("Mod(A,B)"):
+                if ( !IsZero(op.bn1) ) {
+                    if ( result.IsNegative() || !LessThan(result, op.bn1) ) {
+                        Abort("Result is not in the range [0, B)", opStr);
+                    }
+                }
+                break;
+            case    CF_CALCOP("ExpMod(A,B,C)"):
+                /* Spot checks for trivial exponents, bases and moduli */
+                if ( IsZero(op.bn2) ) {
+                    break;
+                }
+
+                if ( op.bn2.ToTrimmedString() == "1" ) {
+                    if ( !IsZero(result) ) {
+                        Abort("Result modulo 1 must be 0", opStr);
+                    }
+                } else if ( IsZero(op.bn1) ) {
+                    if ( result.ToTrimmedString() != "1" ) {
+                        Abort("A^0 must be 1", opStr);
+                    }
+                } else if ( op.bn1.ToTrimmedString() == "1" && LessThan(op.bn0, op.bn2) ) {
+                    if ( !IsEqual(result, op.bn0) ) {
+                        Abort("A^1 must be A", opStr);
+                    }
+                } else if ( IsZero(op.bn0) || op.bn0.ToTrimmedString() == "1" ) {
+                    if ( !IsEqual(result, op.bn0) ) {
+                        Abort("0^B must be 0 and 1^B must be 1", opStr);
+                    }
+                }
+                break;
+            case    CF_CALCOP("InvMod(A,B)"):
+                /* A result of 0 signals that no inverse exists */
+                if ( IsZero(result) || IsZero(op.bn1) || op.bn1.ToTrimmedString() == "1" ) {
+                    break;
+                }
+
+                if ( result.IsNegative() || !LessThan(result, op.bn1) ) {
+                    Abort("Result is not in the range [0, B)", opStr);
+                }
+
+                {
+                    const auto b = ToCppInt(op.bn1);
+                    if ( (ToCppInt(op.bn0) * ToCppInt(result)) % b != 1 ) {
+                        Abort("A * R is not 1 modulo B", opStr);
+                    }
+                }
+                break;
+            case    CF_CALCOP("GCD(A,B)"):
+                if ( IsZero(result) ) {
+                    if ( !IsZero(op.bn0) || !IsZero(op.bn1) ) {
+                        Abort("GCD is zero for non-zero inputs", opStr);
+                    }
+                    break;
+                }
+
+                if ( result.IsNegative() ) {
+                    Abort("GCD is negative", opStr);
+                }
+
+                {
+                    const auto g = ToCppInt(result);
+                    if ( ToCppInt(op.bn0) % g != 0 || ToCppInt(op.bn1) % g != 0 ) {
+                        Abort("GCD does not divide both inputs", opStr);
+                    }
+                }
+                break;
+        }
+    }
 }
 
 void test(const operation::BignumCalc& op, const std::optional<component::Bignum>& result) {
@@ -389,6 +753,8 @@ void test(const operation::BignumCalc& op, const std::optional<component::Bignum
 
     const auto calcOp = op.calcOp.Get();
 
+    TestResidues(op, *result);
+
     switch ( calcOp ) {
         case    CF_CALCOP("Add(A,B)"):
             if (    SmallerThan(*result, op.bn0) ||
@@ -519,5 +885,139 @@ void test(const operation::BignumCalc& op, const std::optional<component::Bignum
     }
 }
 
+namespace BignumCalcLarge {
+    /* Exact comparison of unsigned big-endian numbers without leading zeroes */
+    static bool LessThan(const component::LargeBignum& A, const component::LargeBignum& B) {
+        if ( A.GetSize() != B.GetSize() ) {
+            return A.GetSize() < B.GetSize();
+        }
+
+        return A.Get() < B.Get();
+    }
+}
+
+void test(const operation::BignumCalcLarge& op, const std::optional<component::LargeBignum>& result) {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    using namespace BignumCalc;
+
+    const auto calcOp = op.calcOp.Get();
+    const auto opStr = repository::CalcOpToString(calcOp);
+
+    /* Required for results to be comparable across modules */
+    if ( result->GetSize() && result->GetPtr()[0] == 0x00 ) {
+        Abort("Result has leading zero bytes", opStr);
+    }
+
+    switch ( calcOp ) {
+        case    CF_CALCOP("Mul(A,B)"):
+            AssertResidue(Residue(result->Get()), Residue(op.bn0.Get()) * Residue(op.bn1.Get()), opStr);
+            break;
+        case    CF_CALCOP("Sqr(A)"):
+            AssertResidue(Residue(result->Get()), Residue(op.bn0.Get()) * Residue(op.bn0.Get()), opStr);
+            break;
+        case    CF_CALCOP("Div(A,B)"):
+            if ( result->GetSize() > op.bn0.GetSize() ) {
+                Abort("Result is larger than the input", opStr);
+            }
+            break;
+        case    CF_CALCOP("Mod(A,B)"):
+            if ( !BignumCalcLarge::LessThan(*result, op.bn1) ) {
+                Abort("Result is larger than modulo", opStr);
+            }
+            break;
+        case    CF_CALCOP("MulMod(A,B,C)"):
+            if ( !BignumCalcLarge::LessThan(*result, op.bn2) ) {
+                Abort("Result is larger than modulo", opStr);
+            }
+            break;
+    }
+}
+
+void test(const operation::BignumCalcSequence& op, const std::optional<component::BignumTrace>& result) {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    if ( result->size() != op.program.size() ) {
+        printf("Expected vs actual trace size: %zu / %zu\n", op.program.size(), result->size());
+        abort();
+    }
+
+    /* Replay the program so that every step is subject to the BignumCalc tests */
+    std::vector<component::Bignum> registers = op.registers;
+
+    for (size_t i = 0; i < op.program.size(); i++) {
+        const auto& instr = op.program[i];
+
+        const operation::BignumCalc bignumCalc(
+                op.modifier,
+                instr.calcOp,
+                registers[instr.src[0]],
+                registers[instr.src[1]],
+                registers[instr.src[2]],
+                registers[instr.src[3]]);
+
+        test(bignumCalc, (*result)[i]);
+
+        registers[instr.dst] = (*result)[i];
+    }
+}
+
+void test(const operation::DigestStream& op, const std::optional<component::Digest>& result) {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    const auto expectedSize = repository::DigestSize(op.digestType.Get());
+
+    if ( expectedSize == std::nullopt ) {
+        return;
+    }
+
+    if ( result->GetSize() != *expectedSize ) {
+        printf("Expected vs actual digest size: %zu / %zu\n", *expectedSize, result->GetSize());
+        abort();
+    }
+}
+
+void test(const operation::HMACStream& op, const std::optional<component::MAC>& result) {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    const auto expectedSize = repository::DigestSize(op.digestType.Get());
+
+    if ( expectedSize == std::nullopt ) {
+        return;
+    }
+
+    if ( result->GetSize() != *expectedSize ) {
+        printf("Expected vs actual digest size: %zu / %zu\n", *expectedSize, result->GetSize());
+        abort();
+    }
+}
+
+void test(const operation::SymmetricEncryptStream& op, const std::optional<component::Ciphertext>& result) {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    /* The ciphertext is represented by its SHA-256 hash */
+    if ( result->ciphertext.GetSize() != 32 ) {
+        printf("Expected vs actual ciphertext hash size: 32 / %zu\n", result->ciphertext.GetSize());
+        abort();
+    }
+
+    if ( op.tagSize != std::nullopt && result->tag != std::nullopt ) {
+        if ( result->tag->GetSize() != *op.tagSize ) {
+            printf("Expected vs actual tag size: %zu / %zu\n", static_cast<size_t>(*op.tagSize), result->tag->GetSize());
+            abort();
+        }
+    }
+}
+
 } /* namespace tests */
 } /* namespace cryptofuzz */
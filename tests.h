@@ -31,9 +31,18 @@ void test(const operation::ECDSA_Sign& op, const std::optional<component::ECDSA_
 void test(const operation::ECDSA_Verify& op, const std::optional<bool>& result);
 void test(const operation::ECDH_Derive& op, const std::optional<component::Secret>& result);
 void test(const operation::ECIES_Encrypt& op, const std::optional<component::Ciphertext>& result);
+void test(const operation::ECC_Point_Add& op, const std::optional<component::ECC_Point>& result);
+void test(const operation::ECC_Point_Mul& op, const std::optional<component::ECC_Point>& result);
+void test(const operation::ECC_Point_Dbl& op, const std::optional<component::ECC_Point>& result);
+void test(const operation::ECC_MultiScalarMul& op, const std::optional<component::ECC_Point>& result);
 void test(const operation::DH_GenerateKeyPair& op, const std::optional<component::DH_KeyPair>& result);
 void test(const operation::DH_Derive& op, const std::optional<component::Bignum>& result);
 void test(const operation::BignumCalc& op, const std::optional<component::Bignum>& result);
+void test(const operation::BignumCalcLarge& op, const std::optional<component::LargeBignum>& result);
+void test(const operation::BignumCalcSequence& op, const std::optional<component::BignumTrace>& result);
+void test(const operation::DigestStream& op, const std::optional<component::Digest>& result);
+void test(const operation::HMACStream& op, const std::optional<component::MAC>& result);
+void test(const operation::SymmetricEncryptStream& op, const std::optional<component::Ciphertext>& result);
 
 } /* namespace tests */
 } /* namespace cryptofuzz */
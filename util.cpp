@@ -3,13 +3,13 @@
 #include <cryptofuzz/repository.h>
 #include <cryptofuzz/crypto.h>
 #include <fuzzing/datasource/id.hpp>
+#include <algorithm>
 #include <iomanip>
 #include <map>
 #include <sstream>
 #include <vector>
 #include <cstdlib>
 #include <boost/algorithm/string/join.hpp>
-#include <boost/multiprecision/cpp_int.hpp>
 #include <boost/algorithm/hex.hpp>
 #include "third_party/cpu_features/include/cpuinfo_x86.h"
 
@@ -105,6 +105,44 @@ Multipart ToParts(fuzzing::datasource::Datasource& ds, const uint8_t* data, cons
     return ret;
 }
 
+VirtualParts::VirtualParts(fuzzing::datasource::Datasource& ds, const component::VirtualCleartext& cleartext) :
+    ds(ds),
+    cleartext(cleartext)
+{ }
+
+std::optional< std::pair<const uint8_t*, size_t> > VirtualParts::Next(void) {
+    const uint64_t left = cleartext.GetSize() - offset;
+
+    if ( left == 0 ) {
+        return std::nullopt;
+    }
+
+    /* Determine part length */
+    size_t len = MaxPartSize;
+    try {
+        len = ds.Get<uint32_t>() % (MaxPartSize + 1);
+    } catch ( const fuzzing::datasource::Datasource::OutOfData& ) {
+    }
+
+    if ( len > left ) {
+        len = left;
+    }
+
+    if ( len == 0 ) {
+        /* Intentionally invalid pointer to detect dereference
+         * of buffer of size 0 */
+        return std::make_pair(GetNullPtr(), 0);
+    }
+
+    part.resize(len);
+    cleartext.Generate(offset, part.data(), len);
+
+    /* Advance */
+    offset += len;
+
+    return std::make_pair(part.data(), len);
+}
+
 Multipart ToEqualParts(const Buffer& buffer, const size_t partSize) {
     return ToEqualParts(buffer.GetPtr(), buffer.GetSize(), partSize);
 }
@@ -275,6 +313,16 @@ std::string ToString(const component::Bignum& val) {
     return val.ToString();
 }
 
+std::string ToString(const component::BignumTrace& val) {
+    std::string ret;
+
+    for (size_t i = 0; i < val.size(); i++) {
+        ret += std::to_string(i) + ": " + val[i].ToString() + "\n";
+    }
+
+    return ret;
+}
+
 nlohmann::json ToJSON(const Buffer& buffer) {
     return buffer.ToJSON();
 }
@@ -311,6 +359,16 @@ nlohmann::json ToJSON(const component::Bignum& val) {
     return val.ToJSON();
 }
 
+nlohmann::json ToJSON(const component::BignumTrace& val) {
+    nlohmann::json ret = nlohmann::json::array();
+
+    for (const auto& v : val) {
+        ret.push_back(v.ToJSON());
+    }
+
+    return ret;
+}
+
 class HaveBadPointer {
     private:
         bool haveBadPointer = false;
@@ -378,6 +436,376 @@ void abort(const std::vector<std::string> components) {
     ::abort();
 }
 
+namespace radix {
+
+/* Arbitrary precision numbers in this namespace are little-endian vectors
+ * of limbs, each limb holding a single digit in base Base (either 2^32 or 10^9).
+ *
+ * Conversion between the two bases is done by divide and conquer:
+ * value = high * X^k + low, where X is the source base, and the
+ * multiplication is performed in the destination base using Karatsuba.
+ * This is O(M(n) log n) rather than the O(n^2) of digit-by-digit conversion.
+ */
+
+using Limbs = std::vector<uint32_t>;
+
+constexpr uint64_t BaseBin = 1ULL << 32;
+constexpr uint64_t BaseDec = 1000000000ULL;
+
+/* Below this amount of limbs, schoolbook methods are faster */
+constexpr size_t KaratsubaThreshold = 64;
+constexpr size_t ConvertThreshold = 32;
+
+static void normalize(Limbs& v) {
+    while ( !v.empty() && v.back() == 0 ) {
+        v.pop_back();
+    }
+}
+
+/* out[0..an+bn) = a * b; out must be zeroed */
+template <uint64_t Base>
+static void mulSchoolbook(const uint32_t* a, const size_t an, const uint32_t* b, const size_t bn, uint32_t* out) {
+    for (size_t i = 0; i < an; i++) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < bn; j++) {
+            const uint64_t t = out[i + j] + static_cast<uint64_t>(a[i]) * b[j] + carry;
+            out[i + j] = static_cast<uint32_t>(t % Base);
+            carry = t / Base;
+        }
+        out[i + bn] = static_cast<uint32_t>(carry);
+    }
+}
+
+/* out[offset..] += v; out must be large enough to absorb the carry */
+template <uint64_t Base>
+static void addAt(uint32_t* out, const size_t outSize, const uint32_t* v, const size_t vn, const size_t offset) {
+    uint64_t carry = 0;
+    size_t i = 0;
+
+    for (; i < vn; i++) {
+        const uint64_t t = static_cast<uint64_t>(out[offset + i]) + v[i] + carry;
+        out[offset + i] = static_cast<uint32_t>(t % Base);
+        carry = t / Base;
+    }
+
+    for (; carry && offset + i < outSize; i++) {
+        const uint64_t t = static_cast<uint64_t>(out[offset + i]) + carry;
+        out[offset + i] = static_cast<uint32_t>(t % Base);
+        carry = t / Base;
+    }
+}
+
+/* a -= b, requires a >= b */
+template <uint64_t Base>
+static void subInPlace(Limbs& a, const Limbs& b) {
+    int64_t borrow = 0;
+
+    for (size_t i = 0; i < a.size(); i++) {
+        int64_t t = static_cast<int64_t>(a[i]) - borrow - (i < b.size() ? static_cast<int64_t>(b[i]) : 0);
+        if ( t < 0 ) {
+            t += Base;
+            borrow = 1;
+        } else {
+            borrow = 0;
+        }
+        a[i] = static_cast<uint32_t>(t);
+    }
+}
+
+template <uint64_t Base>
+static Limbs add(const uint32_t* a, const size_t an, const uint32_t* b, const size_t bn) {
+    Limbs ret(std::max(an, bn) + 1, 0);
+
+    if ( an ) {
+        memcpy(ret.data(), a, an * sizeof(uint32_t));
+    }
+    addAt<Base>(ret.data(), ret.size(), b, bn, 0);
+
+    return ret;
+}
+
+template <uint64_t Base>
+static void mulKaratsuba(const uint32_t* a, size_t an, const uint32_t* b, size_t bn, uint32_t* out);
+
+template <uint64_t Base>
+static void mulBalanced(const uint32_t* a, const size_t an, const uint32_t* b, const size_t bn, uint32_t* out) {
+    /* an >= bn >= m */
+    const size_t m = an / 2;
+
+    const uint32_t* a0 = a;
+    const uint32_t* a1 = a + m;
+    const size_t a1n = an - m;
+    const uint32_t* b0 = b;
+    const uint32_t* b1 = b + m;
+    const size_t b1n = bn - m;
+
+    /* z0 = a0 * b0 */
+    Limbs z0(2 * m, 0);
+    mulKaratsuba<Base>(a0, m, b0, m, z0.data());
+
+    /* z2 = a1 * b1 */
+    Limbs z2(a1n + b1n, 0);
+    mulKaratsuba<Base>(a1, a1n, b1, b1n, z2.data());
+
+    /* z1 = (a0 + a1) * (b0 + b1) - z0 - z2 */
+    const auto sa = add<Base>(a0, m, a1, a1n);
+    const auto sb = add<Base>(b0, m, b1, b1n);
+    Limbs z1(sa.size() + sb.size(), 0);
+    mulKaratsuba<Base>(sa.data(), sa.size(), sb.data(), sb.size(), z1.data());
+    subInPlace<Base>(z1, z0);
+    subInPlace<Base>(z1, z2);
+    normalize(z1);
+
+    const size_t outSize = an + bn;
+    memcpy(out, z0.data(), z0.size() * sizeof(uint32_t));
+    memcpy(out + 2 * m, z2.data(), std::min(z2.size(), outSize - 2 * m) * sizeof(uint32_t));
+    addAt<Base>(out, outSize, z1.data(), z1.size(), m);
+}
+
+/* out[0..an+bn) = a * b; out must be zeroed */
+template <uint64_t Base>
+static void mulKaratsuba(const uint32_t* a, size_t an, const uint32_t* b, size_t bn, uint32_t* out) {
+    if ( an < bn ) {
+        std::swap(a, b);
+        std::swap(an, bn);
+    }
+
+    if ( bn < KaratsubaThreshold ) {
+        mulSchoolbook<Base>(a, an, b, bn, out);
+        return;
+    }
+
+    if ( bn > an / 2 ) {
+        mulBalanced<Base>(a, an, b, bn, out);
+        return;
+    }
+
+    /* Unbalanced: multiply b by bn-sized slices of a */
+    Limbs tmp(2 * bn);
+    for (size_t i = 0; i < an; i += bn) {
+        const size_t n = std::min(bn, an - i);
+        std::fill(tmp.begin(), tmp.end(), 0);
+        mulKaratsuba<Base>(a + i, n, b, bn, tmp.data());
+        addAt<Base>(out, an + bn, tmp.data(), n + bn, i);
+    }
+}
+
+template <uint64_t Base>
+static Limbs mul(const Limbs& a, const Limbs& b) {
+    if ( a.empty() || b.empty() ) {
+        return {};
+    }
+
+    Limbs ret(a.size() + b.size(), 0);
+    mulKaratsuba<Base>(a.data(), a.size(), b.data(), b.size(), ret.data());
+    normalize(ret);
+
+    return ret;
+}
+
+/* Convert little-endian digits in base From to limbs in base To */
+template <uint64_t From, uint64_t To>
+class Converter {
+    private:
+        /* powers[i] = From^(2^i), in base To */
+        std::vector<Limbs> powers;
+
+        const Limbs& power(const size_t i) {
+            while ( powers.size() <= i ) {
+                if ( powers.empty() ) {
+                    Limbs p;
+                    uint64_t v = From;
+                    while ( v ) {
+                        p.push_back(static_cast<uint32_t>(v % To));
+                        v /= To;
+                    }
+                    powers.push_back(p);
+                } else {
+                    powers.push_back(mul<To>(powers.back(), powers.back()));
+                }
+            }
+
+            return powers[i];
+        }
+
+        Limbs convertSchoolbook(const uint32_t* in, const size_t n) const {
+            Limbs ret;
+            ret.reserve(n + 2);
+
+            for (size_t i = n; i-- > 0; ) {
+                /* ret = ret * From + in[i] */
+                uint64_t carry = in[i];
+                for (size_t j = 0; j < ret.size(); j++) {
+                    const uint64_t t = static_cast<uint64_t>(ret[j]) * From + carry;
+                    ret[j] = static_cast<uint32_t>(t % To);
+                    carry = t / To;
+                }
+                while ( carry ) {
+                    ret.push_back(static_cast<uint32_t>(carry % To));
+                    carry /= To;
+                }
+            }
+
+            return ret;
+        }
+
+        Limbs convert(const uint32_t* in, const size_t n) {
+            if ( n <= ConvertThreshold ) {
+                return convertSchoolbook(in, n);
+            }
+
+            /* Split at the largest power of 2 below n */
+            size_t i = 0;
+            while ( (static_cast<size_t>(2) << i) < n ) {
+                i++;
+            }
+            const size_t k = static_cast<size_t>(1) << i;
+
+            const auto low = convert(in, k);
+            const auto high = convert(in + k, n - k);
+
+            auto ret = mul<To>(high, power(i));
+            ret.resize(std::max(ret.size(), low.size()) + 1, 0);
+            addAt<To>(ret.data(), ret.size(), low.data(), low.size(), 0);
+            normalize(ret);
+
+            return ret;
+        }
+    public:
+        Limbs Run(Limbs in) {
+            normalize(in);
+            return convert(in.data(), in.size());
+        }
+};
+
+/* Parses 8 ASCII digits */
+static inline uint32_t parse8(const char* p) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    /* SWAR: combine adjacent digits, then pairs, then quads */
+    uint64_t v;
+    memcpy(&v, p, 8);
+    v -= 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);
+    v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+         (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return static_cast<uint32_t>(v);
+#else
+    uint32_t v = 0;
+    for (size_t i = 0; i < 8; i++) {
+        v = v * 10 + (p[i] - '0');
+    }
+    return v;
+#endif
+}
+
+/* Returns nullopt if s contains non-digit characters */
+static std::optional<Limbs> FromDecString(const std::string& s) {
+    Limbs ret((s.size() + 8) / 9);
+
+    for (const char c : s) {
+        if ( c < '0' || c > '9' ) {
+            return std::nullopt;
+        }
+    }
+
+    size_t end = s.size();
+    for (size_t i = 0; i < ret.size(); i++) {
+        const size_t start = end >= 9 ? end - 9 : 0;
+        const char* p = s.data() + start;
+        const size_t n = end - start;
+
+        if ( n == 9 ) {
+            ret[i] = (p[0] - '0') * 100000000 + parse8(p + 1);
+        } else {
+            uint32_t v = 0;
+            for (size_t j = 0; j < n; j++) {
+                v = v * 10 + (p[j] - '0');
+            }
+            ret[i] = v;
+        }
+
+        end = start;
+    }
+
+    return ret;
+}
+
+static std::string ToDecString(Limbs v) {
+    normalize(v);
+
+    if ( v.empty() ) {
+        return "0";
+    }
+
+    std::string ret(v.size() * 9, '0');
+    size_t pos = 0;
+
+    {
+        const auto head = std::to_string(v.back());
+        memcpy(&ret[0], head.data(), head.size());
+        pos = head.size();
+    }
+
+    for (size_t i = v.size() - 1; i-- > 0; ) {
+        uint32_t x = v[i];
+        for (size_t j = 9; j-- > 0; ) {
+            ret[pos + j] = '0' + (x % 10);
+            x /= 10;
+        }
+        pos += 9;
+    }
+
+    ret.resize(pos);
+
+    return ret;
+}
+
+static Limbs FromBytes(const uint8_t* data, const size_t size) {
+    Limbs ret((size + 3) / 4, 0);
+
+    for (size_t i = 0; i < size; i++) {
+        const size_t bytePos = size - 1 - i;
+        ret[i / 4] |= static_cast<uint32_t>(data[bytePos]) << ((i % 4) * 8);
+    }
+
+    return ret;
+}
+
+/* Big-endian, without leading zero bytes */
+static std::vector<uint8_t> ToBytes(Limbs v) {
+    normalize(v);
+
+    std::vector<uint8_t> ret(v.size() * 4);
+    for (size_t i = 0; i < v.size(); i++) {
+        for (size_t j = 0; j < 4; j++) {
+            ret[ret.size() - 1 - (i * 4 + j)] = static_cast<uint8_t>(v[i] >> (j * 8));
+        }
+    }
+
+    size_t numZeroes = 0;
+    while ( numZeroes < ret.size() && ret[numZeroes] == 0 ) {
+        numZeroes++;
+    }
+    ret.erase(ret.begin(), ret.begin() + numZeroes);
+
+    return ret;
+}
+
+static std::optional<Limbs> DecToBinLimbs(const std::string& s) {
+    const auto dec = FromDecString(s);
+    if ( dec == std::nullopt ) {
+        return std::nullopt;
+    }
+
+    return Converter<BaseDec, BaseBin>().Run(*dec);
+}
+
+static std::string BinLimbsToDec(const Limbs& bin) {
+    return ToDecString(Converter<BaseBin, BaseDec>().Run(bin));
+}
+
+} /* namespace radix */
+
 static int HexCharToDec(const char c) {
     if ( c >= '0' && c <= '9' ) {
         return c - '0';
@@ -407,45 +835,53 @@ std::string HexToDec(std::string s) {
         negative = true;
     }
 
-    boost::multiprecision::cpp_int total;
-
-    for (long i = s.size() - 1; i >= 0; i--) {
-        total += boost::multiprecision::cpp_int(HexCharToDec(s[i])) << ((s.size()-i-1)*4);
+    /* Pack nibbles into 32 bit limbs */
+    radix::Limbs bin((s.size() + 7) / 8, 0);
+    for (size_t i = 0; i < s.size(); i++) {
+        const size_t nibblePos = s.size() - 1 - i;
+        bin[i / 8] |= static_cast<uint32_t>(HexCharToDec(s[nibblePos])) << ((i % 8) * 4);
     }
 
-    std::stringstream ss;
-    if ( negative ) ss << "-";
-    ss << total;
+    ret = radix::BinLimbsToDec(bin);
 
-    if ( ss.str().empty() ) {
-        return "0";
-    } else {
-        return ss.str();
+    if ( negative ) {
+        ret = "-" + ret;
     }
+
+    return ret;
 }
 
 std::string DecToHex(std::string s, const std::optional<size_t> padTo) {
-    s.erase(0, s.find_first_not_of('0'));
-    boost::multiprecision::cpp_int i(s);
-    bool negative;
-    if ( i < 0 ) {
+    bool negative = false;
+
+    if ( s.size() >= 1 && s[0] == '-' ) {
+        s = s.substr(1);
         negative = true;
-        i -= (i*2);
-    } else {
-        negative = false;
     }
-    std::stringstream ss;
-    if ( negative == true ) {
-        ss << "-";
+
+    const auto bin = radix::DecToBinLimbs(s);
+    if ( bin == std::nullopt ) {
+        /* Invalid input */
+        throw std::runtime_error("Invalid decimal string: " + s);
+    }
+
+    auto ret = BinToHex(radix::ToBytes(*bin));
+    if ( ret.empty() ) {
+        /* Zero has no sign */
+        ret = "00";
+        negative = false;
     }
-    ss << std::hex << i;
-    auto ret = ss.str();
-    if ( ret.size() % 2 != 0 ) {
-        ret = "0" + ret;
+    if ( negative == true && ret[0] == '0' ) {
+        /* Negative numbers are not padded to an even number of digits */
+        ret.erase(0, 1);
     }
     if ( padTo != std::nullopt && ret.size() < *padTo ) {
         ret = std::string(*padTo - ret.size(), '0') + ret;
     }
+    if ( negative == true ) {
+        ret = "-" + ret;
+    }
+
     return ret;
 }
 
@@ -458,9 +894,17 @@ std::vector<uint8_t> HexToBin(const std::string s) {
 }
 
 std::optional<std::vector<uint8_t>> DecToBin(const std::string s, std::optional<size_t> size) {
-    std::vector<uint8_t> v;
-    boost::multiprecision::cpp_int c(s);
-    boost::multiprecision::export_bits(c, std::back_inserter(v), 8);
+    const auto bin = radix::DecToBinLimbs(s.size() >= 1 && s[0] == '-' ? s.substr(1) : s);
+    if ( bin == std::nullopt ) {
+        /* Invalid input */
+        throw std::runtime_error("Invalid decimal string: " + s);
+    }
+
+    auto v = radix::ToBytes(*bin);
+    if ( v.empty() ) {
+        v = {0};
+    }
+
     if ( size == std::nullopt ) {
         return v;
     }
@@ -491,25 +935,15 @@ std::string BinToHex(const std::vector<uint8_t> data) {
 }
 
 std::string BinToDec(const uint8_t* data, const size_t size) {
-    return BinToDec(std::vector<uint8_t>(data, data + size));
-}
-
-std::string BinToDec(const std::vector<uint8_t> data) {
-    if ( data.empty() ) {
+    if ( size == 0 ) {
         return "0";
     }
 
-    boost::multiprecision::cpp_int i;
-    boost::multiprecision::import_bits(i, data.data(), data.data() + data.size());
-
-    std::stringstream ss;
-    ss << i;
+    return radix::BinLimbsToDec(radix::FromBytes(data, size));
+}
 
-    if ( ss.str().empty() ) {
-        return "0";
-    } else {
-        return ss.str();
-    }
+std::string BinToDec(const std::vector<uint8_t> data) {
+    return BinToDec(data.data(), data.size());
 }
 
 std::optional<std::vector<uint8_t>> ToDER(const std::string A, const std::string B) {
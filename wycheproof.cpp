@@ -3,26 +3,257 @@
 #include <cryptofuzz/operations.h>
 #include <cryptofuzz/util.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <thread>
 
 namespace cryptofuzz {
 
+namespace {
+
+std::optional<uint64_t> toCurve(const std::string& curve) {
+    if ( curve.rfind("brainpoolP", 0) == 0 ) {
+        /* brainpoolP256r1 -> brainpool256r1 */
+        return repository::ECC_CurveFromString("brainpool" + curve.substr(10));
+    }
+
+    return repository::ECC_CurveFromString(curve);
+}
+
+std::optional<uint64_t> toDigest(const std::string& digest) {
+    /* SHA-256 -> SHA256, SHA-512/224 -> SHA512-224 */
+    std::string name = digest.rfind("SHA-", 0) == 0 ? "SHA" + digest.substr(4) : digest;
+    std::replace(name.begin(), name.end(), '/', '-');
+
+    return repository::DigestFromString(name);
+}
+
+std::optional<uint64_t> toCipher(std::string algorithm, const uint64_t keySize) {
+    /* The padding is implied by the cipher */
+    if ( algorithm == "AES-CBC-PKCS5" ) {
+        algorithm = "AES-CBC";
+    }
+
+    std::replace(algorithm.begin(), algorithm.end(), '-', '_');
+
+    /* Ciphers with a single key size, e.g. CHACHA20_POLY1305 */
+    const auto ret = repository::CipherFromString(algorithm);
+    if ( ret != std::nullopt ) {
+        return ret;
+    }
+
+    /* AES_GCM_SIV -> AES_128_GCM_SIV */
+    const auto pos = algorithm.find('_');
+    if ( pos == std::string::npos ) {
+        return std::nullopt;
+    }
+
+    return repository::CipherFromString(algorithm.substr(0, pos) + "_" + std::to_string(keySize) + algorithm.substr(pos));
+}
+
+/* Reads a DER length; returns false if it exceeds the data */
+bool readDER(const std::vector<uint8_t>& der, size_t& pos, const uint8_t tag, size_t& length) {
+    if ( pos + 2 > der.size() || der[pos] != tag ) {
+        return false;
+    }
+    pos++;
+
+    length = der[pos++];
+    if ( length & 0x80 ) {
+        const size_t numBytes = length & 0x7F;
+        if ( numBytes == 0 || numBytes > 2 || pos + numBytes > der.size() ) {
+            return false;
+        }
+
+        length = 0;
+        for (size_t i = 0; i < numBytes; i++) {
+            length = (length << 8) | der[pos++];
+        }
+    }
+
+    return pos + length <= der.size();
+}
+
+/* Decodes an uncompressed point, either raw or in a SubjectPublicKeyInfo */
+std::optional<std::pair<std::string, std::string>> pointFromHex(const std::string& hex) {
+    std::vector<uint8_t> point = util::HexToBin(hex);
+
+    if ( !point.empty() && point[0] == 0x30 ) {
+        size_t pos = 0, length;
+
+        if ( readDER(point, pos, 0x30, length) == false ) {
+            return std::nullopt;
+        }
+
+        /* AlgorithmIdentifier */
+        if ( readDER(point, pos, 0x30, length) == false ) {
+            return std::nullopt;
+        }
+        pos += length;
+
+        /* The BIT STRING's first byte is the number of unused bits */
+        if ( readDER(point, pos, 0x03, length) == false || length < 1 || point[pos] != 0 ) {
+            return std::nullopt;
+        }
+
+        point = std::vector<uint8_t>(point.begin() + pos + 1, point.begin() + pos + length);
+    }
+
+    if ( point.size() < 3 || point[0] != 0x04 || (point.size() - 1) % 2 != 0 ) {
+        return std::nullopt;
+    }
+
+    const size_t coordSize = (point.size() - 1) / 2;
+
+    return std::pair<std::string, std::string>{
+        util::BinToDec(point.data() + 1, coordSize),
+        util::BinToDec(point.data() + 1 + coordSize, coordSize)};
+}
+
+size_t hexSize(const nlohmann::json& hex) {
+    return hex.get<std::string>().size() / 2;
+}
+
+} /* namespace */
+
 Wycheproof::Wycheproof(const std::string filename, const std::string outDir) :
-    outDir(outDir) {
-    std::ifstream ifs(filename);
-    j = nlohmann::json::parse(ifs);
+    filename(filename), outDir(outDir) {
+    if ( outDir.size() > 5 && outDir.compare(outDir.size() - 5, 5, ".pack") == 0 ) {
+        packedCorpus.reset(PackedCorpusWriter::Open(outDir));
+        if ( packedCorpus == nullptr ) {
+            printf("Cannot open %s as a packed corpus\n", outDir.c_str());
+            exit(1);
+        }
+    }
+}
+
+Wycheproof::Handler Wycheproof::handlerFor(const std::string& schema) {
+    if ( schema == "ecdsa_verify_schema.json" ) {
+        return &Wycheproof::ECDSA_Verify;
+    } else if ( schema == "eddsa_verify_schema.json" ) {
+        return &Wycheproof::EDDSA_Verify;
+    } else if ( schema == "aead_test_schema.json" || schema == "ind_cpa_test_schema.json" ) {
+        return &Wycheproof::Symmetric;
+    } else if ( schema == "mac_test_schema.json" ) {
+        return &Wycheproof::MAC;
+    } else if ( schema == "hkdf_test_schema.json" ) {
+        return &Wycheproof::HKDF;
+    } else if ( schema == "ecdh_test_schema.json" || schema == "ecdh_ecpoint_test_schema.json" ) {
+        return &Wycheproof::ECDH;
+    } else if ( schema == "primality_test_schema.json" ) {
+        return &Wycheproof::Primality;
+    }
+
+    return nullptr;
 }
-        
+
 void Wycheproof::Run(void) {
-    const auto& groups = j["testGroups"];
+    using parse_event_t = nlohmann::json::parse_event_t;
+
+    const size_t numThreads = std::max(1U, std::thread::hardware_concurrency());
+    /* Bounds the number of groups held in memory */
+    const size_t maxQueued = numThreads * 2;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<nlohmann::json> queue;
+    bool done = false;
+
+    std::optional<std::string> schema;
+    Handler handler = nullptr;
+    /* Groups read before the schema */
+    std::vector<nlohmann::json> early;
+
+    const auto push = [&](nlohmann::json group) {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return queue.size() < maxQueued; });
+        queue.push_back(std::move(group));
+        cv.notify_all();
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.emplace_back([&] {
+            while ( true ) {
+                nlohmann::json group;
+
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [&] { return !queue.empty() || done; });
+                    if ( queue.empty() ) {
+                        break;
+                    }
+                    group = std::move(queue.front());
+                    queue.pop_front();
+                    cv.notify_all();
+                }
 
-    if ( j["schema"].get<std::string>() == "ecdsa_verify_schema.json" ) {
-        ECDSA_Verify(groups);
-    } else if ( j["schema"].get<std::string>() == "eddsa_verify_schema.json" ) {
-        EDDSA_Verify(groups);
+                (this->*handler)(group);
+            }
+        });
+    }
+
+    std::exception_ptr error = nullptr;
+
+    try {
+        std::ifstream ifs(filename);
+        std::string key;
+
+        (void)nlohmann::json::parse(ifs, [&](int depth, parse_event_t event, nlohmann::json& parsed) {
+            if ( depth == 1 && event == parse_event_t::key ) {
+                key = parsed.get<std::string>();
+            } else if ( depth == 1 && event == parse_event_t::value && key == "algorithm" && schema == std::nullopt ) {
+                algorithm = parsed.get<std::string>();
+            } else if ( depth == 1 && event == parse_event_t::value && key == "schema" ) {
+                schema = parsed.get<std::string>();
+                handler = handlerFor(*schema);
+
+                if ( handler != nullptr ) {
+                    for (auto& group : early) {
+                        push(std::move(group));
+                    }
+                }
+                early.clear();
+            } else if ( depth == 2 && event == parse_event_t::object_end && key == "testGroups" ) {
+                if ( schema == std::nullopt ) {
+                    early.push_back(std::move(parsed));
+                } else if ( handler != nullptr ) {
+                    push(std::move(parsed));
+                }
+
+                /* Do not keep the group in the document */
+                return false;
+            }
+
+            return true;
+        });
+    } catch ( ... ) {
+        error = std::current_exception();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+    }
+    cv.notify_all();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if ( error != nullptr ) {
+        std::rethrow_exception(error);
+    }
+
+    if ( handler == nullptr ) {
+        printf("Unsupported Wycheproof schema: %s\n", schema ? schema->c_str() : "(none)");
     }
 }
-        
+
 void Wycheproof::write(const uint64_t operation, fuzzing::datasource::Datasource& dsOut2) {
     fuzzing::datasource::Datasource dsOut(nullptr, 0);
 
@@ -40,7 +271,10 @@ void Wycheproof::write(const uint64_t operation, fuzzing::datasource::Datasource
     /* Terminator */
     dsOut.Put<bool>(false);
 
-    {
+    if ( packedCorpus != nullptr ) {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        packedCorpus->Add(dsOut.GetOut().data(), dsOut.GetOut().size());
+    } else {
         //std::string filename = outDir + std::string("/") + std::to_string(counter++);
         std::string filename = outDir + std::string("/") + util::SHA1(dsOut.GetOut());
         FILE* fp = fopen(filename.c_str(), "wb");
@@ -49,140 +283,264 @@ void Wycheproof::write(const uint64_t operation, fuzzing::datasource::Datasource
     }
 }
 
-void Wycheproof::ECDSA_Verify(const nlohmann::json& groups) {
-    for (const auto &group : groups) {
-        for (const auto &test : group["tests"]) {
-            nlohmann::json parameters;
+template <class T>
+void Wycheproof::write(const uint64_t operation, const T& op) {
+    fuzzing::datasource::Datasource dsOut2(nullptr, 0);
+    op.Serialize(dsOut2);
 
-            {
-                const std::string curve = group["key"]["curve"];
-                auto curveID = repository::ECC_CurveFromString(curve);
-
-                if ( curveID == std::nullopt ) {
-                    if ( curve == "brainpoolP224r1" ) {
-                        curveID = CF_ECC_CURVE("brainpool224r1");
-                    } else if ( curve == "brainpoolP224t1" ) {
-                        curveID = CF_ECC_CURVE("brainpool224t1");
-                    } else if ( curve == "brainpoolP256r1" ) {
-                        curveID = CF_ECC_CURVE("brainpool256r1");
-                    } else if ( curve == "brainpoolP256t1" ) {
-                        curveID = CF_ECC_CURVE("brainpool256t1");
-                    } else if ( curve == "brainpoolP320r1" ) {
-                        curveID = CF_ECC_CURVE("brainpool320r1");
-                    } else if ( curve == "brainpoolP320t1" ) {
-                        curveID = CF_ECC_CURVE("brainpool320t1");
-                    } else if ( curve == "brainpoolP384r1" ) {
-                        curveID = CF_ECC_CURVE("brainpool384r1");
-                    } else if ( curve == "brainpoolP384t1" ) {
-                        curveID = CF_ECC_CURVE("brainpool384t1");
-                    } else if ( curve == "brainpoolP512r1" ) {
-                        curveID = CF_ECC_CURVE("brainpool512r1");
-                    } else if ( curve == "brainpoolP512t1" ) {
-                        curveID = CF_ECC_CURVE("brainpool512t1");
-                    } else {
-                        CF_ASSERT(0, "Curve not recognized");
-                    }
-                }
+    write(operation, dsOut2);
+}
 
-                parameters["curveType"] = *curveID;
-            }
+void Wycheproof::ECDSA_Verify(const nlohmann::json& group) {
+    const auto curveID = toCurve(group["key"]["curve"]);
+    if ( curveID == std::nullopt ) {
+        return;
+    }
 
-            {
-                const std::string digest = group["sha"];
-                if ( digest == "SHA-224") {
-                    parameters["digestType"] = CF_DIGEST("SHA224");
-                } else if ( digest == "SHA-256") {
-                    parameters["digestType"] = CF_DIGEST("SHA256");
-                } else if ( digest == "SHA-384") {
-                    parameters["digestType"] = CF_DIGEST("SHA384");
-                } else if ( digest == "SHA-512") {
-                    parameters["digestType"] = CF_DIGEST("SHA512");
-                } else if ( digest == "SHA3-224") {
-                    parameters["digestType"] = CF_DIGEST("SHA3-224");
-                } else if ( digest == "SHA3-256") {
-                    parameters["digestType"] = CF_DIGEST("SHA3-256");
-                } else if ( digest == "SHA3-384") {
-                    parameters["digestType"] = CF_DIGEST("SHA3-384");
-                } else if ( digest == "SHA3-512") {
-                    parameters["digestType"] = CF_DIGEST("SHA3-512");
-                } else {
-                    CF_ASSERT(0, "Digest not recognized");
-                }
-            }
+    const auto digestID = toDigest(group["sha"]);
+    if ( digestID == std::nullopt ) {
+        return;
+    }
 
-            parameters["signature"]["pub"][0] = util::HexToDec(group["key"]["wx"]);
-            parameters["signature"]["pub"][1] = util::HexToDec(group["key"]["wy"]);
+    for (const auto &test : group["tests"]) {
+        nlohmann::json parameters;
 
-            {
-                const auto sig = util::SignatureFromDER(test["sig"].get<std::string>());
-                CF_CHECK_NE(sig, std::nullopt);
+        parameters["curveType"] = *curveID;
+        parameters["digestType"] = *digestID;
 
-                parameters["signature"]["signature"][0] = sig->first;
-                parameters["signature"]["signature"][1] = sig->second;
-            }
+        parameters["signature"]["pub"][0] = util::HexToDec(group["key"]["wx"]);
+        parameters["signature"]["pub"][1] = util::HexToDec(group["key"]["wy"]);
 
-            parameters["cleartext"] = test["msg"].get<std::string>();
+        {
+            const auto sig = util::SignatureFromDER(test["sig"].get<std::string>());
+            CF_CHECK_NE(sig, std::nullopt);
 
-            parameters["modifier"] = std::string(1000, '0');
-            {
-                fuzzing::datasource::Datasource dsOut2(nullptr, 0);
-                cryptofuzz::operation::ECDSA_Verify op(parameters);
-                op.Serialize(dsOut2);
+            parameters["signature"]["signature"][0] = sig->first;
+            parameters["signature"]["signature"][1] = sig->second;
+        }
 
-                write(CF_OPERATION("ECDSA_Verify"), dsOut2);
-            }
+        parameters["cleartext"] = test["msg"].get<std::string>();
+
+        parameters["modifier"] = std::string(1000, '0');
+
+        write(CF_OPERATION("ECDSA_Verify"), operation::ECDSA_Verify(parameters));
 
 end:
-            (void)1;
+        (void)1;
+    }
+}
+
+void Wycheproof::EDDSA_Verify(const nlohmann::json& group) {
+    uint64_t curveID;
+    {
+        const std::string curve = group["key"]["curve"];
+
+        if ( curve == "edwards448" ) {
+            curveID = CF_ECC_CURVE("ed448");
+        } else if ( curve == "edwards25519" ) {
+            curveID = CF_ECC_CURVE("ed25519");
+        } else {
+            return;
+        }
+    }
+
+    for (const auto &test : group["tests"]) {
+        nlohmann::json parameters;
+
+        parameters["curveType"] = curveID;
+
+        parameters["digestType"] = CF_DIGEST("NULL");
+
+        parameters["signature"]["pub"][0] = util::HexToDec(group["key"]["pk"]);
+        parameters["signature"]["pub"][1] = "0";
+
+        {
+            const auto sig = test["sig"].get<std::string>();
+            CF_CHECK_EQ(sig.size() % 4, 0);
+
+            const auto R = std::string(sig.data(), sig.data() + (sig.size() / 2));
+            const auto S = std::string(sig.data() + (sig.size() / 2), sig.data() + sig.size());
+
+            parameters["signature"]["signature"][0] = util::HexToDec(R);
+            parameters["signature"]["signature"][1] = util::HexToDec(S);
         }
+
+        parameters["cleartext"] = test["msg"].get<std::string>();
+
+        parameters["modifier"] = std::string(1000, '0');
+
+        write(CF_OPERATION("ECDSA_Verify"), operation::ECDSA_Verify(parameters));
+
+end:
+        (void)1;
     }
 }
 
-void Wycheproof::EDDSA_Verify(const nlohmann::json& groups) {
-    for (const auto &group : groups) {
-        for (const auto &test : group["tests"]) {
-            nlohmann::json parameters;
+/* AEAD (aead_test_schema.json) and unauthenticated (ind_cpa_test_schema.json) ciphers */
+void Wycheproof::Symmetric(const nlohmann::json& group) {
+    const auto cipherType = toCipher(algorithm, group["keySize"].get<uint64_t>());
+    if ( cipherType == std::nullopt ) {
+        return;
+    }
 
-            {
-                const std::string curve = group["key"]["curve"];
+    for (const auto &test : group["tests"]) {
+        const bool aead = test.contains("tag");
 
-                if ( curve == "edwards448" ) {
-                    parameters["curveType"] = CF_ECC_CURVE("ed448");
-                } else {
-                    CF_ASSERT(0, "Curve not recognized");
-                }
+        nlohmann::json parameters;
+
+        parameters["cipher"]["iv"] = test["iv"];
+        parameters["cipher"]["key"] = test["key"];
+        parameters["cipher"]["cipherType"] = *cipherType;
+        parameters["aad_enabled"] = aead;
+        if ( aead == true ) {
+            parameters["aad"] = test["aad"];
+        }
+
+        parameters["modifier"] = std::string(1000, '0');
+
+        {
+            nlohmann::json encrypt = parameters;
+
+            encrypt["cleartext"] = test["msg"];
+            /* Room for padding */
+            encrypt["ciphertextSize"] = hexSize(test["msg"]) + 32;
+            encrypt["tagSize_enabled"] = aead;
+            if ( aead == true ) {
+                encrypt["tagSize"] = hexSize(test["tag"]);
             }
 
-            parameters["digestType"] = CF_DIGEST("NULL");
+            write(CF_OPERATION("SymmetricEncrypt"), operation::SymmetricEncrypt(encrypt));
+        }
 
-            parameters["signature"]["pub"][0] = util::HexToDec(group["key"]["pk"]);
-            parameters["signature"]["pub"][1] = "0";
+        {
+            nlohmann::json decrypt = parameters;
 
-            {
-                const auto sig = test["sig"].get<std::string>();
-                CF_CHECK_EQ(sig.size() % 4, 0);
+            decrypt["ciphertext"] = test["ct"];
+            decrypt["tag_enabled"] = aead;
+            if ( aead == true ) {
+                decrypt["tag"] = test["tag"];
+            }
+            decrypt["cleartextSize"] = hexSize(test["ct"]) + 32;
 
-                const auto R = std::string(sig.data(), sig.data() + (sig.size() / 2));
-                const auto S = std::string(sig.data() + (sig.size() / 2), sig.data() + sig.size());
+            write(CF_OPERATION("SymmetricDecrypt"), operation::SymmetricDecrypt(decrypt));
+        }
+    }
+}
+
+void Wycheproof::MAC(const nlohmann::json& group) {
+    std::optional<uint64_t> cipherType, digestType;
+
+    if ( algorithm == "AES-CMAC" ) {
+        cipherType = toCipher("AES-CBC", group["keySize"].get<uint64_t>());
+    } else if ( algorithm.rfind("HMAC", 0) == 0 ) {
+        /* HMACSHA256 -> SHA256 */
+        digestType = toDigest(algorithm.substr(4));
+    }
+
+    if ( cipherType == std::nullopt && digestType == std::nullopt ) {
+        return;
+    }
+
+    for (const auto &test : group["tests"]) {
+        nlohmann::json parameters;
+
+        parameters["cleartext"] = test["msg"];
+        parameters["cipher"]["iv"] = "";
+        parameters["cipher"]["key"] = test["key"];
+        parameters["modifier"] = std::string(1000, '0');
+
+        if ( cipherType != std::nullopt ) {
+            parameters["cipher"]["cipherType"] = *cipherType;
+
+            write(CF_OPERATION("CMAC"), operation::CMAC(parameters));
+        } else {
+            /* Not used by HMAC */
+            parameters["cipher"]["cipherType"] = 0;
+            parameters["digestType"] = *digestType;
+
+            write(CF_OPERATION("HMAC"), operation::HMAC(parameters));
+        }
+    }
+}
+
+void Wycheproof::HKDF(const nlohmann::json& group) {
+    /* HKDF-SHA-256 -> SHA256 */
+    const auto digestType = algorithm.rfind("HKDF-", 0) == 0 ? toDigest(algorithm.substr(5)) : std::nullopt;
+    if ( digestType == std::nullopt ) {
+        return;
+    }
+
+    for (const auto &test : group["tests"]) {
+        nlohmann::json parameters;
+
+        parameters["digestType"] = *digestType;
+        parameters["password"] = test["ikm"];
+        parameters["salt"] = test["salt"];
+        parameters["info"] = test["info"];
+        parameters["keySize"] = test["size"].get<uint64_t>();
+        parameters["modifier"] = std::string(1000, '0');
 
-                parameters["signature"]["signature"][0] = util::HexToDec(R);
-                parameters["signature"]["signature"][1] = util::HexToDec(S);
+        write(CF_OPERATION("KDF_HKDF"), operation::KDF_HKDF(parameters));
+    }
+}
+
+/* ECDH_Derive takes two public keys, so the keys of each test are
+ * exercised separately: the peer's public key is validated and the
+ * private key is converted to a public key.
+ */
+void Wycheproof::ECDH(const nlohmann::json& group) {
+    const auto curveType = toCurve(group["curve"]);
+    if ( curveType == std::nullopt ) {
+        return;
+    }
+
+    for (const auto &test : group["tests"]) {
+        {
+            const auto pub = pointFromHex(test["public"]);
+
+            if ( pub != std::nullopt ) {
+                nlohmann::json parameters;
+
+                parameters["curveType"] = *curveType;
+                parameters["pub_x"] = pub->first;
+                parameters["pub_y"] = pub->second;
+                parameters["modifier"] = std::string(1000, '0');
+
+                write(CF_OPERATION("ECC_ValidatePubkey"), operation::ECC_ValidatePubkey(parameters));
             }
+        }
 
-            parameters["cleartext"] = test["msg"].get<std::string>();
+        {
+            nlohmann::json parameters;
 
+            parameters["curveType"] = *curveType;
+            parameters["priv"] = util::HexToDec(test["private"]);
             parameters["modifier"] = std::string(1000, '0');
-            {
-                fuzzing::datasource::Datasource dsOut2(nullptr, 0);
-                cryptofuzz::operation::ECDSA_Verify op(parameters);
-                op.Serialize(dsOut2);
 
-                write(CF_OPERATION("ECDSA_Verify"), dsOut2);
-            }
+            write(CF_OPERATION("ECC_PrivateToPublic"), operation::ECC_PrivateToPublic(parameters));
+        }
+    }
+}
 
-end:
-            (void)1;
+void Wycheproof::Primality(const nlohmann::json& group) {
+    for (const auto &test : group["tests"]) {
+        const std::string value = test["value"];
+
+        /* Values are two's complement; negative values are not supported */
+        if ( value.empty() || value[0] >= '8' ) {
+            continue;
         }
+
+        nlohmann::json parameters;
+
+        parameters["calcOp"] = CF_CALCOP("IsPrime(A)");
+        parameters["bn1"] = util::HexToDec(value);
+        parameters["bn2"] = "0";
+        parameters["bn3"] = "0";
+        parameters["bn4"] = "0";
+        parameters["modifier"] = std::string(1000, '0');
+
+        write(CF_OPERATION("BignumCalc"), operation::BignumCalc(parameters));
     }
 }
 